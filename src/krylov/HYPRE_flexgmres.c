@@ -74,6 +74,24 @@ HYPRE_FlexGMRESGetKDim( HYPRE_Solver solver,
    return( hypre_FlexGMRESGetKDim( (void *) solver, k_dim ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_FlexGMRESSetCGS, HYPRE_FlexGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FlexGMRESSetCGS( HYPRE_Solver solver,
+                       HYPRE_Int    cgs )
+{
+   return( hypre_FlexGMRESSetCGS( (void *) solver, cgs ) );
+}
+
+HYPRE_Int
+HYPRE_FlexGMRESGetCGS( HYPRE_Solver solver,
+                       HYPRE_Int   *cgs )
+{
+   return( hypre_FlexGMRESGetCGS( (void *) solver, cgs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_FlexGMRESSetTol, HYPRE_FlexGMRESGetTol
  *--------------------------------------------------------------------------*/
@@ -178,6 +178,18 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined variant of PCG, which sums the inner products
+ * of an iteration in a single non-blocking reduction overlapped with the
+ * preconditioner and the matvec.  It needs more vector storage and updates,
+ * and it is only used with the default convergence test (the standard
+ * iteration is used with the residual, relative change, convergence factor
+ * and recompute residual options).  The residual is updated recursively, so
+ * the attainable accuracy can be somewhat lower.  The default is 0.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -259,6 +271,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver  solver,
+                                HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -359,6 +376,16 @@ HYPRE_Int HYPRE_GMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetKDim(HYPRE_Solver solver,
                              HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Use classical Gram-Schmidt for the Arnoldi process, with all
+ * projections of a step summed in one global reduction.  Set to 2 to
+ * orthogonalize twice (CGS2), which is as stable as modified Gram-Schmidt.
+ * Needs the fused vector operations of the ParCSR interface; otherwise
+ * modified Gram-Schmidt is used.  Default: 0 (modified Gram-Schmidt).
+ **/
+HYPRE_Int HYPRE_GMRESSetCGS(HYPRE_Solver solver,
+                            HYPRE_Int    cgs);
+
 /**
  * (Optional) Additionally require that the relative difference in
  * successive iterates be small.
@@ -452,6 +479,11 @@ HYPRE_Int HYPRE_GMRESGetMaxIter(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
                              HYPRE_Int    *k_dim);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetCGS(HYPRE_Solver  solver,
+                            HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetRelChange(HYPRE_Solver  solver,
@@ -544,6 +576,12 @@ HYPRE_Int HYPRE_FlexGMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_FlexGMRESSetKDim(HYPRE_Solver solver,
                                  HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Select the orthogonalization, see HYPRE\_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_FlexGMRESSetCGS(HYPRE_Solver solver,
+                                HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -615,6 +653,11 @@ HYPRE_Int HYPRE_FlexGMRESGetMaxIter(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_FlexGMRESGetKDim(HYPRE_Solver  solver,
                                  HYPRE_Int    *k_dim);
 
+/**
+ **/
+HYPRE_Int HYPRE_FlexGMRESGetCGS(HYPRE_Solver  solver,
+                                HYPRE_Int    *cgs);
+
 /**
  **/
 HYPRE_Int HYPRE_FlexGMRESGetPrecond(HYPRE_Solver  solver,
@@ -716,6 +759,12 @@ HYPRE_LGMRESSetMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_LGMRESSetKDim(HYPRE_Solver solver,
                               HYPRE_Int    k_dim);
 
+/**
+ * (Optional) Select the orthogonalization, see HYPRE\_GMRESSetCGS.
+ **/
+HYPRE_Int HYPRE_LGMRESSetCGS(HYPRE_Solver solver,
+                             HYPRE_Int    cgs);
+
 /**
  * (Optional) Set the number of augmentation vectors  (default: 2).
  **/
@@ -793,6 +842,11 @@ HYPRE_Int HYPRE_LGMRESGetMaxIter(HYPRE_Solver  solver,
  **/
 HYPRE_Int HYPRE_LGMRESGetKDim(HYPRE_Solver  solver,
                               HYPRE_Int    *k_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_LGMRESGetCGS(HYPRE_Solver  solver,
+                             HYPRE_Int    *cgs);
 /**
  **/
 HYPRE_Int HYPRE_LGMRESGetAugDim(HYPRE_Solver  solver,
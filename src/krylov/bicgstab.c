@@ -58,6 +58,21 @@ hypre_BiCGSTABFunctionsCreate(
    return bicgstab_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BiCGSTABFunctionsSetAxpyNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BiCGSTABFunctionsSetAxpyNorm(
+   hypre_BiCGSTABFunctions *bicgstab_functions,
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   )
+{
+   bicgstab_functions->AxpyNorm = AxpyNorm;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BiCGSTABCreate
  *--------------------------------------------------------------------------*/
@@ -425,9 +440,16 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
         else
             gamma= gamma_numer/gamma_denom;
 	(*(bicgstab_functions->Axpy))(gamma,v,x);
-	(*(bicgstab_functions->Axpy))(-gamma,s,r);
     /* residual is now updated, must immediately check for convergence */
-	r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+	if (bicgstab_functions->AxpyNorm)
+	{
+	   r_norm = sqrt((*(bicgstab_functions->AxpyNorm))(-gamma,s,r));
+	}
+	else
+	{
+	   (*(bicgstab_functions->Axpy))(-gamma,s,r);
+	   r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+	}
 	if (logging > 0 || print_level > 0)
 	{
 	   norms[iter] = r_norm;
@@ -85,6 +85,9 @@ typedef struct
 	HYPRE_Int  (*precond_setup) (void *vdata , void *A , void *b , void *x);
 	HYPRE_Int  (*precond)       (void *vdata , void *A , void *b , void *x);
 
+  /* optional, see hypre_BiCGSTABFunctionsSetAxpyNorm */
+  HYPRE_Real (*AxpyNorm)      ( HYPRE_Complex alpha , void *x , void *y );
+
 } hypre_BiCGSTABFunctions;
 
 /**
@@ -164,6 +167,17 @@ hypre_BiCGSTABFunctionsCreate(
    HYPRE_Int  (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+/**
+ * Sets the optional function computing y += alpha*x together with <y,y>
+ * of the updated y, which saves a pass over y in the residual update.
+ **/
+
+HYPRE_Int
+hypre_BiCGSTABFunctionsSetAxpyNorm(
+   hypre_BiCGSTABFunctions *bicgstab_functions,
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   );
+
 /**
  * Description...
  *
@@ -68,6 +68,27 @@ hypre_FlexGMRESFunctionsCreate(
    return fgmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESFunctionsSetMassOps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESFunctionsSetMassOps(
+   hypre_FlexGMRESFunctions *fgmres_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   )
+{
+   fgmres_functions->MassInnerProd = MassInnerProd;
+   fgmres_functions->MassAxpy      = MassAxpy;
+   fgmres_functions->AxpyNorm      = AxpyNorm;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -83,6 +104,7 @@ hypre_FlexGMRESCreate( hypre_FlexGMRESFunctions *fgmres_functions )
  
    /* set defaults */
    (fgmres_data -> k_dim)          = 20;
+   (fgmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (fgmres_data -> tol)            = 1.0e-06;
    (fgmres_data -> cf_tol)         = 0.0;
    (fgmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -263,6 +285,10 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    hypre_FlexGMRESData  *fgmres_data   = (hypre_FlexGMRESData *)fgmres_vdata;
    hypre_FlexGMRESFunctions *fgmres_functions = fgmres_data->functions;
    HYPRE_Int 		     k_dim        = (fgmres_data -> k_dim);
+   HYPRE_Int               cgs          = (fgmres_data -> cgs);
+   HYPRE_Int               num_passes   = hypre_min(cgs, 2);
+   /* the fused kernels handle eight vectors per pass over memory */
+   HYPRE_Int               unroll       = 8;
    HYPRE_Int               min_iter     = (fgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (fgmres_data -> max_iter);
    HYPRE_Real 	     r_tol        = (fgmres_data -> tol);
@@ -289,7 +315,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
-   HYPRE_Real *rs, **hh, *c, *s; 
+   HYPRE_Real *rs, **hh, *c, *s, *proj; 
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -328,6 +354,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
    c = hypre_CTAllocF(HYPRE_Real,k_dim,fgmres_functions, HYPRE_MEMORY_HOST);
    s = hypre_CTAllocF(HYPRE_Real,k_dim,fgmres_functions, HYPRE_MEMORY_HOST);
+   proj = hypre_CTAllocF(HYPRE_Real,k_dim+1,fgmres_functions, HYPRE_MEMORY_HOST);
 
 
   /* fgmres mod. - need non-modified hessenberg ???? */
@@ -456,6 +483,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
         {
            hypre_TFreeF(c,fgmres_functions); 
            hypre_TFreeF(s,fgmres_functions); 
+           hypre_TFreeF(proj,fgmres_functions);
            hypre_TFreeF(rs,fgmres_functions);
 
            for (i=0; i < k_dim+1; i++) {
@@ -515,13 +543,50 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
            (*(fgmres_functions->Matvec))(matvec_data, 1.0, A, pre_vecs[i-1], 0.0, p[i]);
            
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if (cgs > 0 && fgmres_functions->MassInnerProd && fgmres_functions->MassAxpy)
            {
-              hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
-              (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* classical Gram_Schmidt, one reduction per pass */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = 0.0;
+              }
+              for (k = 0; k < num_passes; k++)
+              {
+                 (*(fgmres_functions->MassInnerProd))(p[i], p, i, unroll, proj);
+                 for (j=0; j < i; j++)
+                 {
+                    hh[j][i-1] += proj[j];
+                    proj[j] = -proj[j];
+                 }
+                 if (k < num_passes-1 || !fgmres_functions->AxpyNorm)
+                 {
+                    (*(fgmres_functions->MassAxpy))(proj, p, p[i], i, unroll);
+                 }
+              }
+              if (fgmres_functions->AxpyNorm)
+              {
+                 /* fuse the last projection with the norm of p[i] */
+                 if (i > 1)
+                 {
+                    (*(fgmres_functions->MassAxpy))(proj, p, p[i], i-1, unroll);
+                 }
+                 t = sqrt((*(fgmres_functions->AxpyNorm))(proj[i-1], p[i-1], p[i]));
+              }
+              else
+              {
+                 t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
+              }
+           }
+           else
+           {
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
+                 (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
            }
-           t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -614,10 +679,18 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 	}
         /* form linear combination of pre_vecs's to get solution */
       
-        (*(fgmres_functions->CopyVector))(pre_vecs[i-1],w);
-        (*(fgmres_functions->ScaleVector))(rs[i-1],w);
-        for (j = i-2; j >=0; j--)
-           (*(fgmres_functions->Axpy))(rs[j], pre_vecs[j], w);
+        if (fgmres_functions->MassAxpy)
+        {
+           (*(fgmres_functions->ClearVector))(w);
+           (*(fgmres_functions->MassAxpy))(rs, pre_vecs, w, i, unroll);
+        }
+        else
+        {
+           (*(fgmres_functions->CopyVector))(pre_vecs[i-1],w);
+           (*(fgmres_functions->ScaleVector))(rs[i-1],w);
+           for (j = i-2; j >=0; j--)
+              (*(fgmres_functions->Axpy))(rs[j], pre_vecs[j], w);
+        }
         
 
         /* don't need to un-wind precond... - so now the correction is
@@ -690,6 +763,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 
    hypre_TFreeF(c,fgmres_functions); 
    hypre_TFreeF(s,fgmres_functions); 
+   hypre_TFreeF(proj,fgmres_functions);
    hypre_TFreeF(rs,fgmres_functions);
 
    for (i=0; i < k_dim+1; i++)
@@ -730,6 +804,32 @@ hypre_FlexGMRESGetKDim( void   *fgmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESSetCGS, hypre_FlexGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESSetCGS( void      *fgmres_vdata,
+                       HYPRE_Int  cgs )
+{
+   hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
+
+   (fgmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FlexGMRESGetCGS( void      *fgmres_vdata,
+                       HYPRE_Int *cgs )
+{
+   hypre_FlexGMRESData *fgmres_data = (hypre_FlexGMRESData *)fgmres_vdata;
+
+   *cgs = (fgmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESSetTol, hypre_FlexGMRESGetTol
@@ -62,6 +62,13 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional, see hypre_FlexGMRESFunctionsSetMassOps */
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result );
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll );
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
 
@@ -76,6 +83,7 @@ typedef struct
 typedef struct
 {
    HYPRE_Int      k_dim;
+   HYPRE_Int      cgs;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -148,6 +156,23 @@ hypre_FlexGMRESFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+/**
+ * Sets the optional fused vector operations.  MassInnerProd computes
+ * <y[j],x> for j < k with one global sum, MassAxpy adds alpha[j]*x[j]
+ * to y for j < k, and AxpyNorm returns <y,y> after y += alpha*x.  The
+ * arrays of vectors come from CreateVectorArray.  Any of them may be NULL.
+ **/
+
+HYPRE_Int
+hypre_FlexGMRESFunctionsSetMassOps(
+   hypre_FlexGMRESFunctions *fgmres_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   );
+
 /**
  * Description...
  *
@@ -65,6 +65,27 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetMassOps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetMassOps(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   )
+{
+   gmres_functions->MassInnerProd = MassInnerProd;
+   gmres_functions->MassAxpy      = MassAxpy;
+   gmres_functions->AxpyNorm      = AxpyNorm;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -80,6 +101,7 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
  
    /* set defaults */
    (gmres_data -> k_dim)          = 5;
+   (gmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (gmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (gmres_data -> cf_tol)         = 0.0;
    (gmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -252,6 +274,10 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Int             min_iter           = (gmres_data -> min_iter);
    HYPRE_Int             max_iter           = (gmres_data -> max_iter);
    HYPRE_Int             rel_change         = (gmres_data -> rel_change);
+   HYPRE_Int             cgs                = (gmres_data -> cgs);
+   HYPRE_Int             num_passes         = hypre_min(cgs, 2);
+   /* the fused kernels handle eight vectors per pass over memory */
+   HYPRE_Int             unroll             = 8;
    HYPRE_Int             skip_real_r_check  = (gmres_data -> skip_real_r_check);
    HYPRE_Int 		 hybrid             = (gmres_data -> hybrid);
    HYPRE_Real            r_tol              = (gmres_data -> tol);
@@ -278,7 +304,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    HYPRE_Int        break_value = 0;
    HYPRE_Int        i, j, k;
-   HYPRE_Real *rs, **hh, *c, *s, *rs_2; 
+   HYPRE_Real *rs, **hh, *c, *s, *rs_2, *proj; 
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm, x_norm;
@@ -317,6 +343,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
    c = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
    s = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   proj = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
    if (rel_change)
    {
       rs_2 = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST); 
@@ -454,6 +481,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
       {
          hypre_TFreeF(c,gmres_functions); 
          hypre_TFreeF(s,gmres_functions); 
+         hypre_TFreeF(proj,gmres_functions);
          hypre_TFreeF(rs,gmres_functions);
          if (rel_change)  hypre_TFreeF(rs_2,gmres_functions);
          for (i=0; i < k_dim+1; i++) hypre_TFreeF(hh[i],gmres_functions);
@@ -502,13 +530,50 @@ hypre_GMRESSolve(void  *gmres_vdata,
          (*(gmres_functions->ClearVector))(r);
          precond(precond_data, A, p[i-1], r);
          (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-         /* modified Gram_Schmidt */
-         for (j=0; j < i; j++)
+         if (cgs > 0 && gmres_functions->MassInnerProd && gmres_functions->MassAxpy)
          {
-            hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            /* classical Gram_Schmidt, one reduction per pass */
+            for (j=0; j < i; j++)
+            {
+               hh[j][i-1] = 0.0;
+            }
+            for (k = 0; k < num_passes; k++)
+            {
+               (*(gmres_functions->MassInnerProd))(p[i], p, i, unroll, proj);
+               for (j=0; j < i; j++)
+               {
+                  hh[j][i-1] += proj[j];
+                  proj[j] = -proj[j];
+               }
+               if (k < num_passes-1 || !gmres_functions->AxpyNorm)
+               {
+                  (*(gmres_functions->MassAxpy))(proj, p, p[i], i, unroll);
+               }
+            }
+            if (gmres_functions->AxpyNorm)
+            {
+               /* fuse the last projection with the norm of p[i] */
+               if (i > 1)
+               {
+                  (*(gmres_functions->MassAxpy))(proj, p, p[i], i-1, unroll);
+               }
+               t = sqrt((*(gmres_functions->AxpyNorm))(proj[i-1], p[i-1], p[i]));
+            }
+            else
+            {
+               t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
+            }
+         }
+         else
+         {
+            /* modified Gram_Schmidt */
+            for (j=0; j < i; j++)
+            {
+               hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
+               (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            }
+            t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          }
-         t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          hh[i][i-1] = t;
          if (t != 0.0)
          {
@@ -712,10 +777,18 @@ hypre_GMRESSolve(void  *gmres_vdata,
          rs[k] = t/hh[k][k];
       }
 
-      (*(gmres_functions->CopyVector))(p[i-1],w);
-      (*(gmres_functions->ScaleVector))(rs[i-1],w);
-      for (j = i-2; j >=0; j--)
-         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      if (gmres_functions->MassAxpy)
+      {
+         (*(gmres_functions->ClearVector))(w);
+         (*(gmres_functions->MassAxpy))(rs, p, w, i, unroll);
+      }
+      else
+      {
+         (*(gmres_functions->CopyVector))(p[i-1],w);
+         (*(gmres_functions->ScaleVector))(rs[i-1],w);
+         for (j = i-2; j >=0; j--)
+            (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      }
 
       (*(gmres_functions->ClearVector))(r);
       /* find correction (in r) */
@@ -910,6 +983,32 @@ hypre_GMRESGetKDim( void      *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetCGS, hypre_GMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetCGS( void      *gmres_vdata,
+                   HYPRE_Int  cgs )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   (gmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetCGS( void      *gmres_vdata,
+                   HYPRE_Int *cgs )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *cgs = (gmres_data -> cgs);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetTol, hypre_GMRESGetTol
  *--------------------------------------------------------------------------*/
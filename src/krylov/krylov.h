@@ -105,6 +105,9 @@ extern "C" {
     HYPRE_Int  (*precond_setup) (void *vdata , void *A , void *b , void *x);
     HYPRE_Int  (*precond)       (void *vdata , void *A , void *b , void *x);
 
+    /* optional, see hypre_BiCGSTABFunctionsSetAxpyNorm */
+    HYPRE_Real (*AxpyNorm)      ( HYPRE_Complex alpha , void *x , void *y );
+
   } hypre_BiCGSTABFunctions;
 
   /**
@@ -186,6 +189,17 @@ extern "C" {
           HYPRE_Int  (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Sets the optional function computing y += alpha*x together with <y,y>
+     * of the updated y, which saves a pass over y in the residual update.
+     **/
+
+    HYPRE_Int
+      hypre_BiCGSTABFunctionsSetAxpyNorm(
+          hypre_BiCGSTABFunctions *bicgstab_functions,
+          HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+          );
+
     /**
      * Description...
      *
@@ -412,6 +426,13 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional, see hypre_GMRESFunctionsSetMassOps */
+    HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+        void *result );
+    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+        HYPRE_Int unroll );
+    HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
 
@@ -424,6 +445,7 @@ extern "C" {
   typedef struct
   {
     HYPRE_Int      k_dim;
+    HYPRE_Int      cgs;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -498,6 +520,23 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Sets the optional fused vector operations.  MassInnerProd computes
+     * <y[j],x> for j < k with one global sum, MassAxpy adds alpha[j]*x[j]
+     * to y for j < k, and AxpyNorm returns <y,y> after y += alpha*x.  The
+     * arrays of vectors come from CreateVectorArray.  Any of them may be NULL.
+     **/
+
+    HYPRE_Int
+      hypre_GMRESFunctionsSetMassOps(
+          hypre_GMRESFunctions *gmres_functions,
+          HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+            void *result ),
+          HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+            HYPRE_Int unroll ),
+          HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+          );
+
     /**
      * Description...
      *
@@ -742,6 +781,13 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional, see hypre_LGMRESFunctionsSetMassOps */
+    HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+        void *result );
+    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+        HYPRE_Int unroll );
+    HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
 
@@ -754,6 +800,7 @@ extern "C" {
   typedef struct
   {
     HYPRE_Int      k_dim;
+    HYPRE_Int      cgs;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -832,6 +879,23 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Sets the optional fused vector operations.  MassInnerProd computes
+     * <y[j],x> for j < k with one global sum, MassAxpy adds alpha[j]*x[j]
+     * to y for j < k, and AxpyNorm returns <y,y> after y += alpha*x.  The
+     * arrays of vectors come from CreateVectorArray.  Any of them may be NULL.
+     **/
+
+    HYPRE_Int
+      hypre_LGMRESFunctionsSetMassOps(
+          hypre_LGMRESFunctions *lgmres_functions,
+          HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+            void *result ),
+          HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+            HYPRE_Int unroll ),
+          HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+          );
+
     /**
      * Description...
      *
@@ -903,6 +967,13 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional, see hypre_FlexGMRESFunctionsSetMassOps */
+    HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+        void *result );
+    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+        HYPRE_Int unroll );
+    HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
     HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
     HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
 
@@ -917,6 +988,7 @@ extern "C" {
   typedef struct
   {
     HYPRE_Int      k_dim;
+    HYPRE_Int      cgs;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -989,6 +1061,23 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Sets the optional fused vector operations.  MassInnerProd computes
+     * <y[j],x> for j < k with one global sum, MassAxpy adds alpha[j]*x[j]
+     * to y for j < k, and AxpyNorm returns <y,y> after y += alpha*x.  The
+     * arrays of vectors come from CreateVectorArray.  Any of them may be NULL.
+     **/
+
+    HYPRE_Int
+      hypre_FlexGMRESFunctionsSetMassOps(
+          hypre_FlexGMRESFunctions *fgmres_functions,
+          HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+            void *result ),
+          HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+            HYPRE_Int unroll ),
+          HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+          );
+
     /**
      * Description...
      *
@@ -1062,6 +1151,14 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional, see hypre_PCGFunctionsSetMultiInnerProd */
+    HYPRE_Int    (*MultiInnerProdInit) ( HYPRE_Int nprod, void **x, void **y,
+        HYPRE_Real *local_result, HYPRE_Real *result,
+        hypre_MPI_Request *request );
+
+    /* optional, see hypre_PCGFunctionsSetAxpyNorm */
+    HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
     HYPRE_Int    (*precond)(void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup)(void *vdata , void *A , void *b , void *x);
 
@@ -1100,6 +1197,11 @@ extern "C" {
      every "recompute_residual_p" iterations.  This can be expensive and degrade the
      convergence. Use it only if you have seen a problem with the regular residual
      computation.
+     - pipelined!=0 means: use the pipelined variant (Ghysels and Vanroose), which
+     sums the inner products of an iteration in one non-blocking reduction that is
+     overlapped with the preconditioner and the matvec.  It needs the
+     MultiInnerProdInit function and falls back to the standard iteration with
+     rel_change, recompute_residual(_p), rtol, cf_tol, atolf, stop_crit or hybrid.
      */
 
   typedef struct
@@ -1117,6 +1219,7 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      pipelined;
 
     void    *A;
     void    *p;
@@ -1124,6 +1227,15 @@ extern "C" {
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
 
+    /* pipelined variant: u = C*r, w = A*u, m = C*w, n = A*m, and the
+       recurrences z (for A*q) and q (for C*s) */
+    void    *u;
+    void    *w;
+    void    *m;
+    void    *n;
+    void    *z;
+    void    *q;
+
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
     void    *precond_data;
@@ -1182,6 +1294,31 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Sets the optional function computing several inner products <x[k],y[k]>
+     * with one non-blocking global sum; the sum is completed with hypre_MPI_Wait.
+     * Used by the pipelined variant.
+     **/
+
+    HYPRE_Int
+      hypre_PCGFunctionsSetMultiInnerProd(
+          hypre_PCGFunctions *pcg_functions,
+          HYPRE_Int    (*MultiInnerProdInit) ( HYPRE_Int nprod, void **x, void **y,
+            HYPRE_Real *local_result, HYPRE_Real *result,
+            hypre_MPI_Request *request )
+          );
+
+    /**
+     * Sets the optional function computing y += alpha*x together with <y,y>
+     * of the updated y, which saves a pass over y in the residual update.
+     **/
+
+    HYPRE_Int
+      hypre_PCGFunctionsSetAxpyNorm(
+          hypre_PCGFunctions *pcg_functions,
+          HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+          );
+
     /**
      * Description...
      *
@@ -1241,6 +1378,8 @@ extern "C" {
   HYPRE_Int hypre_GMRESSolve ( void *gmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_GMRESSetKDim ( void *gmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_GMRESGetKDim ( void *gmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_GMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_GMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_GMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_GMRESGetTol ( void *gmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_GMRESSetAbsoluteTol ( void *gmres_vdata , HYPRE_Real a_tol );
@@ -1315,6 +1454,8 @@ extern "C" {
   HYPRE_Int hypre_FlexGMRESSolve ( void *fgmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_FlexGMRESSetKDim ( void *fgmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_FlexGMRESGetKDim ( void *fgmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_FlexGMRESSetCGS ( void *fgmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_FlexGMRESGetCGS ( void *fgmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_FlexGMRESSetTol ( void *fgmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_FlexGMRESGetTol ( void *fgmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_FlexGMRESSetAbsoluteTol ( void *fgmres_vdata , HYPRE_Real a_tol );
@@ -1347,6 +1488,8 @@ extern "C" {
   HYPRE_Int hypre_LGMRESSolve ( void *lgmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_LGMRESSetKDim ( void *lgmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_LGMRESGetKDim ( void *lgmres_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_LGMRESSetCGS ( void *lgmres_vdata , HYPRE_Int cgs );
+  HYPRE_Int hypre_LGMRESGetCGS ( void *lgmres_vdata , HYPRE_Int *cgs );
   HYPRE_Int hypre_LGMRESSetAugDim ( void *lgmres_vdata , HYPRE_Int aug_dim );
   HYPRE_Int hypre_LGMRESGetAugDim ( void *lgmres_vdata , HYPRE_Int *aug_dim );
   HYPRE_Int hypre_LGMRESSetTol ( void *lgmres_vdata , HYPRE_Real tol );
@@ -1408,6 +1551,8 @@ extern "C" {
   HYPRE_Int HYPRE_GMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_GMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
   HYPRE_Int HYPRE_GMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_GMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_GMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_GMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_GMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_GMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1474,6 +1619,8 @@ extern "C" {
   HYPRE_Int HYPRE_FlexGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_FlexGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
   HYPRE_Int HYPRE_FlexGMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_FlexGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_FlexGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_FlexGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_FlexGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_FlexGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1501,6 +1648,8 @@ extern "C" {
   HYPRE_Int HYPRE_LGMRESSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_LGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
   HYPRE_Int HYPRE_LGMRESGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_LGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
+  HYPRE_Int HYPRE_LGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
   HYPRE_Int HYPRE_LGMRESSetAugDim ( HYPRE_Solver solver , HYPRE_Int aug_dim );
   HYPRE_Int HYPRE_LGMRESGetAugDim ( HYPRE_Solver solver , HYPRE_Int *aug_dim );
   HYPRE_Int HYPRE_LGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
@@ -1549,6 +1698,8 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
   HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
   HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+  HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver , HYPRE_Int *pipelined );
   HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1586,6 +1737,8 @@ extern "C" {
   HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata , HYPRE_Int *recompute_residual );
   HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int recompute_residual_p );
   HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata , HYPRE_Int pipelined );
+  HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata , HYPRE_Int *pipelined );
   HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
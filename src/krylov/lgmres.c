@@ -65,6 +65,27 @@ hypre_LGMRESFunctionsCreate(
    return lgmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESFunctionsSetMassOps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LGMRESFunctionsSetMassOps(
+   hypre_LGMRESFunctions *lgmres_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   )
+{
+   lgmres_functions->MassInnerProd = MassInnerProd;
+   lgmres_functions->MassAxpy      = MassAxpy;
+   lgmres_functions->AxpyNorm      = AxpyNorm;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_LGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -80,6 +101,7 @@ hypre_LGMRESCreate( hypre_LGMRESFunctions *lgmres_functions )
  
    /* set defaults */
    (lgmres_data -> k_dim)          = 20;
+   (lgmres_data -> cgs)            = 0; /* modified Gram-Schmidt */
    (lgmres_data -> tol)            = 1.0e-06;
    (lgmres_data -> cf_tol)         = 0.0;
    (lgmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -287,6 +309,10 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    hypre_LGMRESData  *lgmres_data   = (hypre_LGMRESData *)lgmres_vdata;
    hypre_LGMRESFunctions *lgmres_functions = lgmres_data->functions;
    HYPRE_Int 		     k_dim        = (lgmres_data -> k_dim);
+   HYPRE_Int               cgs          = (lgmres_data -> cgs);
+   HYPRE_Int               num_passes   = hypre_min(cgs, 2);
+   /* the fused kernels handle eight vectors per pass over memory */
+   HYPRE_Int               unroll       = 8;
    HYPRE_Int               min_iter     = (lgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (lgmres_data -> max_iter);
    HYPRE_Real 	     r_tol        = (lgmres_data -> tol);
@@ -321,7 +347,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
-   HYPRE_Real *rs, **hh, *c, *s; 
+   HYPRE_Real *rs, **hh, *c, *s, *proj; 
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -358,6 +384,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    rs = hypre_CTAllocF(HYPRE_Real,k_dim+1+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
    c = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
    s = hypre_CTAllocF(HYPRE_Real,k_dim+aug_dim,lgmres_functions, HYPRE_MEMORY_HOST);
+   proj = hypre_CTAllocF(HYPRE_Real,k_dim+1,lgmres_functions, HYPRE_MEMORY_HOST);
 
 
    
@@ -495,6 +522,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
         {
            hypre_TFreeF(c,lgmres_functions); 
            hypre_TFreeF(s,lgmres_functions); 
+           hypre_TFreeF(proj,lgmres_functions);
            hypre_TFreeF(rs,lgmres_functions);
            for (i=0; i < k_dim+aug_dim+1; i++) {
               hypre_TFreeF(hh[i],lgmres_functions);
@@ -578,13 +606,50 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
            }
            /*---*/
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if (cgs > 0 && lgmres_functions->MassInnerProd && lgmres_functions->MassAxpy)
+           {
+              /* classical Gram_Schmidt, one reduction per pass */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = 0.0;
+              }
+              for (k = 0; k < num_passes; k++)
+              {
+                 (*(lgmres_functions->MassInnerProd))(p[i], p, i, unroll, proj);
+                 for (j=0; j < i; j++)
+                 {
+                    hh[j][i-1] += proj[j];
+                    proj[j] = -proj[j];
+                 }
+                 if (k < num_passes-1 || !lgmres_functions->AxpyNorm)
+                 {
+                    (*(lgmres_functions->MassAxpy))(proj, p, p[i], i, unroll);
+                 }
+              }
+              if (lgmres_functions->AxpyNorm)
+              {
+                 /* fuse the last projection with the norm of p[i] */
+                 if (i > 1)
+                 {
+                    (*(lgmres_functions->MassAxpy))(proj, p, p[i], i-1, unroll);
+                 }
+                 t = sqrt((*(lgmres_functions->AxpyNorm))(proj[i-1], p[i-1], p[i]));
+              }
+              else
+              {
+                 t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
+              }
+           }
+           else
            {
-              hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
-              (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
+                 (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
            }
-           t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -683,7 +748,12 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
         if (it_arnoldi > i) it_arnoldi = i; 
 
 
-        if (!it_aug)
+        if (!it_aug && lgmres_functions->MassAxpy)
+        {
+           (*(lgmres_functions->ClearVector))(w);
+           (*(lgmres_functions->MassAxpy))(rs, p, w, i, unroll);
+        }
+        else if (!it_aug)
         {
            (*(lgmres_functions->CopyVector))(p[i-1],w);
            (*(lgmres_functions->ScaleVector))(rs[i-1],w);
@@ -692,13 +762,21 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
         }
         else /* need some of the augvecs */
         {
-           (*(lgmres_functions->CopyVector))(p[0],w);
-           (*(lgmres_functions->ScaleVector))(rs[0],w);
-
-           /* reg. arnoldi directions */  
-           for (j = 1; j < it_arnoldi; j++) /*first one already done */
+           if (lgmres_functions->MassAxpy)
            {
-              (*(lgmres_functions->Axpy))(rs[j], p[j], w);
+              (*(lgmres_functions->ClearVector))(w);
+              (*(lgmres_functions->MassAxpy))(rs, p, w, it_arnoldi, unroll);
+           }
+           else
+           {
+              (*(lgmres_functions->CopyVector))(p[0],w);
+              (*(lgmres_functions->ScaleVector))(rs[0],w);
+
+              /* reg. arnoldi directions */  
+              for (j = 1; j < it_arnoldi; j++) /*first one already done */
+              {
+                 (*(lgmres_functions->Axpy))(rs[j], p[j], w);
+              }
            }
             
            /* augment directions */
@@ -847,6 +925,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
 
    hypre_TFreeF(c,lgmres_functions); 
    hypre_TFreeF(s,lgmres_functions); 
+   hypre_TFreeF(proj,lgmres_functions);
    hypre_TFreeF(rs,lgmres_functions);
 
    for (i=0; i < k_dim+1+aug_dim; i++)
@@ -886,6 +965,32 @@ hypre_LGMRESGetKDim( void   *lgmres_vdata,
  
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESSetCGS, hypre_LGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LGMRESSetCGS( void      *lgmres_vdata,
+                    HYPRE_Int  cgs )
+{
+   hypre_LGMRESData *lgmres_data = (hypre_LGMRESData *)lgmres_vdata;
+
+   (lgmres_data -> cgs) = cgs;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_LGMRESGetCGS( void      *lgmres_vdata,
+                    HYPRE_Int *cgs )
+{
+   hypre_LGMRESData *lgmres_data = (hypre_LGMRESData *)lgmres_vdata;
+
+   *cgs = (lgmres_data -> cgs);
+
+   return hypre_error_flag;
+}
 /*--------------------------------------------------------------------------
  * hypre_LGMRESSetAugDim
  *--------------------------------------------------------------------------*/
@@ -62,6 +62,13 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional, see hypre_LGMRESFunctionsSetMassOps */
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result );
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll );
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -74,6 +81,7 @@ typedef struct
 typedef struct
 {
    HYPRE_Int      k_dim;
+   HYPRE_Int      cgs;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -152,6 +160,23 @@ hypre_LGMRESFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+/**
+ * Sets the optional fused vector operations.  MassInnerProd computes
+ * <y[j],x> for j < k with one global sum, MassAxpy adds alpha[j]*x[j]
+ * to y for j < k, and AxpyNorm returns <y,y> after y += alpha*x.  The
+ * arrays of vectors come from CreateVectorArray.  Any of them may be NULL.
+ **/
+
+HYPRE_Int
+hypre_LGMRESFunctionsSetMassOps(
+   hypre_LGMRESFunctions *lgmres_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   );
+
 /**
  * Description...
  *
@@ -72,6 +72,38 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetMultiInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*MultiInnerProdInit) ( HYPRE_Int nprod, void **x, void **y,
+                                        HYPRE_Real *local_result, HYPRE_Real *result,
+                                        hypre_MPI_Request *request )
+   )
+{
+   pcg_functions->MultiInnerProdInit = MultiInnerProdInit;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetAxpyNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetAxpyNorm(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   )
+{
+   pcg_functions->AxpyNorm = AxpyNorm;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -99,6 +131,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -109,10 +142,44 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> z)            = NULL;
+   (pcg_data -> q)            = NULL;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyPipelinedVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGDestroyPipelinedVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vectors[6];
+   HYPRE_Int           k;
+
+   vectors[0] = &(pcg_data -> u);
+   vectors[1] = &(pcg_data -> w);
+   vectors[2] = &(pcg_data -> m);
+   vectors[3] = &(pcg_data -> n);
+   vectors[4] = &(pcg_data -> z);
+   vectors[5] = &(pcg_data -> q);
+
+   for (k = 0; k < 6; k++)
+   {
+      if ( *vectors[k] != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*vectors[k]);
+         *vectors[k] = NULL;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -155,6 +222,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyPipelinedVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -212,6 +280,9 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   /* the work vectors of the pipelined variant are created by its solve */
+   hypre_PCGDestroyPipelinedVectors(pcg_data);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -238,6 +309,299 @@ hypre_PCGSetup( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *
+ * Pipelined PCG (P. Ghysels and W. Vanroose, Parallel Computing 40, 2014).
+ * The inner products <r,u> and <w,u> of an iteration (and <r,r> for the
+ * two-norm test) are summed in one non-blocking reduction, which is
+ * overlapped with m = C*w and n = A*m; the vectors of the next iteration then
+ * follow from recurrences.  This trades two extra vector updates per
+ * iteration for a single global synchronization.  The convergence test is
+ * the default one of hypre_PCGSolve, applied to the recursively updated
+ * residual.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+   void           *u, *w, *m, *n, *z, *q;
+
+   HYPRE_Real      alpha = 0.0, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta, denom;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+
+   void           *prod_x[3];
+   void           *prod_y[3];
+   HYPRE_Real      local_prods[3];
+   HYPRE_Real      prods[3];
+   HYPRE_Int       nprod = two_norm ? 3 : 2;
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   if ( (pcg_data -> u) == NULL )
+   {
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+   }
+   u = (pcg_data -> u);
+   w = (pcg_data -> w);
+   m = (pcg_data -> m);
+   n = (pcg_data -> n);
+   z = (pcg_data -> z);
+   q = (pcg_data -> q);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<b,b>: %e\n",bi_prod);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<C*b,b>: %e\n",bi_prod);
+   };
+
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied b.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      return hypre_error_flag;
+   }
+
+   if ( bi_prod > 0.0 )
+   {
+      eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+
+      return hypre_error_flag;
+   }
+
+   /* r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   prod_x[0] = r;  prod_y[0] = u;
+   prod_x[1] = w;  prod_y[1] = u;
+   prod_x[2] = r;  prod_y[2] = r;
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      /* gamma = <r,u>, delta = <w,u> (and <r,r>), summed while m = C*w
+         and n = A*m are computed */
+      (*(pcg_functions->MultiInnerProdInit))(nprod, prod_x, prod_y,
+                                             local_prods, prods, &request);
+      if (i < max_iter)
+      {
+         (*(pcg_functions->ClearVector))(m);
+         precond(precond_data, A, w, m);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+      }
+      hypre_MPI_Wait(&request, &status);
+
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      if (i == 0)
+      {
+         if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+              hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+              hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+              hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+              hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+              hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            return hypre_error_flag;
+         }
+
+         if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod);
+      }
+      else
+      {
+         /* print norm info */
+         if ( logging>0 || print_level>0 )
+         {
+            norms[i]     = sqrt(i_prod);
+            rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+         }
+         if ( print_level > 1 && my_id==0 )
+         {
+            hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                         norms[i]/norms[i-1], rel_norms[i] );
+         }
+
+         /* check for convergence */
+         if (i_prod / bi_prod < eps)
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+
+         if (! (gamma > HYPRE_REAL_MIN) )
+         {
+            hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+            break;
+         }
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /* beta = gamma / gamma_old, alpha = gamma / <s,p> with
+         <s,p> = delta - beta * gamma / alpha_old */
+      if (i == 0)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha;
+      }
+      if ( denom==0.0 )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+      gamma_old = gamma;
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (i == 0)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      i++;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && eps > 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSolve
  *--------------------------------------------------------------------------
@@ -299,6 +663,8 @@ hypre_PCGSolve( void *pcg_vdata,
 
    HYPRE_Real      i_prod = 0.0;
    HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      r_prod = 0.0;
+   HYPRE_Int       r_prod_fused = 0;
    HYPRE_Real      cf_ave_0 = 0.0;
    HYPRE_Real      cf_ave_1 = 0.0;
    HYPRE_Real      weight;
@@ -311,6 +677,13 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   if ( (pcg_data -> pipelined) && (pcg_functions -> MultiInnerProdInit) &&
+        !rel_change && !recompute_residual && !recompute_residual_p &&
+        !stop_crit && !hybrid && rtol == 0.0 && cf_tol <= 0.0 && atolf <= 0.0 )
+   {
+      return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+   }
+
    (pcg_data -> converged) = 0;
 
    (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
@@ -514,10 +887,19 @@ hypre_PCGSolve( void *pcg_vdata,
       /* x = x + alpha*p */
       (*(pcg_functions->Axpy))(alpha, p, x);
 
-      /* r = r - alpha*s */
+      /* r = r - alpha*s, fused with <r,r> when that is needed below */
+      r_prod_fused = 0;
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->Axpy))(-alpha, s, r);
+         if (two_norm && pcg_functions->AxpyNorm)
+         {
+            r_prod = (*(pcg_functions->AxpyNorm))(-alpha, s, r);
+            r_prod_fused = 1;
+         }
+         else
+         {
+            (*(pcg_functions->Axpy))(-alpha, s, r);
+         }
       }
       else
       {
@@ -567,7 +949,9 @@ hypre_PCGSolve( void *pcg_vdata,
       }
 
       /* set i_prod for convergence test */
-      if (two_norm)
+      if (two_norm && r_prod_fused)
+         i_prod = r_prod;
+      else if (two_norm)
          i_prod = (*(pcg_functions->InnerProd))(r,r);
       else
          i_prod = gamma;
@@ -982,6 +1366,32 @@ hypre_PCGGetRecomputeResidual( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int pipelined )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int *pipelined )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetRecomputeResidualP, hypre_PCGGetRecomputeResidualP
  *--------------------------------------------------------------------------*/
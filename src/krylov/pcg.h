@@ -64,6 +64,14 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional, see hypre_PCGFunctionsSetMultiInnerProd */
+   HYPRE_Int    (*MultiInnerProdInit) ( HYPRE_Int nprod, void **x, void **y,
+                                        HYPRE_Real *local_result, HYPRE_Real *result,
+                                        hypre_MPI_Request *request );
+
+   /* optional, see hypre_PCGFunctionsSetAxpyNorm */
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -102,6 +110,11 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+ - pipelined!=0 means: use the pipelined variant (Ghysels and Vanroose), which
+ sums the inner products of an iteration in one non-blocking reduction that is
+ overlapped with the preconditioner and the matvec.  It needs the
+ MultiInnerProdInit function and falls back to the standard iteration with
+ rel_change, recompute_residual(_p), rtol, cf_tol, atolf, stop_crit or hybrid.
 */
 
 typedef struct
@@ -119,6 +132,7 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    pipelined;
 
    void    *A;
    void    *p;
@@ -126,6 +140,15 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
 
+   /* pipelined variant: u = C*r, w = A*u, m = C*w, n = A*m, and the
+      recurrences z (for A*q) and q (for C*s) */
+   void    *u;
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *z;
+   void    *q;
+
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
    void      *precond_data;
@@ -183,6 +206,31 @@ hypre_PCGFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+/**
+ * Sets the optional function computing several inner products <x[k],y[k]>
+ * with one non-blocking global sum; the sum is completed with hypre_MPI_Wait.
+ * Used by the pipelined variant.
+ **/
+
+HYPRE_Int
+hypre_PCGFunctionsSetMultiInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*MultiInnerProdInit) ( HYPRE_Int nprod, void **x, void **y,
+                                        HYPRE_Real *local_result, HYPRE_Real *result,
+                                        hypre_MPI_Request *request )
+   );
+
+/**
+ * Sets the optional function computing y += alpha*x together with <y,y>
+ * of the updated y, which saves a pass over y in the residual update.
+ **/
+
+HYPRE_Int
+hypre_PCGFunctionsSetAxpyNorm(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   );
+
 /**
  * Description...
  *
@@ -995,6 +995,17 @@ HYPRE_BoomerAMGGetNumIterations( HYPRE_Solver  solver,
    return( hypre_BoomerAMGGetNumIterations( (void *) solver, num_iterations ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetNumLevels( HYPRE_Solver  solver,
+                             HYPRE_Int    *num_levels  )
+{
+   return( hypre_BoomerAMGGetNumLevels( (void *) solver, num_levels ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGGetCumNumIterations
  *--------------------------------------------------------------------------*/
@@ -1029,6 +1040,17 @@ HYPRE_BoomerAMGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
    return( hypre_BoomerAMGGetRelResidualNorm( (void *) solver, rel_resid_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetMemorySize
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetMemorySize( HYPRE_Solver  solver,
+                              size_t       *size )
+{
+   return( hypre_BoomerAMGGetMemorySize( (void *) solver, size ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetVariant, HYPRE_BoomerAMGGetVariant
  *--------------------------------------------------------------------------*/
@@ -1634,6 +1656,17 @@ HYPRE_BoomerAMGSetChebyVariant( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetChebyVariant( (void *) solver, variant ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetGSJacobiSweeps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetGSJacobiSweeps( HYPRE_Solver  solver,
+                                  HYPRE_Int     gs_jacobi_sweeps )
+{
+   return( hypre_BoomerAMGSetGSJacobiSweeps( (void *) solver, gs_jacobi_sweeps ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetChebyEigEst
  *--------------------------------------------------------------------------*/
@@ -1851,6 +1884,85 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetStreamRAP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetStreamRAP (HYPRE_Solver solver,
+                             HYPRE_Int    stream_rap)
+{
+   return (hypre_BoomerAMGSetStreamRAP ( (void *) solver, stream_rap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision (HYPRE_Solver solver,
+                                  HYPRE_Int    mixed_precision)
+{
+   return (hypre_BoomerAMGSetMixedPrecision ( (void *) solver, mixed_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNodeCommThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNodeCommThreshold (HYPRE_Solver solver,
+                                     HYPRE_Int    node_comm_threshold)
+{
+   return (hypre_BoomerAMGSetNodeCommThreshold ( (void *) solver, node_comm_threshold ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetReuseSetup (HYPRE_Solver solver,
+                              HYPRE_Int    reuse_setup)
+{
+   return (hypre_BoomerAMGSetReuseSetup ( (void *) solver, reuse_setup ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetReuseLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetReuseLevels (HYPRE_Solver  solver,
+                               HYPRE_Int    *reuse_levels)
+{
+   return (hypre_BoomerAMGGetReuseLevels ( (void *) solver, reuse_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetLevelStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetLevelStats (HYPRE_Solver solver,
+                              HYPRE_Int    level_stats)
+{
+   return (hypre_BoomerAMGSetLevelStats ( (void *) solver, level_stats ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetLevelStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetLevelStats (HYPRE_Solver  solver,
+                              HYPRE_Int     level,
+                              HYPRE_Int     phase,
+                              HYPRE_Real   *stats)
+{
+   return (hypre_BoomerAMGGetLevelStats ( (void *) solver, level, phase, stats ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
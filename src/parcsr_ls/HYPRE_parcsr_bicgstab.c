@@ -31,6 +31,7 @@ HYPRE_ParCSRBiCGSTABCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovCommInfo,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_BiCGSTABFunctionsSetAxpyNorm(bicgstab_functions, hypre_ParKrylovAxpyNorm);
    *solver = ( (HYPRE_Solver) hypre_BiCGSTABCreate( bicgstab_functions) );
     
    return hypre_error_flag;
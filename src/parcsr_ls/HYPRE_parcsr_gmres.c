@@ -32,6 +32,13 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   /* the multi-vector kernels run on host memory only */
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_GMRESFunctionsSetMassOps(gmres_functions, NULL, NULL, hypre_ParKrylovAxpyNorm);
+#else
+   hypre_GMRESFunctionsSetMassOps(gmres_functions, hypre_ParKrylovMassInnerProd,
+                                  hypre_ParKrylovMassAxpy, hypre_ParKrylovAxpyNorm);
+#endif
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
@@ -153,6 +153,46 @@ HYPRE_ILUSetLevelOfFill( HYPRE_Solver solver, HYPRE_Int lfil )
 {
    return hypre_ILUSetLevelOfFill( solver, lfil );
 }
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetTriSolve
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve )
+{
+   return hypre_ILUSetTriSolve( solver, tri_solve );
+}
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetLowerJacobiIters
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetLowerJacobiIters( HYPRE_Solver solver, HYPRE_Int lower_jacobi_iters )
+{
+   return hypre_ILUSetLowerJacobiIters( solver, lower_jacobi_iters );
+}
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetUpperJacobiIters
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetUpperJacobiIters( HYPRE_Solver solver, HYPRE_Int upper_jacobi_iters )
+{
+   return hypre_ILUSetUpperJacobiIters( solver, upper_jacobi_iters );
+}
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetFactorSweeps
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetFactorSweeps( HYPRE_Solver solver, HYPRE_Int factor_sweeps )
+{
+   return hypre_ILUSetFactorSweeps( solver, factor_sweeps );
+}
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetBlockSize
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetBlockSize( HYPRE_Solver solver, HYPRE_Int block_size )
+{
+   return hypre_ILUSetBlockSize( solver, block_size );
+}
 /*--------------------------------------------------------------------------
  * HYPRE_ILUSetType
  *--------------------------------------------------------------------------*/
@@ -161,6 +201,14 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type )
 {
    return hypre_ILUSetType( solver, ilu_type );
 }
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetLocalReordering
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int ordering_type )
+{
+   return hypre_ILUSetLocalReordering( solver, ordering_type );
+}
 /*--------------------------------------------------------------------------
  * HYPRE_ILUGetNumIterations
  *--------------------------------------------------------------------------*/
@@ -177,3 +225,11 @@ HYPRE_ILUGetFinalRelativeResidualNorm(  HYPRE_Solver solver, HYPRE_Real *res_nor
 {
    return hypre_ILUGetFinalRelativeResidualNorm(solver, res_norm);
 }
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUGetMemorySize
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUGetMemorySize( HYPRE_Solver solver, size_t *size )
+{
+   return hypre_ILUGetMemorySize(solver, size);
+}
@@ -32,6 +32,13 @@ HYPRE_ParCSRLGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   /* the multi-vector kernels run on host memory only */
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_LGMRESFunctionsSetMassOps(lgmres_functions, NULL, NULL, hypre_ParKrylovAxpyNorm);
+#else
+   hypre_LGMRESFunctionsSetMassOps(lgmres_functions, hypre_ParKrylovMassInnerProd,
+                                   hypre_ParKrylovMassAxpy, hypre_ParKrylovAxpyNorm);
+#endif
    *solver = ( (HYPRE_Solver) hypre_LGMRESCreate( lgmres_functions ) );
 
    return hypre_error_flag;
@@ -155,12 +155,27 @@ HYPRE_Int HYPRE_BoomerAMGGetResidual(HYPRE_Solver     solver,
 HYPRE_Int HYPRE_BoomerAMGGetNumIterations(HYPRE_Solver  solver,
                                           HYPRE_Int          *num_iterations);
 
+/**
+ * Returns the number of levels of the hierarchy built by the last setup.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetNumLevels(HYPRE_Solver  solver,
+                                      HYPRE_Int    *num_levels);
+
 /**
  * Returns the norm of the final relative residual.
  **/
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
                                                       HYPRE_Real   *rel_resid_norm);
 
+/**
+ * Returns the number of bytes held by the AMG hierarchy on this process
+ * after setup (coarse operators, interpolation, level vectors and smoother
+ * data).  The fine grid matrix and vectors, which belong to the caller, are
+ * not included.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetMemorySize(HYPRE_Solver  solver,
+                                       size_t       *size);
+
 /**
  * (Optional) Sets the size of the system of PDEs, if using the systems version.
  * The default is 1, i.e. a scalar system.
@@ -882,6 +897,17 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                            HYPRE_Int   eig_est);
 
+/**
+ * (Optional) If gs_jacobi_sweeps is positive, the l1 Gauss-Seidel smoothers
+ * (relax types 8, 13 and 14) of the solve cycles replace their triangular
+ * solve by gs_jacobi_sweeps Jacobi sweeps on the triangular part of the local
+ * matrix.  The rows of a sweep are independent, so they are solved in
+ * parallel by all threads.  The relaxation weight is applied, the outer
+ * weight is not used.  The default is 0 (exact triangular solves).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetGSJacobiSweeps (HYPRE_Solver solver,
+                                            HYPRE_Int    gs_jacobi_sweeps);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1157,6 +1183,109 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If stream_rap not equal 0, the Galerkin coarse grid operators
+ * are formed row by row by a single threaded triple product that never stores
+ * A*P, which lowers the peak memory of the setup.  It replaces both the
+ * triple product and the two products selected by rap2, but not the products
+ * of the non-Galerkin and the restriction (restri_type) paths.  It is only
+ * used on the host.  Default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetStreamRAP(HYPRE_Solver solver,
+                                      HYPRE_Int    stream_rap);
+
+/**
+ * (Optional) If set to 1, the values of A on the intermediate levels
+ * (all but the finest and the coarsest) and of the interpolation and
+ * restriction operators are stored in single precision after setup,
+ * roughly halving the memory of the hierarchy.  Vectors and all
+ * arithmetic remain in double precision.  This is only applied on the host,
+ * for relax types 0, 3, 4, 6, 7, 8, 13 and 14, and without additive cycles.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                           HYPRE_Int    mixed_precision);
+
+/**
+ * (Optional) Levels whose operator exchanges messages of fewer than
+ * node\_comm\_threshold values on average (over all processes) use a
+ * node-aware halo exchange for A, P and R: the data sent to another node is
+ * first gathered within the node, sent as one message per pair of nodes and
+ * scattered on the destination node.  This reduces the number of messages on
+ * coarse levels, where they are many and small.  Exchanges with persistent
+ * requests (HYPRE\_SetPersistentComm) are not affected.  The default is 0
+ * (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNodeCommThreshold(HYPRE_Solver solver,
+                                              HYPRE_Int    node_comm_threshold);
+
+/**
+ * (Optional) If set to 1, a setup that follows a previous setup of the same
+ * solver with a matrix of the same sparsity pattern (only the values have
+ * changed, as in Newton or time stepping loops) keeps the coarse grids, the
+ * sparsity patterns of the interpolation and coarse grid operators and their
+ * communication packages.  Only the interpolation weights (extended+i
+ * formula restricted to the existing pattern) and the values of the Galerkin
+ * coarse grid operators are recomputed; smoothers and the coarse grid solver
+ * are set up again.  The sparsity pattern of the matrix is not checked.  A
+ * full setup is done for the first setup, when the row distribution changes,
+ * and with options that do not support it (interpolation other than
+ * extended+i (type 6), post-interpolation smoothing or refinement, systems
+ * and block AMG, aggressive coarsening, non-Galerkin coarse grid operators,
+ * additive cycles, restriction not equal to the transpose of the
+ * interpolation, interpolation vectors, redundant coarse grid solves, device
+ * matrices, mixed precision).  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetReuseSetup(HYPRE_Solver solver,
+                                       HYPRE_Int    reuse_setup);
+
+/**
+ * Returns the number of levels whose coarse grids and patterns the last
+ * setup has reused (see HYPRE\_BoomerAMGSetReuseSetup), or 0 if it was a
+ * full setup.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetReuseLevels(HYPRE_Solver  solver,
+                                        HYPRE_Int    *reuse_levels);
+
+/**
+ * (Optional) If level_stats is not 0, the solve cycles record a per level and
+ * per phase profile that can be queried with HYPRE\_BoomerAMGGetLevelStats.
+ * This adds two clock reads per phase and the timing of the MPI waits.
+ * The statistics accumulate over all cycles (also when BoomerAMG is used as a
+ * preconditioner) until the next setup or the next call of this function.
+ * Additive cycles are not profiled.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetLevelStats(HYPRE_Solver solver,
+                                       HYPRE_Int    level_stats);
+
+/**
+ * Returns the solve profile of phase \e phase of level \e level on this
+ * process, see HYPRE\_BoomerAMGSetLevelStats.  The options for \e phase are:
+ *
+ *    - 0 : pre-smoothing
+ *    - 1 : residual computation
+ *    - 2 : restriction
+ *    - 3 : interpolation
+ *    - 4 : post-smoothing
+ *    - 5 : coarsest grid solve
+ *
+ * The residual, restriction and interpolation between level l and l+1 are
+ * counted on level l.  On return, \e stats[0] is the wall time, \e
+ * stats[1] the flops, \e stats[2] the bytes moved through memory and \e
+ * stats[3] the time spent waiting in MPI.  Flops and bytes are model
+ * estimates: a smoothing sweep is counted as one matvec with the level
+ * matrix, whatever the smoother.
+ *
+ * @param solver [IN] solver or preconditioner
+ * @param level [IN] level, 0 is the finest
+ * @param phase [IN] phase of the cycle
+ * @param stats [OUT] array of 4 values
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetLevelStats(HYPRE_Solver  solver,
+                                       HYPRE_Int     level,
+                                       HYPRE_Int     phase,
+                                       HYPRE_Real   *stats);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2241,6 +2370,13 @@ HYPRE_Int HYPRE_ParCSRPCGSetStopCrit(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm(HYPRE_Solver solver,
                                     HYPRE_Int    two_norm);
 
+/**
+ * (Optional) Use pipelined PCG, with one non-blocking reduction per iteration
+ * overlapped with the preconditioner and the matvec; see HYPRE_PCGSetPipelined.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined(HYPRE_Solver solver,
+                                      HYPRE_Int    pipelined);
+
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange(HYPRE_Solver solver,
                                       HYPRE_Int    rel_change);
 
@@ -3834,6 +3970,7 @@ HYPRE_ILUSetSchurMaxIter( HYPRE_Solver solver, HYPRE_Int ss_max_iter );
  * Options for \e ilu_type are:
  *    - 0 : BJ with ilu(0) (default)
  *    - 1 : BJ with ilut
+ *    - 2 : BJ with iterative ilu(k), see HYPRE_ILUSetFactorSweeps
  **/
 HYPRE_Int
 HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
@@ -3844,10 +3981,68 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
  * Options for \e reordering_type are:
  *    - 0 : No reordering
  *    - 1 : RCM (default)
+ *    - 2 : Approximate minimum degree
+ *    - 3 : Nested dissection, separators ordered last
+ *
+ * RCM reduces the bandwidth of the factors, the other two reduce their fill.
+ * With nested dissection the rows on either side of a separator do not depend
+ * on each other, which helps the threaded triangular solves.
  **/
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Set the type of the triangular solves with the L and U factors
+ * of the block Jacobi ILU types (0 and 1).
+ *
+ * Options for \e tri_solve are:
+ *    - 0 : iterative, a fixed number of Jacobi sweeps on each factor (see
+ *          HYPRE_ILUSetLowerJacobiIters and HYPRE_ILUSetUpperJacobiIters);
+ *          all rows of a sweep are independent
+ *    - 1 : exact forward and backward substitution (default)
+ **/
+HYPRE_Int
+HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
+
+/**
+ * (Optional) Set the number of Jacobi sweeps for the L solve when the
+ * iterative triangular solve is used.  The solve is exact if it is at least
+ * the number of levels of L.  The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetLowerJacobiIters( HYPRE_Solver solver, HYPRE_Int lower_jacobi_iters );
+
+/**
+ * (Optional) Set the number of Jacobi sweeps for the U solve when the
+ * iterative triangular solve is used.  The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetUpperJacobiIters( HYPRE_Solver solver, HYPRE_Int upper_jacobi_iters );
+
+/**
+ * (Optional) Set the number of fixed-point sweeps of the iterative ILU(k)
+ * factorization (ilu_type 2).  Each sweep updates all nonzeros of L and U
+ * from the values of the previous sweep, so the nonzeros are computed in
+ * parallel; the factors approach the ILU(k) factors as the number of sweeps
+ * grows.  The default is 3.
+ **/
+HYPRE_Int
+HYPRE_ILUSetFactorSweeps( HYPRE_Solver solver, HYPRE_Int factor_sweeps );
+
+/**
+ * (Optional) Set the block size for a block ILU(k) factorization with ilu_type
+ * 0.  If \e block_size is larger than 1, the unknowns are taken as interleaved
+ * groups of \e block_size components (all components of a point are
+ * consecutive), and the local matrix is factored with dense block_size x
+ * block_size blocks: one index per block in L and U, and the inverses of the
+ * diagonal blocks computed in the setup.  The local ordering is an ordering
+ * of the blocks.  The number of local rows of each process must be a multiple
+ * of \e block_size, otherwise the scalar factorization is used.  The default
+ * is 1.
+ **/
+HYPRE_Int
+HYPRE_ILUSetBlockSize( HYPRE_Solver solver, HYPRE_Int block_size );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -3880,6 +4075,15 @@ HYPRE_ILUGetNumIterations( HYPRE_Solver solver, HYPRE_Int *num_iterations );
 HYPRE_Int
 HYPRE_ILUGetFinalRelativeResidualNorm(  HYPRE_Solver solver, HYPRE_Real *res_norm );
 
+/**
+ * (Optional) Return the number of bytes held by the ILU solver on this
+ * process (factors, permutations and work vectors), after setup.  The
+ * factors are counted by their number of nonzeros, so spare capacity left by
+ * the factorization is not included.
+ **/
+HYPRE_Int
+HYPRE_ILUGetMemorySize( HYPRE_Solver solver, size_t *size );
+
 /*@}*/
 
 /*--------------------------------------------------------------------------
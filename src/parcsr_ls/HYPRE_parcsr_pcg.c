@@ -31,6 +31,8 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetMultiInnerProd(pcg_functions, hypre_ParKrylovMultiInnerProdInit);
+   hypre_PCGFunctionsSetAxpyNorm(pcg_functions, hypre_ParKrylovAxpyNorm);
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -132,6 +134,17 @@ HYPRE_ParCSRPCGSetTwoNorm( HYPRE_Solver solver,
    return( HYPRE_PCGSetTwoNorm( solver, two_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetPipelined( HYPRE_Solver solver,
+                             HYPRE_Int    pipelined )
+{
+   return( HYPRE_PCGSetPipelined( solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetRelChange
  *--------------------------------------------------------------------------*/
@@ -164,6 +164,8 @@ typedef struct
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   HYPRE_Int            gs_jacobi_sweeps;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
@@ -249,6 +251,25 @@ typedef struct
    /* Use 2 mat-mat-muls instead of triple product*/
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
+   /* form the Galerkin products row by row, without storing A*P */
+   HYPRE_Int stream_rap;
+
+   /* store A, P and R values of intermediate levels in single precision */
+   HYPRE_Int mixed_precision;
+
+   /* node-aware halo exchanges on levels with smaller average messages */
+   HYPRE_Int node_comm_threshold;
+
+   /* keep the coarse grids and patterns of a previous setup */
+   HYPRE_Int reuse_setup;
+   /* number of levels whose coarse grids the last setup has reused */
+   HYPRE_Int reuse_levels;
+   /* plans of the Galerkin products, built by the first re-setup */
+   hypre_ParCSRMatMatPlan **rap_plans;
+
+   /* per level and phase profile of the solve cycles */
+   HYPRE_Int   level_stats;
+   HYPRE_Real *level_stats_data;
    HYPRE_Int modularized_matmat;
 
    /* information for preserving indices as coarse grid points */
@@ -397,6 +418,8 @@ typedef struct
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+#define hypre_ParAMGDataGSJacobiSweeps(amg_data) ((amg_data)->gs_jacobi_sweeps)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -490,6 +513,30 @@ typedef struct
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataStreamRAP(amg_data) ((amg_data)->stream_rap)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataNodeCommThreshold(amg_data) ((amg_data)->node_comm_threshold)
+#define hypre_ParAMGDataReuseSetup(amg_data) ((amg_data)->reuse_setup)
+#define hypre_ParAMGDataReuseLevels(amg_data) ((amg_data)->reuse_levels)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
+#define hypre_ParAMGDataLevelStats(amg_data) ((amg_data)->level_stats)
+#define hypre_ParAMGDataLevelStatsData(amg_data) ((amg_data)->level_stats_data)
+
+/* phases and quantities of the level statistics; the statistics of phase p
+ * on level l start at level_stats_data[(l*HYPRE_AMG_NUM_PHASES + p)*HYPRE_AMG_NUM_STATS] */
+#define HYPRE_AMG_PHASE_PRE_SMOOTH   0
+#define HYPRE_AMG_PHASE_RESIDUAL     1
+#define HYPRE_AMG_PHASE_RESTRICT     2
+#define HYPRE_AMG_PHASE_INTERPOLATE  3
+#define HYPRE_AMG_PHASE_POST_SMOOTH  4
+#define HYPRE_AMG_PHASE_COARSE_SOLVE 5
+#define HYPRE_AMG_NUM_PHASES         6
+
+#define HYPRE_AMG_STAT_WALL_TIME     0
+#define HYPRE_AMG_STAT_FLOPS         1
+#define HYPRE_AMG_STAT_BYTES         2
+#define HYPRE_AMG_STAT_MPI_WAIT      3
+#define HYPRE_AMG_NUM_STATS          4
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
 
 /*indices for the dof which will keep coarsening to the coarse level */
@@ -864,9 +911,11 @@ HYPRE_Int HYPRE_BoomerAMGSetPrintFileName ( HYPRE_Solver solver , const char *pr
 HYPRE_Int HYPRE_BoomerAMGSetDebugFlag ( HYPRE_Solver solver , HYPRE_Int debug_flag );
 HYPRE_Int HYPRE_BoomerAMGGetDebugFlag ( HYPRE_Solver solver , HYPRE_Int *debug_flag );
 HYPRE_Int HYPRE_BoomerAMGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BoomerAMGGetNumLevels ( HYPRE_Solver solver , HYPRE_Int *num_levels );
 HYPRE_Int HYPRE_BoomerAMGGetCumNumIterations ( HYPRE_Solver solver , HYPRE_Int *cum_num_iterations );
 HYPRE_Int HYPRE_BoomerAMGGetResidual ( HYPRE_Solver solver , HYPRE_ParVector *residual );
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *rel_resid_norm );
+HYPRE_Int HYPRE_BoomerAMGGetMemorySize ( HYPRE_Solver solver , size_t *size );
 HYPRE_Int HYPRE_BoomerAMGSetVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGGetVariant ( HYPRE_Solver solver , HYPRE_Int *variant );
 HYPRE_Int HYPRE_BoomerAMGSetOverlap ( HYPRE_Solver solver , HYPRE_Int overlap );
@@ -924,6 +973,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyOrder ( HYPRE_Solver solver , HYPRE_Int order )
 HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver , HYPRE_Real ratio );
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver , HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver , HYPRE_Int variant );
+HYPRE_Int HYPRE_BoomerAMGSetGSJacobiSweeps ( HYPRE_Solver solver , HYPRE_Int gs_jacobi_sweeps );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver , HYPRE_Int scale );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver , HYPRE_Int num_vectors , HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver , HYPRE_Int num );
@@ -945,6 +995,13 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver , HYPRE_Int nonga
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver , HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver , HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver , HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetStreamRAP ( HYPRE_Solver solver , HYPRE_Int stream_rap );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver , HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGSetNodeCommThreshold ( HYPRE_Solver solver , HYPRE_Int node_comm_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetReuseSetup ( HYPRE_Solver solver , HYPRE_Int reuse_setup );
+HYPRE_Int HYPRE_BoomerAMGGetReuseLevels ( HYPRE_Solver solver , HYPRE_Int *reuse_levels );
+HYPRE_Int HYPRE_BoomerAMGSetLevelStats ( HYPRE_Solver solver , HYPRE_Int level_stats );
+HYPRE_Int HYPRE_BoomerAMGGetLevelStats ( HYPRE_Solver solver , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *stats );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver , HYPRE_Int slu_threshold );
 #endif
@@ -1206,6 +1263,7 @@ HYPRE_Int HYPRE_ParCSRPCGSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol
 HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_ParCSRPCGSetStopCrit ( HYPRE_Solver solver , HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm ( HYPRE_Solver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange ( HYPRE_Solver solver , HYPRE_Int rel_change );
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
@@ -1380,9 +1438,11 @@ HYPRE_Int hypre_BoomerAMGSetDofFunc ( void *data , HYPRE_Int *dof_func );
 HYPRE_Int hypre_BoomerAMGSetPointDofMap ( void *data , HYPRE_Int *point_dof_map );
 HYPRE_Int hypre_BoomerAMGSetDofPoint ( void *data , HYPRE_Int *dof_point );
 HYPRE_Int hypre_BoomerAMGGetNumIterations ( void *data , HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BoomerAMGGetNumLevels ( void *data , HYPRE_Int *num_levels );
 HYPRE_Int hypre_BoomerAMGGetCumNumIterations ( void *data , HYPRE_Int *cum_num_iterations );
 HYPRE_Int hypre_BoomerAMGGetResidual ( void *data , hypre_ParVector **resid );
 HYPRE_Int hypre_BoomerAMGGetRelResidualNorm ( void *data , HYPRE_Real *rel_resid_norm );
+HYPRE_Int hypre_BoomerAMGGetMemorySize ( void *data , size_t *size );
 HYPRE_Int hypre_BoomerAMGSetVariant ( void *data , HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGGetVariant ( void *data , HYPRE_Int *variant );
 HYPRE_Int hypre_BoomerAMGSetOverlap ( void *data , HYPRE_Int overlap );
@@ -1406,6 +1466,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyOrder ( void *data , HYPRE_Int order );
 HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data , HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data , HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data , HYPRE_Int variant );
+HYPRE_Int hypre_BoomerAMGSetGSJacobiSweeps ( void *data , HYPRE_Int gs_jacobi_sweeps );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data , HYPRE_Int scale );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver , HYPRE_Int num_vectors , hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver , HYPRE_Int var );
@@ -1427,6 +1488,12 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data , HYPRE_Int nongalerk_num_
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data , HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data , HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data , HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetStreamRAP ( void *data , HYPRE_Int stream_rap );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data , HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGSetNodeCommThreshold ( void *data , HYPRE_Int node_comm_threshold );
+HYPRE_Int hypre_BoomerAMGSetReuseSetup ( void *data , HYPRE_Int reuse_setup );
+HYPRE_Int hypre_BoomerAMGGetReuseLevels ( void *data , HYPRE_Int *reuse_levels );
+HYPRE_Int hypre_BoomerAMGSetLevelStats ( void *data , HYPRE_Int level_stats );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data , HYPRE_Int slu_threshold );
 #endif
@@ -1436,6 +1503,21 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGReuseSetupLevels ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGReuseInterp ( hypre_ParCSRMatrix *A , HYPRE_Int *CF_marker , hypre_ParCSRMatrix *P );
+HYPRE_Int hypre_BoomerAMGReuseCoarseOperator ( void *amg_vdata , HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGReuseDestroyPlans ( void *amg_vdata );
+
+/* par_amg_level_stats.c */
+HYPRE_Int hypre_BoomerAMGLevelStatsMatvecCost ( hypre_ParCSRMatrix *A , hypre_ParCSRBlockMatrix *A_block , HYPRE_Real *cost );
+HYPRE_Int hypre_BoomerAMGLevelStatsRelaxCost ( void *amg_vdata , HYPRE_Int level , HYPRE_Int relax_type , HYPRE_Real *cost );
+HYPRE_Int hypre_BoomerAMGLevelStatsStart ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGLevelStatsStop ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGLevelStatsBegin ( HYPRE_Real *mark );
+HYPRE_Int hypre_BoomerAMGLevelStatsEnd ( void *amg_vdata , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *mark , HYPRE_Real *cost );
+HYPRE_Int hypre_BoomerAMGGetLevelStats ( void *data , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *stats );
+
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
@@ -1592,6 +1674,8 @@ HYPRE_Int hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RA
 
 /* par_rap.c */
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorSymbolic ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , HYPRE_Int keepTranspose , hypre_ParCSRMatrix **RAP_ptr , hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorNumeric ( hypre_ParCSRMatMatPlan *plan , hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
@@ -1603,6 +1687,9 @@ HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HY
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 
+/* par_relax_float.c */
+HYPRE_Int hypre_BoomerAMGRelaxFloat ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
 
@@ -1615,6 +1702,7 @@ HYPRE_Int hypre_ParCSRRelax_CG ( HYPRE_Solver solver , hypre_ParCSRMatrix *A , h
 HYPRE_Int hypre_LINPACKcgtql1 ( HYPRE_Int *n , HYPRE_Real *d , HYPRE_Real *e , HYPRE_Int *ierr );
 HYPRE_Real hypre_LINPACKcgpthy ( HYPRE_Real *a , HYPRE_Real *b );
 HYPRE_Int hypre_ParCSRRelax_L1_Jacobi ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
+HYPRE_Int hypre_BoomerAMGRelaxTwoStageGaussSeidel ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , HYPRE_Int num_sweeps , hypre_ParVector *u , hypre_ParVector *Vtemp );
 
 /* par_rotate_7pt.c */
 HYPRE_ParCSRMatrix GenerateRotate7pt ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int p , HYPRE_Int q , HYPRE_Real alpha , HYPRE_Real eps );
@@ -1705,9 +1793,11 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovMultiInnerProdInit ( HYPRE_Int nprod , void **x , void **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
+HYPRE_Real hypre_ParKrylovAxpyNorm ( HYPRE_Complex alpha , void *x , void *y );
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -1842,6 +1932,11 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
+HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
+HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
+HYPRE_Int hypre_ILUSetFactorSweeps( void *ilu_vdata, HYPRE_Int factor_sweeps );
+HYPRE_Int hypre_ILUSetBlockSize( void *ilu_vdata, HYPRE_Int block_size );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -1877,23 +1972,30 @@ HYPRE_Int hypre_ILUGetPermddPQPre(HYPRE_Int n, HYPRE_Int nLU, HYPRE_Int *A_diag_
 HYPRE_Int hypre_ILUGetPermddPQ(hypre_ParCSRMatrix *A, HYPRE_Int **pperm, HYPRE_Int **qperm, HYPRE_Real tol, HYPRE_Int *nB, HYPRE_Int *nI, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
+HYPRE_Int hypre_ILUGetLocalBlockPerm(hypre_ParCSRBlockMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUWriteSolverParams(void *ilu_vdata);
 HYPRE_Int hypre_ILUBuildRASExternalMatrix(hypre_ParCSRMatrix *A, HYPRE_Int *rperm, HYPRE_Int **E_i, HYPRE_Int **E_j, HYPRE_Real **E_data);
+HYPRE_Int hypre_ILUSetupLevelSchedule(hypre_CSRMatrix *T, HYPRE_Int lower, HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr, HYPRE_Int **level_rows_ptr);
 HYPRE_Int hypre_ILUSetupILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUKSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j, HYPRE_Int **S_diag_j, HYPRE_Int **u_end);
+HYPRE_Int hypre_ILUSetupParILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int num_sweeps, HYPRE_Int *perm, HYPRE_Int *qperm, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, HYPRE_Int **u_end);
+HYPRE_Int hypre_ILUSetupBlockILUK(hypre_ParCSRBlockMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, hypre_ParCSRBlockMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRBlockMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUT(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILU0RAS(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUKRASSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i, HYPRE_Int *A_offd_j, HYPRE_Int *E_i, HYPRE_Int *E_j, HYPRE_Int ext, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j);
 HYPRE_Int hypre_ILUSetupILUKRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
-HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp);
+HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp, HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
+HYPRE_Int hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, hypre_ParVector *xtemp, HYPRE_Int lower_jacobi_iters, HYPRE_Int upper_jacobi_iters);
+HYPRE_Int hypre_ILUSolveBlockLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRBlockMatrix *L, HYPRE_Real* D, hypre_ParCSRBlockMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
 HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
-HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
+HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext, HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
 HYPRE_Int hypre_ILUSetSchurNSHDropThreshold( void *ilu_vdata, HYPRE_Real threshold);
 HYPRE_Int hypre_ILUSetSchurNSHDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold);
 HYPRE_Int hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end, HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym);
+HYPRE_Int hypre_ILULocalReordering( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end, HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILULocalRCMNumbering(hypre_CSRMatrix *A, HYPRE_Int root, HYPRE_Int *marker, HYPRE_Int *perm, HYPRE_Int *current_nump);
 HYPRE_Int hypre_ILULocalRCMFindPPNode( hypre_CSRMatrix *A, HYPRE_Int *rootp, HYPRE_Int *marker);
 HYPRE_Int hypre_ILULocalRCMMindegree(HYPRE_Int n, HYPRE_Int *degree, HYPRE_Int *marker, HYPRE_Int *rootp);
@@ -1901,6 +2003,9 @@ HYPRE_Int hypre_ILULocalRCMOrder( hypre_CSRMatrix *A, HYPRE_Int *perm);
 HYPRE_Int hypre_ILULocalRCMBuildLevel(hypre_CSRMatrix *A, HYPRE_Int root, HYPRE_Int *marker, HYPRE_Int *level_i, HYPRE_Int *level_j, HYPRE_Int *nlevp);
 HYPRE_Int hypre_ILULocalRCMQsort(HYPRE_Int *perm, HYPRE_Int start, HYPRE_Int end, HYPRE_Int *degree);
 HYPRE_Int hypre_ILULocalRCMReverse(HYPRE_Int *perm, HYPRE_Int start, HYPRE_Int end);
+HYPRE_Int hypre_ILULocalAMDOrder( hypre_CSRMatrix *A, HYPRE_Int *perm);
+HYPRE_Int hypre_ILULocalNDOrder( hypre_CSRMatrix *A, HYPRE_Int *perm);
+HYPRE_Int hypre_ILULocalNDBuildLevel(hypre_CSRMatrix *A, HYPRE_Int root, HYPRE_Int lo, HYPRE_Int hi, HYPRE_Int *part, HYPRE_Int *perm, HYPRE_Int *level, HYPRE_Int *queue, HYPRE_Int *nreachp, HYPRE_Int *nlevp);
 // Newton-Schultz-Hotelling (NSH) functions
 void * hypre_NSHCreate();
 HYPRE_Int hypre_NSHDestroy( void *data );
@@ -1936,6 +2041,7 @@ HYPRE_Int hypre_NSHSolveInverse(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre
 // Accessor functions
 HYPRE_Int hypre_ILUGetNumIterations( void *ilu_vdata, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_ILUGetFinalRelativeResidualNorm( void *ilu_vdata, HYPRE_Real *res_norm );
+HYPRE_Int hypre_ILUGetMemorySize( void *ilu_vdata, size_t *size );
 #ifdef __cplusplus
 }
 #endif
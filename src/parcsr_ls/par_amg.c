@@ -103,6 +103,8 @@ hypre_BoomerAMGCreate()
    HYPRE_Int cheby_scale;
    HYPRE_Real cheby_eig_ratio;
 
+   HYPRE_Int gs_jacobi_sweeps;
+
    HYPRE_Int block_mode;
 
    HYPRE_Int    additive;
@@ -216,6 +218,8 @@ hypre_BoomerAMGCreate()
    cheby_eig_est = 10;
    cheby_eig_ratio = .3;
 
+   gs_jacobi_sweeps = 0;
+
    block_mode = 0;
 
    additive = -1;
@@ -332,6 +336,8 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
 
+   hypre_BoomerAMGSetGSJacobiSweeps(amg_data, gs_jacobi_sweeps);
+
    hypre_BoomerAMGSetNumIterations(amg_data, num_iterations);
 
    hypre_BoomerAMGSetAdditive(amg_data, additive);
@@ -441,6 +447,14 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataKeepTranspose(amg_data)     = 0;
    hypre_ParAMGDataModularizedMatMat(amg_data) = 0;
 #endif
+   hypre_ParAMGDataStreamRAP(amg_data)         = 0;
+   hypre_ParAMGDataMixedPrecision(amg_data)    = 0;
+   hypre_ParAMGDataNodeCommThreshold(amg_data) = 0;
+   hypre_ParAMGDataReuseSetup(amg_data)        = 0;
+   hypre_ParAMGDataReuseLevels(amg_data)       = 0;
+   hypre_ParAMGDataRAPPlans(amg_data)          = NULL;
+   hypre_ParAMGDataLevelStats(amg_data)        = 0;
+   hypre_ParAMGDataLevelStatsData(amg_data)    = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -647,6 +661,8 @@ hypre_BoomerAMGDestroy( void *data )
    hypre_TFree(hypre_ParAMGDataPBlockArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataPArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data), HYPRE_MEMORY_HOST);
+   hypre_BoomerAMGReuseDestroyPlans(amg_data);
+   hypre_TFree(hypre_ParAMGDataLevelStatsData(amg_data), HYPRE_MEMORY_HOST);
 
    if (hypre_ParAMGDataRtemp(amg_data))
       hypre_ParVectorDestroy(hypre_ParAMGDataRtemp(amg_data));
@@ -3604,6 +3620,22 @@ hypre_BoomerAMGGetNumIterations( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGGetNumLevels( void      *data,
+                             HYPRE_Int *num_levels )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *num_levels = hypre_ParAMGDataNumLevels(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGGetCumNumIterations( void     *data,
                                     HYPRE_Int      *cum_num_iterations )
@@ -3652,6 +3684,131 @@ hypre_BoomerAMGGetRelResidualNorm( void     *data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGGetMemorySize
+ *
+ * Bytes held by the AMG hierarchy on this process: the coarse operators,
+ * interpolation and restriction, level vectors and markers, smoother data and
+ * the coarse grid solver.  The fine grid matrix and vectors belong to the
+ * user and are not included, nor are the block (nodal) matrices and the
+ * Pilut, ParaSails, Euclid and Schwarz smoothers.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetMemorySize( void     *data,
+                              size_t   *size )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) data;
+   hypre_ParCSRMatrix **A_array;
+   HYPRE_Int            num_levels, smooth_type, level;
+   size_t               n, smoother_size;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *size      = sizeof(hypre_ParAMGData);
+   A_array    = hypre_ParAMGDataAArray(amg_data);
+   num_levels = A_array ? hypre_ParAMGDataNumLevels(amg_data) : 0;
+
+   for (level = 0; level < num_levels; level++)
+   {
+      n = A_array[level] ? (size_t) hypre_ParCSRMatrixNumRows(A_array[level]) : 0;
+
+      if (level > 0)
+      {
+         *size += hypre_ParCSRMatrixMemorySize(A_array[level]);
+         *size += hypre_ParVectorMemorySize(hypre_ParAMGDataFArray(amg_data)[level]);
+         *size += hypre_ParVectorMemorySize(hypre_ParAMGDataUArray(amg_data)[level]);
+         if (hypre_ParAMGDataDofFuncArray(amg_data) &&
+             hypre_ParAMGDataDofFuncArray(amg_data)[level])
+         {
+            *size += sizeof(HYPRE_Int) * n;
+         }
+      }
+      if (level < num_levels - 1 || num_levels == 1)
+      {
+         if (hypre_ParAMGDataCFMarkerArray(amg_data)[level])
+         {
+            *size += sizeof(HYPRE_Int) * n;
+         }
+      }
+      if (level < num_levels - 1)
+      {
+         *size += hypre_ParCSRMatrixMemorySize(hypre_ParAMGDataPArray(amg_data)[level]);
+         if (hypre_ParAMGDataRestriction(amg_data))
+         {
+            *size += hypre_ParCSRMatrixMemorySize(hypre_ParAMGDataRArray(amg_data)[level]);
+         }
+         if (hypre_ParAMGDataRAPPlans(amg_data) && hypre_ParAMGDataRAPPlans(amg_data)[level])
+         {
+            *size += hypre_ParCSRMatrixMemorySize(
+                        hypre_ParCSRMatMatPlanInnerMatrix(hypre_ParAMGDataRAPPlans(amg_data)[level]));
+         }
+      }
+      if (hypre_ParAMGDataL1Norms(amg_data))
+      {
+         *size += hypre_SeqVectorMemorySize(hypre_ParAMGDataL1Norms(amg_data)[level]);
+      }
+      if (hypre_ParAMGDataChebyDS(amg_data) && hypre_ParAMGDataChebyDS(amg_data)[level])
+      {
+         *size += sizeof(HYPRE_Real) * n;
+      }
+      if (hypre_ParAMGDataChebyCoefs(amg_data) && hypre_ParAMGDataChebyCoefs(amg_data)[level])
+      {
+         *size += sizeof(HYPRE_Real) * (hypre_ParAMGDataChebyOrder(amg_data) + 1);
+      }
+   }
+
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataVtemp(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataRtemp(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataPtemp(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataZtemp(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataResidual(amg_data));
+
+   /* additive cycles */
+   *size += hypre_ParCSRMatrixMemorySize(hypre_ParAMGDataLambda(amg_data));
+   if (hypre_ParAMGDataAtilde(amg_data))
+   {
+      hypre_ParCSRMatrix *Atilde = hypre_ParAMGDataAtilde(amg_data);
+      *size += sizeof(hypre_ParCSRMatrix);
+      *size += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixDiag(Atilde));
+      *size += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixOffd(Atilde));
+   }
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataXtilde(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataRtilde(amg_data));
+
+   /* ILU smoothers */
+   smooth_type = hypre_ParAMGDataSmoothType(amg_data);
+   if (smooth_type == 5 || smooth_type == 15)
+   {
+      for (level = 0; level < hypre_ParAMGDataSmoothNumLevels(amg_data); level++)
+      {
+         if (hypre_ParAMGDataSmoother(amg_data)[level])
+         {
+            hypre_ILUGetMemorySize(hypre_ParAMGDataSmoother(amg_data)[level], &smoother_size);
+            *size += smoother_size;
+         }
+      }
+   }
+
+   /* redundant coarse grid solve */
+   if (hypre_ParAMGDataCoarseSolver(amg_data))
+   {
+      size_t coarse_size;
+
+      hypre_BoomerAMGGetMemorySize(hypre_ParAMGDataCoarseSolver(amg_data), &coarse_size);
+      *size += coarse_size;
+   }
+   *size += hypre_ParCSRMatrixMemorySize(hypre_ParAMGDataACoarse(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataUCoarse(amg_data));
+   *size += hypre_ParVectorMemorySize(hypre_ParAMGDataFCoarse(amg_data));
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetVariant( void     *data,
                             HYPRE_Int       variant)
@@ -4065,6 +4222,26 @@ hypre_BoomerAMGSetChebyScale( void     *data,
 
    return hypre_error_flag;
 }
+HYPRE_Int
+hypre_BoomerAMGSetGSJacobiSweeps( void     *data,
+                                  HYPRE_Int gs_jacobi_sweeps)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (gs_jacobi_sweeps < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataGSJacobiSweeps(amg_data) = gs_jacobi_sweeps;
+
+   return hypre_error_flag;
+}
 
 
 /*--------------------------------------------------------------------------
@@ -4454,6 +4631,98 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetStreamRAP( void       *data,
+                             HYPRE_Int   stream_rap)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  hypre_ParAMGDataStreamRAP(amg_data) = stream_rap;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void       *data,
+                                  HYPRE_Int   mixed_precision)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetNodeCommThreshold( void       *data,
+                                     HYPRE_Int   node_comm_threshold)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataNodeCommThreshold(amg_data) = node_comm_threshold;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetReuseSetup( void       *data,
+                              HYPRE_Int   reuse_setup)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataReuseSetup(amg_data) = reuse_setup;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetReuseLevels( void       *data,
+                               HYPRE_Int  *reuse_levels)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  *reuse_levels = hypre_ParAMGDataReuseLevels(amg_data);
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetLevelStats( void       *data,
+                              HYPRE_Int   level_stats)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  /* setting it again starts a new count */
+  hypre_ParAMGDataLevelStats(amg_data) = level_stats;
+  hypre_TFree(hypre_ParAMGDataLevelStatsData(amg_data), HYPRE_MEMORY_HOST);
+  return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
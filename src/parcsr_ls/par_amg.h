@@ -142,6 +142,8 @@ typedef struct
    HYPRE_Real        **cheby_ds;
    HYPRE_Real        **cheby_coefs;
 
+   HYPRE_Int           gs_jacobi_sweeps;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
@@ -226,6 +228,25 @@ typedef struct
    /* Use 2 mat-mat-muls instead of triple product*/
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
+   /* form the Galerkin products row by row, without storing A*P */
+   HYPRE_Int stream_rap;
+
+   /* store A, P and R values of intermediate levels in single precision */
+   HYPRE_Int mixed_precision;
+
+   /* node-aware halo exchanges on levels with smaller average messages */
+   HYPRE_Int node_comm_threshold;
+
+   /* keep the coarse grids and patterns of a previous setup */
+   HYPRE_Int reuse_setup;
+   /* number of levels whose coarse grids the last setup has reused */
+   HYPRE_Int reuse_levels;
+   /* plans of the Galerkin products, built by the first re-setup */
+   hypre_ParCSRMatMatPlan **rap_plans;
+
+   /* per level and phase profile of the solve cycles */
+   HYPRE_Int   level_stats;
+   HYPRE_Real *level_stats_data;
 
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
@@ -370,6 +391,8 @@ typedef struct
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+#define hypre_ParAMGDataGSJacobiSweeps(amg_data) ((amg_data)->gs_jacobi_sweeps)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -461,6 +484,30 @@ typedef struct
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataStreamRAP(amg_data) ((amg_data)->stream_rap)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataNodeCommThreshold(amg_data) ((amg_data)->node_comm_threshold)
+#define hypre_ParAMGDataReuseSetup(amg_data) ((amg_data)->reuse_setup)
+#define hypre_ParAMGDataReuseLevels(amg_data) ((amg_data)->reuse_levels)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
+#define hypre_ParAMGDataLevelStats(amg_data) ((amg_data)->level_stats)
+#define hypre_ParAMGDataLevelStatsData(amg_data) ((amg_data)->level_stats_data)
+
+/* phases and quantities of the level statistics; the statistics of phase p
+ * on level l start at level_stats_data[(l*HYPRE_AMG_NUM_PHASES + p)*HYPRE_AMG_NUM_STATS] */
+#define HYPRE_AMG_PHASE_PRE_SMOOTH   0
+#define HYPRE_AMG_PHASE_RESIDUAL     1
+#define HYPRE_AMG_PHASE_RESTRICT     2
+#define HYPRE_AMG_PHASE_INTERPOLATE  3
+#define HYPRE_AMG_PHASE_POST_SMOOTH  4
+#define HYPRE_AMG_PHASE_COARSE_SOLVE 5
+#define HYPRE_AMG_NUM_PHASES         6
+
+#define HYPRE_AMG_STAT_WALL_TIME     0
+#define HYPRE_AMG_STAT_FLOPS         1
+#define HYPRE_AMG_STAT_BYTES         2
+#define HYPRE_AMG_STAT_MPI_WAIT      3
+#define HYPRE_AMG_NUM_STATS          4
 
 /* indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
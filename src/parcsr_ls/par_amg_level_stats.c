@@ -0,0 +1,244 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Per level profile of the BoomerAMG solve cycles (see
+ * HYPRE_BoomerAMGSetLevelStats).  For every level and phase of
+ * hypre_BoomerAMGCycle the wall time, the time spent waiting in MPI and
+ * model estimates of the flops and the bytes moved through memory are
+ * accumulated.  The transfers between level l and level l+1 (residual,
+ * restriction and interpolation) are counted on level l.
+ *
+ * The model assumes that a CSR matvec reads the values, column indices and
+ * row pointers once, reads the input vector once and reads and writes the
+ * output vector; a smoothing sweep costs one matvec with the level matrix and
+ * a Gaussian elimination coarse solve costs 2 n^2 flops.  Smoothers with a
+ * different cost (polynomials, ILU, Schwarz, ...) are counted as one matvec
+ * per sweep, and coarse solves by a separate solver only record time.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "../parcsr_block_mv/par_csr_block_matrix.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelStatsCSRCost
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGLevelStatsCSRCost( HYPRE_Int   num_nonzeros,
+                                  HYPRE_Int   num_rows,
+                                  HYPRE_Int   num_cols,
+                                  HYPRE_Int   block_size,
+                                  HYPRE_Real *cost )
+{
+   HYPRE_Real nnz = (HYPRE_Real) num_nonzeros;
+   HYPRE_Real bs  = (HYPRE_Real) block_size;
+
+   cost[0] += 2.0 * nnz * bs * bs;
+   cost[1] += nnz * (bs * bs * sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+              (HYPRE_Real) (num_rows + 1) * sizeof(HYPRE_Int) +
+              (HYPRE_Real) num_cols * bs * sizeof(HYPRE_Complex) +
+              2.0 * (HYPRE_Real) num_rows * bs * sizeof(HYPRE_Complex);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelStatsMatvecCost
+ *
+ * Adds the flops (cost[0]) and bytes (cost[1]) of a local matvec with A, or
+ * with A_block if it is not NULL.  The transpose matvec has the same cost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGLevelStatsMatvecCost( hypre_ParCSRMatrix      *A,
+                                     hypre_ParCSRBlockMatrix *A_block,
+                                     HYPRE_Real              *cost )
+{
+   if (A_block)
+   {
+      hypre_CSRBlockMatrix *diag = hypre_ParCSRBlockMatrixDiag(A_block);
+      hypre_CSRBlockMatrix *offd = hypre_ParCSRBlockMatrixOffd(A_block);
+
+      hypre_BoomerAMGLevelStatsCSRCost(hypre_CSRBlockMatrixNumNonzeros(diag),
+                                       hypre_CSRBlockMatrixNumRows(diag),
+                                       hypre_CSRBlockMatrixNumCols(diag),
+                                       hypre_CSRBlockMatrixBlockSize(diag), cost);
+      hypre_BoomerAMGLevelStatsCSRCost(hypre_CSRBlockMatrixNumNonzeros(offd), 0,
+                                       hypre_CSRBlockMatrixNumCols(offd),
+                                       hypre_CSRBlockMatrixBlockSize(offd), cost);
+   }
+   else if (A)
+   {
+      hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+      hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+      hypre_BoomerAMGLevelStatsCSRCost(hypre_CSRMatrixNumNonzeros(diag),
+                                       hypre_CSRMatrixNumRows(diag),
+                                       hypre_CSRMatrixNumCols(diag), 1, cost);
+      hypre_BoomerAMGLevelStatsCSRCost(hypre_CSRMatrixNumNonzeros(offd), 0,
+                                       hypre_CSRMatrixNumCols(offd), 1, cost);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelStatsRelaxCost
+ *
+ * Adds the cost of one sweep of relax_type on the given level.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGLevelStatsRelaxCost( void       *amg_vdata,
+                                    HYPRE_Int   level,
+                                    HYPRE_Int   relax_type,
+                                    HYPRE_Real *cost )
+{
+   hypre_ParAMGData         *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix       *A        = NULL;
+   hypre_ParCSRBlockMatrix  *A_block  = NULL;
+   HYPRE_Real                n;
+
+   if (hypre_ParAMGDataBlockMode(amg_data))
+   {
+      A_block = hypre_ParAMGDataABlockArray(amg_data)[level];
+   }
+   else
+   {
+      A = hypre_ParAMGDataAArray(amg_data)[level];
+   }
+
+   if (A && (relax_type == 9 || relax_type == 99 || relax_type == 199))
+   {
+      /* every process solves the gathered coarse system */
+      n = (HYPRE_Real) hypre_ParCSRMatrixGlobalNumRows(A);
+      cost[0] += 2.0 * n * n;
+      cost[1] += n * n * sizeof(HYPRE_Real);
+   }
+   else
+   {
+      hypre_BoomerAMGLevelStatsMatvecCost(A, A_block, cost);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelStatsStart, hypre_BoomerAMGLevelStatsStop
+ *
+ * Called around the cycles of a solve.  Start allocates the statistics of
+ * the current hierarchy if needed and turns the timing of the MPI waits on;
+ * Stop turns it off again.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGLevelStatsStart( void *amg_vdata )
+{
+   hypre_ParAMGData *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         num_levels = hypre_ParAMGDataNumLevels(amg_data);
+
+   if (!hypre_ParAMGDataLevelStatsData(amg_data))
+   {
+      hypre_ParAMGDataLevelStatsData(amg_data) =
+         hypre_CTAlloc(HYPRE_Real, num_levels * HYPRE_AMG_NUM_PHASES * HYPRE_AMG_NUM_STATS,
+                       HYPRE_MEMORY_HOST);
+   }
+   hypre_MPIWaitTiming++;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGLevelStatsStop( void *amg_vdata )
+{
+   hypre_MPIWaitTiming--;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelStatsBegin, hypre_BoomerAMGLevelStatsEnd
+ *
+ * Begin records the wall clock and the MPI wait time in mark[0:1].  End
+ * adds the time since Begin, and the flops and bytes in cost[0:1], to the
+ * statistics of the given level and phase.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGLevelStatsBegin( HYPRE_Real *mark )
+{
+   mark[0] = hypre_MPI_Wtime();
+   mark[1] = hypre_MPIWaitTime;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGLevelStatsEnd( void       *amg_vdata,
+                              HYPRE_Int   level,
+                              HYPRE_Int   phase,
+                              HYPRE_Real *mark,
+                              HYPRE_Real *cost )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Real       *stats    = hypre_ParAMGDataLevelStatsData(amg_data);
+
+   stats += (level * HYPRE_AMG_NUM_PHASES + phase) * HYPRE_AMG_NUM_STATS;
+
+   stats[HYPRE_AMG_STAT_WALL_TIME] += hypre_MPI_Wtime() - mark[0];
+   stats[HYPRE_AMG_STAT_FLOPS]     += cost[0];
+   stats[HYPRE_AMG_STAT_BYTES]     += cost[1];
+   stats[HYPRE_AMG_STAT_MPI_WAIT]  += hypre_MPIWaitTime - mark[1];
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGGetLevelStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetLevelStats( void       *data,
+                              HYPRE_Int   level,
+                              HYPRE_Int   phase,
+                              HYPRE_Real *stats )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+   HYPRE_Real       *level_stats_data;
+   HYPRE_Int         i;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (level < 0 || level >= hypre_ParAMGDataNumLevels(amg_data))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (phase < 0 || phase >= HYPRE_AMG_NUM_PHASES)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   if (!stats)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   level_stats_data = hypre_ParAMGDataLevelStatsData(amg_data);
+   for (i = 0; i < HYPRE_AMG_NUM_STATS; i++)
+   {
+      stats[i] = level_stats_data ?
+         level_stats_data[(level * HYPRE_AMG_NUM_PHASES + phase) * HYPRE_AMG_NUM_STATS + i] : 0.0;
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,737 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Re-setup of BoomerAMG for a matrix whose sparsity pattern has not changed
+ * since the previous setup (see HYPRE_BoomerAMGSetReuseSetup).  The CF
+ * splittings, the patterns of P and of the coarse grid operators and their
+ * communication packages are kept; only the interpolation weights and the
+ * Galerkin values are recomputed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseDropCopies
+ *
+ * Frees the SELL and single precision copies of the values of a matrix
+ * whose values are about to change.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGReuseDropCopies( hypre_CSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      return;
+   }
+
+   if (hypre_CSRMatrixSell(matrix))
+   {
+      hypre_SELLMatrixDestroy(hypre_CSRMatrixSell(matrix));
+      hypre_CSRMatrixSell(matrix) = NULL;
+   }
+   if (hypre_CSRMatrixDataFloat(matrix))
+   {
+      hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDataFloat(matrix) = NULL;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseHasValues
+ *
+ * Whether the values of a matrix are still available in double precision.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGReuseHasValues( hypre_ParCSRMatrix *matrix )
+{
+   hypre_CSRMatrix *diag, *offd;
+
+   if (!matrix)
+   {
+      return 0;
+   }
+
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+
+   if (hypre_CSRMatrixNumNonzeros(diag) && !hypre_CSRMatrixData(diag))
+   {
+      return 0;
+   }
+   if (hypre_CSRMatrixNumNonzeros(offd) && !hypre_CSRMatrixData(offd))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseSetupLevels
+ *
+ * Returns the number of levels of the previous hierarchy that a setup with
+ * matrix A can reuse, or 0 if a full setup is needed: re-setup is off, there
+ * is no previous hierarchy, the row distribution of A is different, or the
+ * previous hierarchy was built with options that the re-setup does not
+ * support (block and systems AMG, non-Galerkin coarse operators, additive
+ * cycles, R != P^T, interpolation vectors, redundant coarse solves, device
+ * matrices, values stored in single precision only).  The weights of P are
+ * rebuilt as extended+i weights (see hypre_BoomerAMGReuseInterp), so the
+ * hierarchy must have been built with interp_type 6, without
+ * post-interpolation smoothing (post_interp_type 0) and without refinement of
+ * the interpolation (interp_refine 0).  Aggressive coarsening is not
+ * supported either: its long range interpolation cannot be rebuilt from the
+ * couplings of distance one and two used below.
+ *
+ * The sparsity pattern of A itself is not checked; it is the caller's
+ * promise that only its values have changed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseSetupLevels( void               *amg_vdata,
+                                 hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData     *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int             num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array         = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int           **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int             coarse_threshold = hypre_ParAMGDataMaxCoarseSize(amg_data);
+   HYPRE_Int             num_procs;
+   HYPRE_Int             level, reuse, reuse_all;
+
+   if (!hypre_ParAMGDataReuseSetup(amg_data) || num_levels < 2 ||
+       !A_array || !P_array || !CF_marker_array)
+   {
+      return 0;
+   }
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+
+   reuse = hypre_ParAMGDataBlockMode(amg_data) == 0 &&
+           hypre_ParAMGDataRestriction(amg_data) == 0 &&
+           hypre_ParAMGDataNumFunctions(amg_data) == 1 &&
+           hypre_ParAMGDataInterpType(amg_data) == 6 &&
+           hypre_ParAMGDataPostInterpType(amg_data) == 0 &&
+           hypre_ParAMGInterpRefine(amg_data) == 0 &&
+           hypre_ParAMGDataAggNumLevels(amg_data) == 0 &&
+           hypre_ParAMGDataAdditive(amg_data) < 0 &&
+           hypre_ParAMGDataMultAdditive(amg_data) < 0 &&
+           hypre_ParAMGDataSimple(amg_data) < 0 &&
+           hypre_ParAMGInterpVecVariant(amg_data) <= 0 &&
+           hypre_ParAMGDataNonGalerkNumTol(amg_data) == 0 &&
+           hypre_ParAMGDataNonGalerkinTol(amg_data) == 0.0 &&
+           hypre_ParAMGDataNonGalTolArray(amg_data) == NULL &&
+           (num_procs == 1 || hypre_ParAMGDataSeqThreshold(amg_data) < coarse_threshold) &&
+           hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_HOST &&
+           hypre_BoomerAMGReuseHasValues(A);
+#ifdef HYPRE_USING_DSUPERLU
+   reuse = reuse && (num_procs == 1 || hypre_ParAMGDataDSLUThreshold(amg_data) < coarse_threshold);
+#endif
+
+   if (reuse && P_array[0])
+   {
+      reuse = hypre_ParCSRMatrixGlobalNumRows(P_array[0]) == hypre_ParCSRMatrixGlobalNumRows(A) &&
+              hypre_ParCSRMatrixNumRows(P_array[0]) == hypre_ParCSRMatrixNumRows(A);
+   }
+
+   for (level = 0; reuse && level < num_levels-1; level++)
+   {
+      reuse = CF_marker_array[level] != NULL &&
+              hypre_BoomerAMGReuseHasValues(P_array[level]) &&
+              hypre_BoomerAMGReuseHasValues(A_array[level+1]);
+   }
+
+   hypre_MPI_Allreduce(&reuse, &reuse_all, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return reuse_all ? num_levels : 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseUnique
+ *
+ * Sorts list and removes its duplicates; returns the new length.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGReuseUnique( HYPRE_BigInt *list,
+                            HYPRE_Int     length )
+{
+   HYPRE_Int i, k;
+
+   if (length < 2)
+   {
+      return length;
+   }
+
+   hypre_BigQsort0(list, 0, length - 1);
+   k = 1;
+   for (i = 1; i < length; i++)
+   {
+      if (list[i] != list[k-1])
+      {
+         list[k++] = list[i];
+      }
+   }
+
+   return k;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseCode
+ *
+ * Index of the global index J in a local index space made of the n_local
+ * indices starting at first, followed by the (sorted) off-processor indices
+ * in col_map.  -1 if J is not in it.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_BoomerAMGReuseCode( HYPRE_BigInt  J,
+                          HYPRE_BigInt  first,
+                          HYPRE_Int     n_local,
+                          HYPRE_BigInt *col_map,
+                          HYPRE_Int     num_cols )
+{
+   HYPRE_Int k;
+
+   if (J >= first && J < first + (HYPRE_BigInt) n_local)
+   {
+      return (HYPRE_Int) (J - first);
+   }
+
+   k = hypre_BigBinarySearch(col_map, J, num_cols);
+
+   return k < 0 ? -1 : n_local + k;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseInterpSum, hypre_BoomerAMGReuseInterpDistribute
+ *
+ * Sum of the entries of a segment of a row of A that are marked (in the
+ * interpolatory set or the point itself) and have the sign opposite to
+ * sgn, and distribution of scale times these entries onto the weights or
+ * the diagonal.  The index space of the segment is j, or map[j] if map is
+ * not NULL.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Real
+hypre_BoomerAMGReuseInterpSum( HYPRE_Int      start,
+                               HYPRE_Int      end,
+                               HYPRE_Int     *j,
+                               HYPRE_Int     *map,
+                               HYPRE_Complex *data,
+                               HYPRE_Int     *marker,
+                               HYPRE_Int      sgn )
+{
+   HYPRE_Real sum = 0.0;
+   HYPRE_Int  l, code;
+
+   for (l = start; l < end; l++)
+   {
+      code = map ? map[j[l]] : j[l];
+      if (marker[code] != -1 && data[l] * sgn < 0.0)
+      {
+         sum += data[l];
+      }
+   }
+
+   return sum;
+}
+
+static inline void
+hypre_BoomerAMGReuseInterpDistribute( HYPRE_Int      start,
+                                      HYPRE_Int      end,
+                                      HYPRE_Int     *j,
+                                      HYPRE_Int     *map,
+                                      HYPRE_Complex *data,
+                                      HYPRE_Int     *marker,
+                                      HYPRE_Int      sgn,
+                                      HYPRE_Real     scale,
+                                      HYPRE_Real    *row_w,
+                                      HYPRE_Real    *diagonal )
+{
+   HYPRE_Int l, code, m;
+
+   for (l = start; l < end; l++)
+   {
+      code = map ? map[j[l]] : j[l];
+      m = marker[code];
+      if (m != -1 && data[l] * sgn < 0.0)
+      {
+         if (m >= 0)
+         {
+            row_w[m] += scale * data[l];
+         }
+         else
+         {
+            *diagonal += scale * data[l];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseInterp
+ *
+ * Recomputes the weights of P for the (new) values of A on the existing
+ * sparsity pattern of P, keeping the CF splitting in CF_marker.  The
+ * weights follow extended+i interpolation restricted to the pattern:
+ *
+ *  - a coupling a_ik to a point k in the interpolatory set C_i of F-point i
+ *    (the columns of row i of P) contributes to w_ik;
+ *  - a coupling to an F-point k is distributed onto C_i and i itself in
+ *    proportion to the entries of row k that have the sign opposite to
+ *    a_kk, or added to the diagonal if row k has no such entries;
+ *  - couplings of the sign of a_ii are added to the diagonal;
+ *  - couplings to C-points outside of C_i are distributed onto C_i by
+ *    rescaling the weights, as done after interpolation truncation.
+ *
+ * The rows of P of the C-points are not changed.  The fine grid points are
+ * numbered in one local index space: the local points, then the
+ * off-processor neighbors and the off-processor points of the interpolatory
+ * sets, so membership in C_i is a marker lookup.  The rows of A of the
+ * off-processor neighbors (A_ext) and the fine grid indices of the
+ * off-processor coarse points of P are fetched with the communication
+ * packages of A and P.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseInterp( hypre_ParCSRMatrix *A,
+                            HYPRE_Int          *CF_marker,
+                            hypre_ParCSRMatrix *P )
+{
+   MPI_Comm                 comm            = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg     *comm_pkg;
+   hypre_ParCSRCommHandle  *comm_handle;
+
+   hypre_CSRMatrix         *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex           *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix         *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int               *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex           *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int                num_cols_A_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt            *col_map_offd_A  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt             first_row       = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_Int                n_fine          = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix         *P_diag          = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int               *P_diag_i        = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int               *P_diag_j        = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex           *P_diag_data     = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix         *P_offd          = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int               *P_offd_i        = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int               *P_offd_j        = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex           *P_offd_data     = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int                num_cols_P_offd = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_Int                n_coarse        = hypre_CSRMatrixNumCols(P_diag);
+
+   hypre_CSRMatrix         *A_ext           = NULL;
+   HYPRE_Int               *A_ext_i         = NULL;
+   HYPRE_BigInt            *A_ext_j         = NULL;
+   HYPRE_Complex           *A_ext_data      = NULL;
+   HYPRE_Int               *A_ext_code      = NULL;
+   HYPRE_Int                num_ext         = 0;
+
+   HYPRE_Int               *CF_marker_offd  = NULL;
+   HYPRE_Int               *coarse_to_fine;
+   HYPRE_BigInt            *fine_index;
+   HYPRE_BigInt            *fine_index_offd = NULL;
+   HYPRE_BigInt            *col_map         = NULL;
+   HYPRE_Int                num_cols        = 0;
+   HYPRE_Int               *A_offd_code     = NULL;
+   HYPRE_Int               *P_offd_code     = NULL;
+   HYPRE_Int                n_codes;
+   HYPRE_Int               *int_buf_data;
+   HYPRE_BigInt            *big_buf_data;
+
+   HYPRE_Int                num_procs, num_sends, num_elmts;
+   HYPRE_Int                max_P_row;
+   HYPRE_Int                i, j;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Fine grid points of the local coarse points (from the rows of P of the
+    * C-points) and the longest row of P
+    *-----------------------------------------------------------------------*/
+
+   coarse_to_fine = hypre_CTAlloc(HYPRE_Int,    n_coarse, HYPRE_MEMORY_HOST);
+   fine_index     = hypre_CTAlloc(HYPRE_BigInt, n_coarse, HYPRE_MEMORY_HOST);
+   max_P_row = 0;
+   for (i = 0; i < n_fine; i++)
+   {
+      if (CF_marker[i] >= 0 && P_diag_i[i+1] > P_diag_i[i])
+      {
+         coarse_to_fine[P_diag_j[P_diag_i[i]]] = i;
+         fine_index[P_diag_j[P_diag_i[i]]] = first_row + (HYPRE_BigInt) i;
+      }
+      max_P_row = hypre_max(max_P_row, P_diag_i[i+1] - P_diag_i[i] + P_offd_i[i+1] - P_offd_i[i]);
+   }
+
+   if (num_procs > 1)
+   {
+      /* CF splitting of the off-processor neighbors */
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+      int_buf_data   = hypre_TAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+      CF_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_elmts; i++)
+      {
+         int_buf_data[i] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, CF_marker_offd);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+
+      /* fine grid indices of the off-processor coarse points of P */
+      if (!hypre_ParCSRMatrixCommPkg(P))
+      {
+         hypre_MatvecCommPkgCreate(P);
+      }
+      comm_pkg  = hypre_ParCSRMatrixCommPkg(P);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+      big_buf_data    = hypre_TAlloc(HYPRE_BigInt, num_elmts, HYPRE_MEMORY_HOST);
+      fine_index_offd = hypre_CTAlloc(HYPRE_BigInt, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_elmts; i++)
+      {
+         big_buf_data[i] = fine_index[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, big_buf_data, fine_index_offd);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(big_buf_data, HYPRE_MEMORY_HOST);
+
+      /* rows of A of the off-processor neighbors */
+      A_ext      = hypre_ParCSRMatrixExtractBExt(A, A, 1);
+      A_ext_i    = hypre_CSRMatrixI(A_ext);
+      A_ext_j    = hypre_CSRMatrixBigJ(A_ext);
+      A_ext_data = hypre_CSRMatrixData(A_ext);
+      num_ext    = A_ext_i[num_cols_A_offd];
+
+      /* off-processor part of the index space */
+      col_map = hypre_TAlloc(HYPRE_BigInt, num_cols_A_offd + num_cols_P_offd + num_ext,
+                             HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_cols_A_offd; j++)
+      {
+         col_map[num_cols++] = col_map_offd_A[j];
+      }
+      for (j = 0; j < num_cols_P_offd; j++)
+      {
+         col_map[num_cols++] = fine_index_offd[j];
+      }
+      for (j = 0; j < num_ext; j++)
+      {
+         if (A_ext_j[j] < first_row || A_ext_j[j] >= first_row + (HYPRE_BigInt) n_fine)
+         {
+            col_map[num_cols++] = A_ext_j[j];
+         }
+      }
+      num_cols = hypre_BoomerAMGReuseUnique(col_map, num_cols);
+
+      A_offd_code = hypre_TAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_cols_A_offd; j++)
+      {
+         A_offd_code[j] = hypre_BoomerAMGReuseCode(col_map_offd_A[j], first_row, n_fine,
+                                                   col_map, num_cols);
+      }
+      P_offd_code = hypre_TAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_cols_P_offd; j++)
+      {
+         P_offd_code[j] = hypre_BoomerAMGReuseCode(fine_index_offd[j], first_row, n_fine,
+                                                   col_map, num_cols);
+      }
+      A_ext_code = hypre_TAlloc(HYPRE_Int, num_ext, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_ext; j++)
+      {
+         A_ext_code[j] = hypre_BoomerAMGReuseCode(A_ext_j[j], first_row, n_fine,
+                                                  col_map, num_cols);
+      }
+   }
+   n_codes = n_fine + num_cols;
+
+   /*-----------------------------------------------------------------------
+    * New weights, row by row.  marker holds the position in row i of the
+    * points of C_i, -2 for i itself and -1 for all other points.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j)
+#endif
+   {
+      HYPRE_Int  *marker = hypre_TAlloc(HYPRE_Int,  n_codes,   HYPRE_MEMORY_HOST);
+      HYPRE_Real *row_w  = hypre_TAlloc(HYPRE_Real, max_P_row, HYPRE_MEMORY_HOST);
+
+      for (j = 0; j < n_codes; j++)
+      {
+         marker[j] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_fine; i++)
+      {
+         HYPRE_Int     num_diag = P_diag_i[i+1] - P_diag_i[i];
+         HYPRE_Int     num_w    = num_diag + P_offd_i[i+1] - P_offd_i[i];
+         HYPRE_Real    diagonal, dropped, sum, scale;
+         HYPRE_Int     sgn, sgn_k, jj, l, m, k, is_C, is_offd;
+         HYPRE_Complex a, a_kk;
+
+         if (CF_marker[i] >= 0 || num_w == 0)
+         {
+            continue;
+         }
+
+         for (m = 0; m < num_diag; m++)
+         {
+            marker[coarse_to_fine[P_diag_j[P_diag_i[i] + m]]] = m;
+            row_w[m] = 0.0;
+         }
+         for (m = num_diag; m < num_w; m++)
+         {
+            marker[P_offd_code[P_offd_j[P_offd_i[i] + m - num_diag]]] = m;
+            row_w[m] = 0.0;
+         }
+         marker[i] = -2;
+
+         diagonal = A_diag_data[A_diag_i[i]];
+         sgn      = diagonal < 0.0 ? -1 : 1;
+         dropped  = 0.0;
+
+         for (jj = A_diag_i[i] + 1; jj < A_diag_i[i+1] + A_offd_i[i+1] - A_offd_i[i]; jj++)
+         {
+            is_offd = jj >= A_diag_i[i+1];
+            if (!is_offd)
+            {
+               k    = A_diag_j[jj];
+               a    = A_diag_data[jj];
+               m    = marker[k];
+               is_C = CF_marker[k] >= 0;
+            }
+            else
+            {
+               k    = A_offd_j[A_offd_i[i] + jj - A_diag_i[i+1]];
+               a    = A_offd_data[A_offd_i[i] + jj - A_diag_i[i+1]];
+               m    = marker[A_offd_code[k]];
+               is_C = CF_marker_offd[k] >= 0;
+            }
+
+            if (m >= 0)
+            {
+               row_w[m] += a;
+               continue;
+            }
+            if (a * sgn >= 0.0)
+            {
+               diagonal += a;
+               continue;
+            }
+            if (is_C)
+            {
+               dropped += a;
+               continue;
+            }
+
+            /* F-neighbor: distribute a_ik onto C_i and i */
+            if (!is_offd)
+            {
+               a_kk  = A_diag_data[A_diag_i[k]];
+               sgn_k = a_kk < 0.0 ? -1 : 1;
+               sum   = hypre_BoomerAMGReuseInterpSum(A_diag_i[k], A_diag_i[k+1], A_diag_j, NULL,
+                                                     A_diag_data, marker, sgn_k) +
+                       hypre_BoomerAMGReuseInterpSum(A_offd_i[k], A_offd_i[k+1], A_offd_j, A_offd_code,
+                                                     A_offd_data, marker, sgn_k);
+            }
+            else
+            {
+               a_kk = 0.0;
+               for (l = A_ext_i[k]; l < A_ext_i[k+1]; l++)
+               {
+                  if (A_ext_code[l] == A_offd_code[k])
+                  {
+                     a_kk = A_ext_data[l];
+                     break;
+                  }
+               }
+               sgn_k = a_kk < 0.0 ? -1 : 1;
+               sum   = hypre_BoomerAMGReuseInterpSum(A_ext_i[k], A_ext_i[k+1], A_ext_code, NULL,
+                                                     A_ext_data, marker, sgn_k);
+            }
+
+            if (sum == 0.0)
+            {
+               diagonal += a;
+               continue;
+            }
+
+            scale = a / sum;
+            if (!is_offd)
+            {
+               hypre_BoomerAMGReuseInterpDistribute(A_diag_i[k], A_diag_i[k+1], A_diag_j, NULL,
+                                                    A_diag_data, marker, sgn_k, scale,
+                                                    row_w, &diagonal);
+               hypre_BoomerAMGReuseInterpDistribute(A_offd_i[k], A_offd_i[k+1], A_offd_j, A_offd_code,
+                                                    A_offd_data, marker, sgn_k, scale,
+                                                    row_w, &diagonal);
+            }
+            else
+            {
+               hypre_BoomerAMGReuseInterpDistribute(A_ext_i[k], A_ext_i[k+1], A_ext_code, NULL,
+                                                    A_ext_data, marker, sgn_k, scale,
+                                                    row_w, &diagonal);
+            }
+         }
+
+         /* couplings to C-points outside of C_i: rescale the weights */
+         if (dropped != 0.0)
+         {
+            sum = 0.0;
+            for (m = 0; m < num_w; m++)
+            {
+               sum += row_w[m];
+            }
+            if (sum != 0.0)
+            {
+               scale = (sum + dropped) / sum;
+               for (m = 0; m < num_w; m++)
+               {
+                  row_w[m] *= scale;
+               }
+            }
+            else
+            {
+               diagonal += dropped;
+            }
+         }
+
+         scale = diagonal != 0.0 ? -1.0 / diagonal : 0.0;
+         for (m = 0; m < num_diag; m++)
+         {
+            P_diag_data[P_diag_i[i] + m] = scale * row_w[m];
+            marker[coarse_to_fine[P_diag_j[P_diag_i[i] + m]]] = -1;
+         }
+         for (m = num_diag; m < num_w; m++)
+         {
+            P_offd_data[P_offd_i[i] + m - num_diag] = scale * row_w[m];
+            marker[P_offd_code[P_offd_j[P_offd_i[i] + m - num_diag]]] = -1;
+         }
+         marker[i] = -1;
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_w,  HYPRE_MEMORY_HOST);
+   }
+
+   /* stale copies of the values of P */
+   hypre_BoomerAMGReuseDropCopies(P_diag);
+   hypre_BoomerAMGReuseDropCopies(P_offd);
+   if (hypre_ParCSRMatrixDiagT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+      hypre_CSRMatrixTranspose(P_diag, &hypre_ParCSRMatrixDiagT(P), 1);
+   }
+   if (hypre_ParCSRMatrixOffdT(P))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+      hypre_CSRMatrixTranspose(P_offd, &hypre_ParCSRMatrixOffdT(P), 1);
+   }
+
+   hypre_CSRMatrixDestroy(A_ext);
+   hypre_TFree(A_ext_code,      HYPRE_MEMORY_HOST);
+   hypre_TFree(A_offd_code,     HYPRE_MEMORY_HOST);
+   hypre_TFree(P_offd_code,     HYPRE_MEMORY_HOST);
+   hypre_TFree(col_map,         HYPRE_MEMORY_HOST);
+   hypre_TFree(CF_marker_offd,  HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_to_fine,  HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_index,      HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_index_offd, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseCoarseOperator
+ *
+ * Overwrites the values of the coarse grid operator of the given level with
+ * those of P^T A P, keeping its sparsity pattern and its communication
+ * package.  The plan of the product (see hypre_ParCSRMatrixRAPPlanCreate)
+ * is built by the first re-setup and kept with the hierarchy.  Products
+ * outside of the pattern of the coarse grid operator (entries dropped by
+ * the setup) are ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseCoarseOperator( void      *amg_vdata,
+                                    HYPRE_Int  level )
+{
+   hypre_ParAMGData        *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix      *A         = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParCSRMatrix      *P         = hypre_ParAMGDataPArray(amg_data)[level];
+   hypre_ParCSRMatrix      *A_H       = hypre_ParAMGDataAArray(amg_data)[level+1];
+   hypre_ParCSRMatMatPlan **rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+
+   if (!rap_plans)
+   {
+      rap_plans = hypre_CTAlloc(hypre_ParCSRMatMatPlan *, hypre_ParAMGDataNumLevels(amg_data),
+                                HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlans(amg_data) = rap_plans;
+   }
+   if (!rap_plans[level])
+   {
+      rap_plans[level] = hypre_ParCSRMatrixRAPPlanCreate(P, A, P, A_H);
+   }
+
+   hypre_BoomerAMGBuildCoarseOperatorNumeric(rap_plans[level], P, A, P, A_H);
+
+   hypre_BoomerAMGReuseDropCopies(hypre_ParCSRMatrixDiag(A_H));
+   hypre_BoomerAMGReuseDropCopies(hypre_ParCSRMatrixOffd(A_H));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseDestroyPlans
+ *
+ * Frees the plans of the Galerkin products (when the hierarchy is rebuilt
+ * or destroyed).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseDestroyPlans( void *amg_vdata )
+{
+   hypre_ParAMGData        *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatMatPlan **rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+   HYPRE_Int                level;
+
+   if (rap_plans)
+   {
+      for (level = 0; level < hypre_ParAMGDataNumLevels(amg_data); level++)
+      {
+         hypre_ParCSRMatMatPlanDestroy(rap_plans[level]);
+      }
+      hypre_TFree(rap_plans, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlans(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
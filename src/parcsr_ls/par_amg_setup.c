@@ -110,7 +110,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real         **cheby_coefs = NULL;
 
    HYPRE_Int       old_num_levels, num_levels;
-   HYPRE_Int       level;
+   HYPRE_Int       level, reuse_levels;
    HYPRE_Int       local_size, i, row;
    HYPRE_BigInt    first_local_row;
    HYPRE_BigInt    coarse_size;
@@ -188,6 +188,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       mult_addlvl = hypre_max(mult_additive, simple);
    HYPRE_Int       addlvl = hypre_max(mult_addlvl, additive);
    HYPRE_Int       rap2 = hypre_ParAMGDataRAP2(amg_data);
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   /* the row-streamed triple product is a host kernel */
+   HYPRE_Int       stream_rap = 0;
+#else
+   HYPRE_Int       stream_rap = hypre_ParAMGDataStreamRAP(amg_data);
+#endif
+   void           *rap_request = NULL;
    HYPRE_Int       keepTranspose = hypre_ParAMGDataKeepTranspose(amg_data);
 
    HYPRE_Int       local_coarse_size;
@@ -378,10 +385,24 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* end of systems checks */
 
+   /* with re-setup on, the coarse grids and the patterns of P and of the
+      coarse grid operators of the previous setup are kept */
+   reuse_levels = hypre_BoomerAMGReuseSetupLevels(amg_data, A);
+   hypre_ParAMGDataReuseLevels(amg_data) = reuse_levels;
+
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (!reuse_levels)
+   {
+      hypre_BoomerAMGReuseDestroyPlans(amg_data);
+   }
+
+   /* the level statistics count the cycles since the last setup */
+   hypre_TFree(hypre_ParAMGDataLevelStatsData(amg_data), HYPRE_MEMORY_HOST);
+
+   if (!reuse_levels &&
+       (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+        dof_func_array || R_array || R_block_array))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -867,12 +888,61 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  Re-setup: new interpolation weights and Galerkin values
+    *  on the frozen hierarchy, skipping the coarsening loop
+    *-----------------------------------------------------*/
+
+   if (reuse_levels)
+   {
+      for (level = 0; level < reuse_levels-1; level++)
+      {
+         if (level > 0)
+         {
+            F_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize_v2(F_array[level], memory_location);
+            hypre_ParVectorSetPartitioningOwner(F_array[level],0);
+
+            U_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize_v2(U_array[level], memory_location);
+            hypre_ParVectorSetPartitioningOwner(U_array[level],0);
+         }
+
+         if (debug_flag==1) wall_time = time_getWallclockSeconds();
+
+         hypre_BoomerAMGReuseInterp(A_array[level], CF_marker_array[level], P_array[level]);
+         hypre_BoomerAMGReuseCoarseOperator(amg_data, level);
+
+         if (debug_flag==1)
+         {
+            wall_time = time_getWallclockSeconds() - wall_time;
+            hypre_printf("Proc = %d    Level = %d    Re-setup Time = %f\n",
+                          my_id, level, wall_time);
+            fflush(NULL);
+         }
+      }
+
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
 
+   /* the work arrays of each level come from the host arena (if enabled) */
+   hypre_HostArenaBegin();
+
    while (not_finished_coarsening)
    {
+      hypre_HostArenaReset();
+
       /* only do nodal coarsening on a fixed number of levels */
       if (level >= nodal_levels)
       {
@@ -975,6 +1045,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Get the Strength Matrix ****/
 
+         hypre_RegionBegin("BoomerAMG.strength");
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
@@ -1058,6 +1129,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                             SmoothVecs, strong_threshold,
                                             num_functions, dof_func_array[level], &S);
          }
+         hypre_RegionEnd("BoomerAMG.strength");
 
          /* Allocate CF_marker for the current level */
          CF_marker_array[level] = hypre_CTAlloc(HYPRE_Int, local_num_vars, HYPRE_MEMORY_HOST);
@@ -1087,6 +1159,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
 
+         hypre_RegionBegin("BoomerAMG.coarsen");
          if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
@@ -1108,6 +1181,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
            {
 #ifdef HYPRE_MIXEDINT
               hypre_error_w_msg(HYPRE_ERROR_GENERIC,"CGC coarsening is not available in mixedint mode!");
+              hypre_HostArenaEnd();
+              hypre_RegionEnd("BoomerAMG.coarsen");
               return hypre_error_flag;
 #endif
               hypre_BoomerAMGCoarsenCGCb(S, A_array[level], measure_type, coarsen_type,
@@ -1469,6 +1544,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                }
                hypre_TFree(col_offd_Sabs_to_A, HYPRE_MEMORY_HOST);
 
+               hypre_RegionEnd("BoomerAMG.coarsen");
                break;
             }
 
@@ -1494,6 +1570,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                }
                hypre_TFree(col_offd_Sabs_to_A, HYPRE_MEMORY_HOST);
 
+               hypre_RegionEnd("BoomerAMG.coarsen");
                break;
             }
          }
@@ -1501,6 +1578,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
          if (level < agg_num_levels)
          {
+            /* the interpolation of aggressive coarsening is timed as interp */
+            hypre_RegionEnd("BoomerAMG.coarsen");
+            hypre_RegionBegin("BoomerAMG.interp");
+
             if (nodal == 0)
             {
                if (agg_interp_type == 1)
@@ -1772,6 +1853,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             coarse_size = coarse_pnts_global[num_procs];
 #endif
  xxxxxxxxxxxxxxxxxxxxxxxxx change for min_coarse_size */
+            hypre_RegionEnd("BoomerAMG.coarsen");
             if (debug_flag==1)
             {
                wall_time = time_getWallclockSeconds() - wall_time;
@@ -1836,6 +1918,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
 
             if (debug_flag==1) wall_time = time_getWallclockSeconds();
+            hypre_RegionBegin("BoomerAMG.interp");
 
             if (interp_type == 4)
             {
@@ -2170,6 +2253,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParVectorDestroy(U_array[level]);
          }
 
+         if (max_levels > 1)
+         {
+            hypre_RegionEnd("BoomerAMG.interp");
+         }
          break;
       }
       if (level < agg_num_levels && coarse_size < min_coarse_size)
@@ -2186,6 +2273,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          coarse_size = fine_size;
 
+         hypre_RegionEnd("BoomerAMG.interp");
          break;
       }
 
@@ -2461,7 +2549,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   /* Delete AP */
                   hypre_ParCSRMatrixDestroy(Q);
                }
-               else if (rap2)
+               else if (rap2 && !stream_rap)
                {
                   /* Use two matrix products to generate A_H */
                   hypre_ParCSRMatrix *Q = NULL;
@@ -2484,7 +2572,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                }
                else
                {
-                  if (hypre_ParAMGDataModularizedMatMat(amg_data))
+                  if (stream_rap)
+                  {
+                     A_H = hypre_ParCSRMatrixRAPStream(P, A_array[level],
+                                                       P, keepTranspose);
+                  }
+                  else if (hypre_ParAMGDataModularizedMatMat(amg_data))
                   {
                      A_H = hypre_ParCSRMatrixRAPKT(P, A_array[level],
                                                    P, keepTranspose);
@@ -2540,6 +2633,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             {
                R_array[level] = R;
             }
+
+            /* P is final: post the fetch of its external rows for the
+               Galerkin product, it completes while this level is cleaned up */
+            if (level < nongalerk_num_tol)
+            {
+               nongalerk_tol_l = nongalerk_tol[level];
+            }
+            if (nongal_tol_array)
+            {
+               nongalerk_tol_l = nongal_tol_array[level];
+            }
+            if (stream_rap && !restri_type && nongalerk_tol_l <= 0.0)
+            {
+               hypre_ParCSRMatrixRAPStreamInit(P, A_array[level], P, keepTranspose,
+                                               &rap_request);
+            }
          }
       }
 
@@ -2552,6 +2661,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_TFree(SmoothVecs, HYPRE_MEMORY_HOST);
       SmoothVecs = NULL;
 
+      hypre_RegionEnd("BoomerAMG.interp");
       if (debug_flag==1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -2565,6 +2675,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        *--------------------------------------------------------------*/
 
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
+      hypre_RegionBegin("BoomerAMG.RAP");
 
       if (block_mode)
       {
@@ -2657,7 +2768,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParCSRMatrixPrintIJ(A_H, 1, 1, file);
 #endif
          }
-         else if (rap2)
+         else if (rap2 && !stream_rap)
          {
             /* Use two matrix products to generate A_H */
             hypre_ParCSRMatrix *Q = NULL;
@@ -2684,7 +2795,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            if (stream_rap)
+            {
+               /* Row-streamed product, A*P is not stored */
+               if (!rap_request)
+               {
+                  hypre_ParCSRMatrixRAPStreamInit(P_array[level], A_array[level],
+                                                  P_array[level], keepTranspose,
+                                                  &rap_request);
+               }
+               A_H = hypre_ParCSRMatrixRAPStreamWait(rap_request);
+               rap_request = NULL;
+            }
+            else if (hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
                                              P_array[level], keepTranspose);
@@ -2703,6 +2826,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
+      hypre_RegionEnd("BoomerAMG.RAP");
       if (debug_flag==1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -2751,6 +2875,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   hypre_HostArenaEnd();
+
    /* redundant coarse grid solve */
    if (  (seq_threshold >= coarse_threshold) && (coarse_size > (HYPRE_BigInt)coarse_threshold) && (level != max_levels-1))
    {
@@ -2838,6 +2964,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
     * Setup of special smoothers when needed
     *-----------------------------------------------------------------------*/
 
+   hypre_RegionBegin("BoomerAMG.smoother");
    if (addlvl > -1 ||
        grid_relax_type[1] ==  7 || grid_relax_type[2] ==  7 || grid_relax_type[3] ==  7 ||
        grid_relax_type[1] ==  8 || grid_relax_type[2] ==  8 || grid_relax_type[3] ==  8 ||
@@ -3081,6 +3208,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Euclid smoothing is not available in mixedint mode!");
+         hypre_RegionEnd("BoomerAMG.smoother");
          return hypre_error_flag;
 #endif
          HYPRE_EuclidCreate(comm, &smoother[j]);
@@ -3122,6 +3250,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"ParaSails smoothing is not available in mixedint mode!");
+         hypre_RegionEnd("BoomerAMG.smoother");
          return hypre_error_flag;
 #endif
          HYPRE_ParCSRParaSailsCreate(comm, &smoother[j]);
@@ -3137,6 +3266,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"pilut smoothing is not available in mixedint mode!");
+         hypre_RegionEnd("BoomerAMG.smoother");
          return hypre_error_flag;
 #endif
          HYPRE_ParCSRPilutCreate(comm, &smoother[j]);
@@ -3187,6 +3317,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    {
       hypre_CreateLambda(amg_data);
    }
+   hypre_RegionEnd("BoomerAMG.smoother");
 
    /*-----------------------------------------------------------------------
     * Print some stuff
@@ -3370,6 +3501,138 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   /*-----------------------------------------------------------------------
+    * Mixed precision: keep the values of A on the intermediate levels and
+    * of P and R in single precision.  The finest level (owned by the user),
+    * the levels with complex smoothers and the coarsest level (direct
+    * solve) keep their double precision values.
+    *-----------------------------------------------------------------------*/
+
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if (hypre_ParAMGDataMixedPrecision(amg_data) && !block_mode && addlvl >= num_levels &&
+       grid_relax_type)
+   {
+      HYPRE_Int mixed_ok = 1;
+
+      for (j = 0; j < 3; j++)
+      {
+         switch (grid_relax_type[j])
+         {
+            case 0: case 3: case 4: case 6: case 7: case 8: case 13: case 14:
+               break;
+            default:
+               mixed_ok = 0;
+         }
+      }
+
+      if (mixed_ok)
+      {
+         for (level = hypre_max(1, smooth_num_levels); level < num_levels-1; level++)
+         {
+            hypre_ParCSRMatrixSetDataFloat(A_array[level], 0);
+         }
+         for (level = 0; level < num_levels-1; level++)
+         {
+            hypre_ParCSRMatrixSetDataFloat(P_array[level], 0);
+            if (R_array && R_array[level])
+            {
+               hypre_ParCSRMatrixSetDataFloat(R_array[level], 0);
+            }
+         }
+      }
+   }
+#endif
+
+   /*-----------------------------------------------------------------------
+    * With persistent communication on, set up the halo exchanges of A, P
+    * and R on all levels here, so that the cycles neither allocate buffers
+    * nor initialize requests.
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_HandlePersistentComm(hypre_handle()) && !block_mode)
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_ParCSRMatrixPersistentCommSetup(A_array[level], 0);
+         if (level < num_levels-1)
+         {
+            hypre_ParCSRMatrixPersistentCommSetup(P_array[level], 1);
+            if (R_array)
+            {
+               hypre_ParCSRMatrixPersistentCommSetup(R_array[level], 0);
+            }
+         }
+      }
+   }
+
+   /* the same for the graph communicators of the neighborhood collectives,
+      since the comm_pkgs of the coarse operators are not built by
+      hypre_MatvecCommPkgCreate */
+   if (hypre_HandleNeighborComm(hypre_handle()) && !block_mode)
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_ParCSRMatrixNeighborCommSetup(A_array[level]);
+         if (level < num_levels-1)
+         {
+            hypre_ParCSRMatrixNeighborCommSetup(P_array[level]);
+            if (R_array)
+            {
+               hypre_ParCSRMatrixNeighborCommSetup(R_array[level]);
+            }
+         }
+      }
+   }
+
+   /* shared memory windows for the on-node halos; their setup and release
+      synchronize the ranks of a node, so only the hierarchy gets them */
+   if (hypre_HandleShmComm(hypre_handle()) && !block_mode)
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_ParCSRMatrixShmCommSetup(A_array[level]);
+         if (level < num_levels-1)
+         {
+            hypre_ParCSRMatrixShmCommSetup(P_array[level]);
+            if (R_array)
+            {
+               hypre_ParCSRMatrixShmCommSetup(R_array[level]);
+            }
+         }
+      }
+   }
+
+   /* node-aware halo exchanges on the levels whose operator exchanges small
+      messages on average */
+   if (hypre_ParAMGDataNodeCommThreshold(amg_data) > 0 && !block_mode)
+   {
+      HYPRE_Real avg_msg_size;
+
+      for (level = 0; level < num_levels; level++)
+      {
+         if (!hypre_ParCSRMatrixCommPkg(A_array[level]))
+         {
+            hypre_MatvecCommPkgCreate(A_array[level]);
+         }
+         avg_msg_size = hypre_ParCSRCommPkgAvgMessageSize(hypre_ParCSRMatrixCommPkg(A_array[level]));
+         if (avg_msg_size <= 0.0 ||
+             avg_msg_size >= (HYPRE_Real) hypre_ParAMGDataNodeCommThreshold(amg_data))
+         {
+            continue;
+         }
+
+         hypre_ParCSRMatrixNodeCommSetup(A_array[level]);
+         if (level < num_levels-1)
+         {
+            hypre_ParCSRMatrixNodeCommSetup(P_array[level]);
+            if (R_array)
+            {
+               hypre_ParCSRMatrixNodeCommSetup(R_array[level]);
+            }
+         }
+      }
+   }
+
    HYPRE_ANNOTATION_END("BoomerAMG.setup");
 
    return(hypre_error_flag);
@@ -239,6 +239,11 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
     *    Main V-cycle loop
     *-----------------------------------------------------------------------*/
 
+   if (hypre_ParAMGDataLevelStats(amg_data))
+   {
+      hypre_BoomerAMGLevelStatsStart(amg_data);
+   }
+
    while ( (relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
    {
       hypre_ParAMGDataCycleOpCount(amg_data) = 0;
@@ -315,6 +320,11 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       }
    }
 
+   if (hypre_ParAMGDataLevelStats(amg_data))
+   {
+      hypre_BoomerAMGLevelStatsStop(amg_data);
+   }
+
    if (cycle_count == max_iter && tol > 0.)
    {
       Solve_err_flag = 1;
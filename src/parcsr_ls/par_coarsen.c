@@ -2073,7 +2073,7 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    HYPRE_BigInt              global_graph_size;
 
    HYPRE_Int                 i, j, jj, jS, ig;
-   HYPRE_Int                 index, start, my_id, num_procs, jrow, cnt, elmt;
+   HYPRE_Int                 index, start, my_id, num_procs, jrow, elmt;
    HYPRE_Int                 nnzrow;
 
    HYPRE_Int                 ierr = 0;
@@ -2276,9 +2276,13 @@ CF_marker, CF_marker_offd: initialize CF_marker
    }
    CF_marker = *CF_marker_ptr;
 
+   /* first set the markers, then compact the nodes left in the graph
+      (in increasing order, as a sequential loop would) */
    if (CF_init == 1)
    {
-      cnt = 0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < num_variables; i++)
       {
          if ( CF_marker[i] != SF_PT )
@@ -2292,17 +2296,12 @@ CF_marker, CF_marker_offd: initialize CF_marker
                if ( measure_array[i] >= 1.0 || S_diag_i[i+1] - S_diag_i[i] > 0 )
                {
                   CF_marker[i] = 0;
-                  graph_array[cnt++] = i;
                }
                else
                {
                   CF_marker[i] = F_PT;
                }
             }
-            else
-            {
-               graph_array[cnt++] = i;
-            }
          }
          else
          {
@@ -2312,7 +2311,9 @@ CF_marker, CF_marker_offd: initialize CF_marker
    }
    else
    {
-      cnt = 0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, nnzrow) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < num_variables; i++)
       {
          CF_marker[i] = 0;
@@ -2326,14 +2327,44 @@ CF_marker, CF_marker_offd: initialize CF_marker
             }
             measure_array[i] = 0;
          }
-         else
+      }
+   }
+
+   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int private_cnt = 0;
+      HYPRE_Int i_begin, i_end, in_graph;
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_variables);
+
+      for (i = i_begin; i < i_end; i++)
+      {
+         /* with CF_init == 1, the C-points left from the first pass stay in the graph */
+         in_graph = (CF_init == 1) ? (CF_marker[i] != SF_PT && CF_marker[i] != F_PT) :
+                    (CF_marker[i] == 0);
+         if (in_graph)
+         {
+            private_cnt++;
+         }
+      }
+
+      hypre_prefix_sum(&private_cnt, &graph_size, prefix_sum_workspace);
+
+      for (i = i_begin; i < i_end; i++)
+      {
+         in_graph = (CF_init == 1) ? (CF_marker[i] != SF_PT && CF_marker[i] != F_PT) :
+                    (CF_marker[i] == 0);
+         if (in_graph)
          {
-            graph_array[cnt++] = i;
+            graph_array[private_cnt++] = i;
          }
       }
    }
 
-   graph_size = cnt;
+   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
    /* now the off-diagonal part of CF_marker */
    if (num_cols_offd)
@@ -2449,7 +2480,9 @@ CF_marker, CF_marker_offd: initialize CF_marker
          }
 
          /*-------------------------------------------------------
-          * Remove nodes from the initial independent set
+          * Remove nodes from the initial independent set.  Threads
+          * only clear markers, so the result does not depend on
+          * the order of the updates.
           *-------------------------------------------------------*/
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(ig, i, jS, j, jj) HYPRE_SMP_SCHEDULE
@@ -2468,10 +2501,16 @@ CF_marker, CF_marker_offd: initialize CF_marker
                   {
                      if (measure_array[i] > measure_array[j])
                      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                         CF_marker[j] = 0;
                      }
                      else if (measure_array[j] > measure_array[i])
                      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                         CF_marker[i] = 0;
                      }
                   }
@@ -2486,10 +2525,16 @@ CF_marker, CF_marker_offd: initialize CF_marker
                   {
                      if (measure_array[i] > measure_array[j])
                      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                         CF_marker_offd[jj] = 0;
                      }
                      else if (measure_array[j] > measure_array[i])
                      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                         CF_marker[i] = 0;
                      }
                   }
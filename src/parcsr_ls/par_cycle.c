@@ -105,6 +105,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       seq_cg = 0;
    MPI_Comm        comm;
 
+   HYPRE_Int       level_stats;
+   HYPRE_Int       stats_phase = HYPRE_AMG_PHASE_PRE_SMOOTH;
+   HYPRE_Real      stats_mark[2];
+   HYPRE_Real      stats_cost[2];
+
 #if 0
    HYPRE_Real   *D_mat;
    HYPRE_Real   *S_vec;
@@ -154,6 +159,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    cycle_op_count = hypre_ParAMGDataCycleOpCount(amg_data);
 
+   /* the statistics are allocated by hypre_BoomerAMGSolve */
+   level_stats = hypre_ParAMGDataLevelStats(amg_data) &&
+                 hypre_ParAMGDataLevelStatsData(amg_data);
+
    lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
 
    if (hypre_ParAMGDataParticipate(amg_data)) seq_cg = 1;
@@ -261,6 +270,21 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    while (Not_Finished)
    {
+      if (level_stats)
+      {
+         if (level == num_levels - 1)
+         {
+            stats_phase = HYPRE_AMG_PHASE_COARSE_SOLVE;
+         }
+         else
+         {
+            stats_phase = (cycle_param == 2) ? HYPRE_AMG_PHASE_POST_SMOOTH :
+                                               HYPRE_AMG_PHASE_PRE_SMOOTH;
+         }
+         stats_cost[0] = stats_cost[1] = 0.0;
+         hypre_BoomerAMGLevelStatsBegin(stats_mark);
+      }
+
       if (num_levels > 1)
       {
          local_size = hypre_VectorSize(hypre_ParVectorLocalVector(F_array[level]));
@@ -286,6 +310,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
             hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[level],
                                                U_array[level], beta, F_array[level], Rtemp);
+            if (level_stats)
+            {
+               hypre_BoomerAMGLevelStatsMatvecCost(A_array[level], NULL, stats_cost);
+            }
 
             cg_num_sweep = hypre_ParAMGDataSmoothNumSweeps(amg_data);
             num_sweep = num_grid_sweeps[cycle_param];
@@ -384,6 +412,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                   cycle_op_count += num_coeffs[level];
                }
 
+               if (level_stats)
+               {
+                  hypre_BoomerAMGLevelStatsRelaxCost(amg_data, level, relax_type, stats_cost);
+               }
+
                /*-----------------------------------------------
                 Choose Smoother
                 -----------------------------------------------*/
@@ -441,6 +474,33 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                { /* Gaussian elimination */
                   hypre_GaussElimSolve(amg_data, level, relax_type);
                }
+               else if ((relax_type == 8 || relax_type == 13 || relax_type == 14) &&
+                        hypre_ParAMGDataGSJacobiSweeps(amg_data) > 0 &&
+                        !block_mode && l1_norms_level)
+               {   /* L1 - Gauss-Seidel with Jacobi sweeps for the triangular solve */
+                  HYPRE_Int i, num_points = 1;
+                  HYPRE_Int loc_relax_points[2];
+                  loc_relax_points[0] = old_version ? relax_points : 0;
+                  if (!old_version && relax_local == 1 && cycle_param < 3)
+                  {
+                     num_points = 2;
+                     loc_relax_points[0] = (cycle_param < 2) ? 1 : -1;
+                     loc_relax_points[1] = -loc_relax_points[0];
+                  }
+                  for (i = 0; i < num_points; i++)
+                  {
+                     hypre_BoomerAMGRelaxTwoStageGaussSeidel(A_array[level],
+                                                             Aux_F,
+                                                             CF_marker_array[level],
+                                                             relax_type,
+                                                             loc_relax_points[i],
+                                                             relax_weight[level],
+                                                             hypre_VectorData(l1_norms_level),
+                                                             hypre_ParAMGDataGSJacobiSweeps(amg_data),
+                                                             Aux_U,
+                                                             Vtemp);
+                  }
+               }
                else if (relax_type == 18)
                {   /* L1 - Jacobi*/
                   if (relax_order == 1 && cycle_param < 3)
@@ -627,10 +687,19 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                alfa = gamma /hypre_ParVectorInnerProd(Ptemp,Vtemp);
                hypre_ParVectorAxpy(alfa,Ptemp,U_array[level]);
                hypre_ParVectorAxpy(-alfa,Vtemp,Rtemp);
+               if (level_stats)
+               {
+                  hypre_BoomerAMGLevelStatsMatvecCost(A_array[level], NULL, stats_cost);
+               }
             }
          }
       }
 
+      if (level_stats)
+      {
+         hypre_BoomerAMGLevelStatsEnd(amg_data, level, stats_phase, stats_mark, stats_cost);
+      }
+
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
        *-----------------------------------------------------------------*/
@@ -650,6 +719,15 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          fine_grid = level;
          coarse_grid = level + 1;
 
+         if (level_stats)
+         {
+            stats_cost[0] = stats_cost[1] = 0.0;
+            hypre_BoomerAMGLevelStatsMatvecCost(block_mode ? NULL : A_array[fine_grid],
+                                                block_mode ? A_block_array[fine_grid] : NULL,
+                                                stats_cost);
+            hypre_BoomerAMGLevelStatsBegin(stats_mark);
+         }
+
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
          alpha = -1.0;
@@ -668,6 +746,17 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                beta, F_array[fine_grid], Vtemp);
          }
 
+         if (level_stats)
+         {
+            hypre_BoomerAMGLevelStatsEnd(amg_data, fine_grid, HYPRE_AMG_PHASE_RESIDUAL,
+                                         stats_mark, stats_cost);
+            stats_cost[0] = stats_cost[1] = 0.0;
+            hypre_BoomerAMGLevelStatsMatvecCost(block_mode ? NULL : R_array[fine_grid],
+                                                block_mode ? R_block_array[fine_grid] : NULL,
+                                                stats_cost);
+            hypre_BoomerAMGLevelStatsBegin(stats_mark);
+         }
+
          alpha = 1.0;
          beta = 0.0;
 
@@ -691,6 +780,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          }
 
+         if (level_stats)
+         {
+            hypre_BoomerAMGLevelStatsEnd(amg_data, fine_grid, HYPRE_AMG_PHASE_RESTRICT,
+                                         stats_mark, stats_cost);
+         }
+
          ++level;
          lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
          cycle_param = 1;
@@ -713,6 +808,16 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          coarse_grid = level;
          alpha = 1.0;
          beta = 1.0;
+
+         if (level_stats)
+         {
+            stats_cost[0] = stats_cost[1] = 0.0;
+            hypre_BoomerAMGLevelStatsMatvecCost(block_mode ? NULL : P_array[fine_grid],
+                                                block_mode ? P_block_array[fine_grid] : NULL,
+                                                stats_cost);
+            hypre_BoomerAMGLevelStatsBegin(stats_mark);
+         }
+
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
@@ -728,6 +833,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             /* printf("Proc %d: level %d, n %d, Interpolation done\n", my_id, level, local_size); */
          }
 
+         if (level_stats)
+         {
+            hypre_BoomerAMGLevelStatsEnd(amg_data, fine_grid, HYPRE_AMG_PHASE_INTERPOLATE,
+                                         stats_mark, stats_cost);
+         }
+
          --level;
 
          if (fcycle && fcycle_lev == level)
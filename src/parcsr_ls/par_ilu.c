@@ -51,8 +51,22 @@ hypre_ILUCreate()
    (ilu_data -> U)                     = NULL;
    (ilu_data -> Utemp)                 = NULL;
    (ilu_data -> Ftemp)                 = NULL;
+   (ilu_data -> Xtemp)                 = NULL;
    (ilu_data -> uext)                  = NULL;
    (ilu_data -> fext)                  = NULL;
+   (ilu_data -> num_lower_levels)      = 0;
+   (ilu_data -> lower_level_ptr)       = NULL;
+   (ilu_data -> lower_level_rows)      = NULL;
+   (ilu_data -> num_upper_levels)      = 0;
+   (ilu_data -> upper_level_ptr)       = NULL;
+   (ilu_data -> upper_level_rows)      = NULL;
+   (ilu_data -> tri_solve)             = 1;
+   (ilu_data -> lower_jacobi_iters)    = 5;
+   (ilu_data -> upper_jacobi_iters)    = 5;
+   (ilu_data -> factor_sweeps)         = 3;
+   (ilu_data -> block_size)            = 1;
+   (ilu_data -> matLB)                 = NULL;
+   (ilu_data -> matUB)                 = NULL;
    (ilu_data -> residual)              = NULL;
    (ilu_data -> rel_res_norms)         = NULL;
 
@@ -111,6 +125,11 @@ hypre_ILUDestroy( void *data )
       hypre_ParVectorDestroy( (ilu_data -> Ftemp) );
       (ilu_data -> Ftemp) = NULL;
    }
+   if((ilu_data -> Xtemp))
+   {
+      hypre_ParVectorDestroy( (ilu_data -> Xtemp) );
+      (ilu_data -> Xtemp) = NULL;
+   }
    if(hypre_ParILUDataUExt(ilu_data))
    {
       hypre_TFree(hypre_ParILUDataUExt(ilu_data), HYPRE_MEMORY_HOST);
@@ -145,6 +164,12 @@ hypre_ILUDestroy( void *data )
       hypre_ParILUDataUEnd(ilu_data) = NULL;
    }
 
+   /* level schedules */
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+
    /* Factors */
    if(ilu_data -> matL)
    {
@@ -156,6 +181,16 @@ hypre_ILUDestroy( void *data )
       hypre_ParCSRMatrixDestroy((ilu_data -> matU));
       (ilu_data -> matU) = NULL;
    }
+   if(ilu_data -> matLB)
+   {
+      hypre_ParCSRBlockMatrixDestroy((ilu_data -> matLB));
+      (ilu_data -> matLB) = NULL;
+   }
+   if(ilu_data -> matUB)
+   {
+      hypre_ParCSRBlockMatrixDestroy((ilu_data -> matUB));
+      (ilu_data -> matUB) = NULL;
+   }
    if(ilu_data -> matD)
    {
       hypre_TFree((ilu_data -> matD), HYPRE_MEMORY_DEVICE);
@@ -375,6 +410,46 @@ hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging )
    (ilu_data -> logging) = logging;
    return hypre_error_flag;
 }
+/* Set type of triangular solves: exact (1) or Jacobi sweeps (0) */
+HYPRE_Int
+hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> tri_solve) = tri_solve;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi sweeps for the L solve (tri_solve = 0) */
+HYPRE_Int
+hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> lower_jacobi_iters) = lower_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi sweeps for the U solve (tri_solve = 0) */
+HYPRE_Int
+hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> upper_jacobi_iters) = upper_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of sweeps of the iterative ILU(k) factorization (ilu_type 2) */
+HYPRE_Int
+hypre_ILUSetFactorSweeps( void *ilu_vdata, HYPRE_Int factor_sweeps )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> factor_sweeps) = factor_sweeps;
+   return hypre_error_flag;
+}
+/* Set block size of the block ILU(k) (ilu_type 0) */
+HYPRE_Int
+hypre_ILUSetBlockSize( void *ilu_vdata, HYPRE_Int block_size )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> block_size) = block_size;
+   return hypre_error_flag;
+}
 /* Set type of reordering for local matrix */
 HYPRE_Int
 hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
@@ -619,6 +694,117 @@ hypre_ILUGetFinalRelativeResidualNorm( void *ilu_vdata, HYPRE_Real *res_norm )
 
    return hypre_error_flag;
 }
+/* Get the bytes held by the ILU solver (factors, permutations, work vectors
+ * and the Schur complement preconditioner, but not the Krylov work vectors of
+ * a GMRES Schur solver).  Factors are counted by their number of nonzeros;
+ * the unused capacity of the factor arrays is not included */
+HYPRE_Int
+hypre_ILUGetMemorySize( void *ilu_vdata, size_t *size )
+{
+   hypre_ParILUData  *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParCSRMatrix *matA;
+   hypre_CSRBlockMatrix *B_diag;
+   size_t              n = 0, schur_size, n_perm, n_D, bs;
+
+   if (!ilu_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   matA = hypre_ParILUDataMatA(ilu_data);
+   if (matA)
+   {
+      n = (size_t) hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matA));
+   }
+
+   *size  = sizeof(hypre_ParILUData);
+   *size += hypre_ParCSRMatrixMemorySize(hypre_ParILUDataMatL(ilu_data));
+   *size += hypre_ParCSRMatrixMemorySize(hypre_ParILUDataMatU(ilu_data));
+   *size += hypre_ParCSRMatrixMemorySize(hypre_ParILUDataMatS(ilu_data));
+   /* the block factors have n/bs block rows and bs x bs diagonal blocks */
+   n_perm = n_D = n;
+   if (hypre_ParILUDataMatLB(ilu_data))
+   {
+      bs = (size_t) hypre_ParCSRBlockMatrixBlockSize(hypre_ParILUDataMatLB(ilu_data));
+      n_perm = n / bs;
+      n_D = n * bs;
+      B_diag = hypre_ParCSRBlockMatrixDiag(hypre_ParILUDataMatLB(ilu_data));
+      *size += sizeof(HYPRE_Int) * (n_perm + 1 + hypre_CSRBlockMatrixNumNonzeros(B_diag)) +
+               sizeof(HYPRE_Complex) * bs * bs * hypre_CSRBlockMatrixNumNonzeros(B_diag);
+      B_diag = hypre_ParCSRBlockMatrixDiag(hypre_ParILUDataMatUB(ilu_data));
+      *size += sizeof(HYPRE_Int) * (n_perm + 1 + hypre_CSRBlockMatrixNumNonzeros(B_diag)) +
+               sizeof(HYPRE_Complex) * bs * bs * hypre_CSRBlockMatrixNumNonzeros(B_diag);
+   }
+   if (hypre_ParILUDataMatD(ilu_data))
+   {
+      *size += sizeof(HYPRE_Real) * n_D;
+   }
+   if (ilu_data -> l1_norms)
+   {
+      *size += sizeof(HYPRE_Real) * n;
+   }
+   if (hypre_ParILUDataCFMarkerArray(ilu_data))
+   {
+      *size += sizeof(HYPRE_Int) * n;
+   }
+   if (hypre_ParILUDataPerm(ilu_data))
+   {
+      *size += sizeof(HYPRE_Int) * n_perm;
+   }
+   if (hypre_ParILUDataQPerm(ilu_data) &&
+       hypre_ParILUDataQPerm(ilu_data) != hypre_ParILUDataPerm(ilu_data))
+   {
+      *size += sizeof(HYPRE_Int) * n;
+   }
+   if (hypre_ParILUDataUEnd(ilu_data))
+   {
+      *size += sizeof(HYPRE_Int) * hypre_ParILUDataNLU(ilu_data);
+   }
+   if (hypre_ParILUDataUExt(ilu_data) && matA && hypre_ParCSRMatrixCommPkg(matA))
+   {
+      hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(matA);
+      HYPRE_Int send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                            hypre_ParCSRCommPkgNumSends(comm_pkg));
+      HYPRE_Int recv_size = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(matA));
+
+      /* uext and fext */
+      *size += 2 * sizeof(HYPRE_Real) * hypre_max(send_size, recv_size);
+   }
+   if (ilu_data -> rel_res_norms)
+   {
+      *size += sizeof(HYPRE_Real) * (ilu_data -> max_iter);
+   }
+   *size += hypre_ParVectorMemorySize(ilu_data -> residual);
+   *size += hypre_ParVectorMemorySize(ilu_data -> Utemp);
+   *size += hypre_ParVectorMemorySize(ilu_data -> Ftemp);
+   *size += hypre_ParVectorMemorySize(ilu_data -> Xtemp);
+   *size += hypre_ParVectorMemorySize(ilu_data -> rhs);
+   *size += hypre_ParVectorMemorySize(ilu_data -> x);
+
+   switch (ilu_data -> ilu_type)
+   {
+      case 10: case 11: case 40: case 41:
+         if (ilu_data -> schur_precond)
+         {
+            hypre_ILUGetMemorySize(ilu_data -> schur_precond, &schur_size);
+            *size += schur_size;
+         }
+         break;
+      case 20: case 21:
+         if (ilu_data -> schur_solver)
+         {
+            hypre_ParNSHData *nsh_data = (hypre_ParNSHData*) (ilu_data -> schur_solver);
+            *size += sizeof(hypre_ParNSHData);
+            *size += hypre_ParCSRMatrixMemorySize(hypre_ParNSHDataMatM(nsh_data));
+         }
+         break;
+      default:
+         break;
+   }
+
+   return hypre_error_flag;
+}
 /*
  * Quicksort of the elements in a from low to high.
  * The elements in b are permuted according to the sorted a.
@@ -665,6 +851,10 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
    switch(ilu_data -> ilu_type){
       case 0:
          hypre_printf("Block Jacobi with ILU(%d) \n", (ilu_data -> lfil));
+         if (ilu_data -> matLB)
+         {
+            hypre_printf("Block size of the factors = %d \n", (ilu_data -> block_size));
+         }
          hypre_printf("Operator Complexity (Fill factor) = %f \n", (ilu_data -> operator_complexity));
          break;
       case 1:
@@ -673,6 +863,11 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
          hypre_printf("Max nnz per row = %d \n", (ilu_data -> maxRowNnz));
          hypre_printf("Operator Complexity (Fill factor) = %f \n", (ilu_data -> operator_complexity));
          break;
+      case 2:
+         hypre_printf("Block Jacobi with iterative ILU(%d) \n", (ilu_data -> lfil));
+         hypre_printf("Factorization sweeps = %d \n", (ilu_data -> factor_sweeps));
+         hypre_printf("Operator Complexity (Fill factor) = %f \n", (ilu_data -> operator_complexity));
+         break;
       case 10:
          hypre_printf("ILU-GMRES with ILU(%d) \n", (ilu_data -> lfil));
          hypre_printf("Operator Complexity (Fill factor) = %f \n", (ilu_data -> operator_complexity));
@@ -720,6 +915,11 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
    hypre_printf("\n ILU Solver Parameters: \n");
    hypre_printf("Max number of iterations: %d\n", (ilu_data -> max_iter));
    hypre_printf("Stopping tolerance: %e\n", (ilu_data -> tol));
+   if ((ilu_data -> tri_solve) == 0)
+   {
+      hypre_printf("Jacobi sweeps for L and U solves: %d %d\n",
+                   (ilu_data -> lower_jacobi_iters), (ilu_data -> upper_jacobi_iters));
+   }
 
    return hypre_error_flag;
 }
@@ -1226,7 +1426,7 @@ hypre_ILUGetPermddPQPre(HYPRE_Int n, HYPRE_Int nLU, HYPRE_Int *A_diag_i, HYPRE_I
  * nI: number of interial nodes
  * tol: the dropping tolorance for ddPQ
  * reordering_type: Type of reordering for the interior nodes.
- * Currently only supports RCM reordering. Set to 0 for no reordering.
+ * 1: RCM, 2: AMD, 3: nested dissection. Set to 0 for no reordering.
  */
 
 HYPRE_Int
@@ -1342,6 +1542,10 @@ hypre_ILUGetPermddPQ(hypre_ParCSRMatrix *A, HYPRE_Int **io_pperm, HYPRE_Int **io
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, nLU, &pperm, &qperm, 0);
          break;
+      case 2: case 3:
+         /* AMD or nested dissection */
+         hypre_ILULocalReordering( hypre_ParCSRMatrixDiag(A), 0, nLU, &pperm, &qperm, 0, reordering_type);
+         break;
       default:
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, nLU, &pperm, &qperm, 0);
@@ -1367,7 +1571,7 @@ hypre_ILUGetPermddPQ(hypre_ParCSRMatrix *A, HYPRE_Int **io_pperm, HYPRE_Int **io
  * perm: permutation array
  * nLU: number of interial nodes
  * reordering_type: Type of (additional) reordering for the interior nodes.
- * Currently only supports RCM reordering. Set to 0 for no reordering.
+ * 1: RCM, 2: AMD, 3: nested dissection. Set to 0 for no reordering.
  */
 HYPRE_Int
 hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type)
@@ -1437,6 +1641,10 @@ hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, first, &temp_perm, &temp_perm, 1);
          break;
+      case 2: case 3:
+         /* AMD or nested dissection */
+         hypre_ILULocalReordering( hypre_ParCSRMatrixDiag(A), 0, first, &temp_perm, &temp_perm, 0, reordering_type);
+         break;
       default:
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, first, &temp_perm, &temp_perm, 1);
@@ -1458,7 +1666,7 @@ hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_
  * perm: permutation array
  * nLU: number of interior nodes
  * reordering_type: Type of (additional) reordering for the nodes.
- * Currently only supports RCM reordering. Set to 0 for no reordering.
+ * 1: RCM, 2: AMD, 3: nested dissection. Set to 0 for no reordering.
  */
 HYPRE_Int
 hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type)
@@ -1482,6 +1690,10 @@ hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, H
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, n, &temp_perm, &temp_perm, 1);
          break;
+      case 2: case 3:
+         /* AMD or nested dissection */
+         hypre_ILULocalReordering( hypre_ParCSRMatrixDiag(A), 0, n, &temp_perm, &temp_perm, 0, reordering_type);
+         break;
       default:
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, n, &temp_perm, &temp_perm, 1);
@@ -1494,6 +1706,55 @@ hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, H
    return hypre_error_flag;
 }
 
+/*
+ * Get the (local) ordering of the block rows of the diag (local) block matrix, for the block ILU of the block-jacobi case
+ * A: parcsr block matrix
+ * perm: permutation array of the block rows
+ * nLU: number of block rows
+ * reordering_type: as in hypre_ILUGetLocalPerm, applied to the pattern of the blocks
+ */
+HYPRE_Int
+hypre_ILUGetLocalBlockPerm(hypre_ParCSRBlockMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type)
+{
+   hypre_CSRBlockMatrix *A_diag = hypre_ParCSRBlockMatrixDiag(A);
+   HYPRE_Int            n = hypre_CSRBlockMatrixNumRows(A_diag);
+   HYPRE_Int            i;
+   HYPRE_Int            *temp_perm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_DEVICE);
+   hypre_CSRMatrix      *G;
+
+   /* set perm array */
+   for( i = 0 ; i < n ; i ++ )
+   {
+      temp_perm[i] = i;
+   }
+   if(reordering_type != 0)
+   {
+      /* the reorderings only use the pattern, so G shares I and J of the blocks */
+      G = hypre_CSRMatrixCreate(n, n, hypre_CSRBlockMatrixNumNonzeros(A_diag));
+      hypre_CSRMatrixI(G) = hypre_CSRBlockMatrixI(A_diag);
+      hypre_CSRMatrixJ(G) = hypre_CSRBlockMatrixJ(A_diag);
+      hypre_CSRMatrixSetDataOwner(G, 0);
+      switch(reordering_type)
+      {
+         case 2: case 3:
+            /* AMD or nested dissection */
+            hypre_ILULocalReordering( G, 0, n, &temp_perm, &temp_perm, 0, reordering_type);
+            break;
+         default:
+            /* RCM */
+            hypre_ILULocalRCM( G, 0, n, &temp_perm, &temp_perm, 1);
+            break;
+      }
+      hypre_CSRMatrixI(G) = NULL;
+      hypre_CSRMatrixDestroy(G);
+   }
+   *nLU = n;
+   if((*perm) != NULL) hypre_TFree(*perm,HYPRE_MEMORY_DEVICE);
+   *perm = temp_perm;
+
+   return hypre_error_flag;
+}
+
 #if 0
 /* Build the expanded matrix for RAS-1
  * A: input ParCSR matrix
@@ -2004,8 +2265,22 @@ hypre_ILUSortOffdColmap(hypre_ParCSRMatrix *A)
  *--------------------------------------------------------------------------*/
 
 /* This function computes the RCM ordering of a sub matrix of
+ * sparse matrix B = A(perm,perm), see hypre_ILULocalReordering
+ */
+HYPRE_Int
+hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end,
+                     HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym)
+{
+   return hypre_ILULocalReordering(A, start, end, permp, qpermp, sym, 1);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILULocalReordering
+ *--------------------------------------------------------------------------*/
+
+/* This function computes a local ordering of a sub matrix of
  * sparse matrix B = A(perm,perm)
- * For nonsymmetrix problem, is the RCM ordering of B + B'
+ * For nonsymmetrix problem, is the ordering of B + B'
  * A: The input CSR matrix
  * start:      the start position of the submatrix in B
  * end:        the end position of the submatrix in B ( exclude end, [start,end) )
@@ -2021,10 +2296,14 @@ hypre_ILUSortOffdColmap(hypre_ParCSRMatrix *A)
  *             WARNING: if you use non-symmetric reordering, that is,
  *             different row and col reordering, the resulting A might be non-symmetric.
  *             Be careful if you are using non-symmetric reordering
+ * reordering_type: 1: RCM, 2: approximate minimum degree, 3: nested dissection.
+ *             The last two need a symmetric pattern, use sym = 0 unless the
+ *             pattern of A is symmetric
  */
 HYPRE_Int
-hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end,
-                     HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym)
+hypre_ILULocalReordering( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end,
+                          HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym,
+                          HYPRE_Int reordering_type)
 {
    HYPRE_Int               i, j, row, col, r1, r2;
 
@@ -2061,7 +2340,7 @@ hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end,
    if(n!=ncol || end > n || start < 0)
    {
       /* don't do this if the input has error */
-      hypre_printf("Error input, abort RCM\n");
+      hypre_printf("Error input, abort reordering\n");
       return hypre_error_flag;
    }
    if(!perm)
@@ -2186,11 +2465,22 @@ hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end,
    }
 
    /* 3: Build Graph
-    * Build RCM
+    * Build ordering
     */
    /* no need to be shared, but perm should be shared */
    G_perm = hypre_TAlloc(HYPRE_Int, num_nodes, HYPRE_MEMORY_HOST);
-   hypre_ILULocalRCMOrder( G, G_perm);
+   switch(reordering_type)
+   {
+      case 2:
+         hypre_ILULocalAMDOrder( G, G_perm);
+         break;
+      case 3:
+         hypre_ILULocalNDOrder( G, G_perm);
+         break;
+      default:
+         hypre_ILULocalRCMOrder( G, G_perm);
+         break;
+   }
 
    /* 4: Post processing
     * Free, set value, return
@@ -2539,6 +2829,561 @@ hypre_ILULocalRCMReverse(HYPRE_Int *perm, HYPRE_Int start, HYPRE_Int end)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILULocalAMDOrder
+ *--------------------------------------------------------------------------*/
+
+/* This function computes an approximate minimum degree ordering of a
+ * symmetric csr matrix (entire), following Amestoy, Davis and Duff.
+ * The elimination is done on the quotient graph: the list of a variable i
+ * holds the elements (eliminated nodes) adjacent to i first, then the
+ * adjacent variables; the list of an element e holds its variables L_e.
+ * After the element p is formed, the degree of each variable i in L_p is
+ * bounded by |A_i \ L_p| + |L_p \ i| + sum_{e in E_i} |L_e \ L_p|, and
+ * elements with L_e in L_p are absorbed.  Supervariables are not detected.
+ * A: the csr matrix, A_data is not needed
+ * perm: the permutation array, space should be allocated outside
+ */
+HYPRE_Int
+hypre_ILULocalAMDOrder( hypre_CSRMatrix *A, HYPRE_Int *perm)
+{
+   HYPRE_Int      i, j, k, q, e, v, p, deg, ext, nel, nvar, lenp, bound, live, mindeg;
+   HYPRE_Int      *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Int      n           = hypre_CSRMatrixNumRows(A);
+
+   /* the list of node i is iw[pe[i]], ..., iw[pe[i]+len[i]-1], the first
+    * elen[i] of them are elements.  status: 0 variable, 1 element,
+    * -1 absorbed element
+    */
+   HYPRE_Int      *iw, *iw_new;
+   HYPRE_Int      iw_size, pfree;
+   HYPRE_Int      *pe, *len, *elen, *status;
+   /* degree lists */
+   HYPRE_Int      *degree, *head, *next, *last;
+   /* marker of L_p, |L_e \ L_p| for the current step and a row buffer */
+   HYPRE_Int      *mark, *wstamp, *wval, *list;
+
+   iw_size = 2 * A_i[n] + n;
+   iw = hypre_TAlloc(HYPRE_Int, iw_size, HYPRE_MEMORY_HOST);
+   pe = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   len = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   elen = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   status = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   degree = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   head = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   next = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   last = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   mark = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   wstamp = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   wval = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   list = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* initial quotient graph is the graph of A */
+   pfree = 0;
+   for(i = 0 ; i < n ; i ++)
+   {
+      pe[i] = pfree;
+      for(j = A_i[i] ; j < A_i[i+1] ; j ++)
+      {
+         if(A_j[j] != i)
+         {
+            iw[pfree++] = A_j[j];
+         }
+      }
+      len[i] = pfree - pe[i];
+      elen[i] = 0;
+      status[i] = 0;
+      degree[i] = hypre_min(len[i], n - 1);
+      head[i] = -1;
+      mark[i] = -1;
+      wstamp[i] = -1;
+   }
+   for(i = 0 ; i < n ; i ++)
+   {
+      deg = degree[i];
+      next[i] = head[deg];
+      last[i] = -1;
+      if(head[deg] >= 0)
+      {
+         last[head[deg]] = i;
+      }
+      head[deg] = i;
+   }
+
+   mindeg = 0;
+   for(k = 0 ; k < n ; k ++)
+   {
+      /* pick the variable of minimum degree */
+      while(head[mindeg] < 0)
+      {
+         mindeg++;
+      }
+      p = head[mindeg];
+      head[mindeg] = next[p];
+      if(next[p] >= 0)
+      {
+         last[next[p]] = -1;
+      }
+      perm[k] = p;
+
+      /* make sure L_p fits at the end of iw, compress otherwise */
+      bound = len[p] - elen[p];
+      for(q = pe[p] ; q < pe[p] + elen[p] ; q ++)
+      {
+         if(status[iw[q]] == 1)
+         {
+            bound += len[iw[q]];
+         }
+      }
+      if(pfree + bound > iw_size)
+      {
+         live = 0;
+         for(i = 0 ; i < n ; i ++)
+         {
+            if(status[i] >= 0)
+            {
+               live += len[i];
+            }
+         }
+         iw_size = hypre_max(iw_size, 2 * (live + bound));
+         iw_new = hypre_TAlloc(HYPRE_Int, iw_size, HYPRE_MEMORY_HOST);
+         pfree = 0;
+         for(i = 0 ; i < n ; i ++)
+         {
+            if(status[i] >= 0)
+            {
+               for(q = 0 ; q < len[i] ; q ++)
+               {
+                  iw_new[pfree + q] = iw[pe[i] + q];
+               }
+               pe[i] = pfree;
+               pfree += len[i];
+            }
+         }
+         hypre_TFree(iw, HYPRE_MEMORY_HOST);
+         iw = iw_new;
+      }
+
+      /* form L_p, the elements adjacent to p are absorbed */
+      lenp = pfree;
+      mark[p] = k;
+      for(q = pe[p] ; q < pe[p] + elen[p] ; q ++)
+      {
+         e = iw[q];
+         if(status[e] == 1)
+         {
+            for(j = pe[e] ; j < pe[e] + len[e] ; j ++)
+            {
+               v = iw[j];
+               if(status[v] == 0 && mark[v] != k)
+               {
+                  mark[v] = k;
+                  iw[pfree++] = v;
+               }
+            }
+            status[e] = -1;
+         }
+      }
+      for(q = pe[p] + elen[p] ; q < pe[p] + len[p] ; q ++)
+      {
+         v = iw[q];
+         if(status[v] == 0 && mark[v] != k)
+         {
+            mark[v] = k;
+            iw[pfree++] = v;
+         }
+      }
+      status[p] = 1;
+      pe[p] = lenp;
+      len[p] = pfree - lenp;
+      elen[p] = 0;
+      lenp = len[p];
+
+      /* |L_e \ L_p| of the other elements adjacent to L_p */
+      for(q = pe[p] ; q < pe[p] + lenp ; q ++)
+      {
+         i = iw[q];
+         /* remove i from its degree list */
+         if(last[i] >= 0)
+         {
+            next[last[i]] = next[i];
+         }
+         else
+         {
+            head[degree[i]] = next[i];
+         }
+         if(next[i] >= 0)
+         {
+            last[next[i]] = last[i];
+         }
+         for(j = pe[i] ; j < pe[i] + elen[i] ; j ++)
+         {
+            e = iw[j];
+            if(status[e] == 1 && e != p)
+            {
+               if(wstamp[e] != k)
+               {
+                  wstamp[e] = k;
+                  wval[e] = len[e];
+               }
+               wval[e]--;
+            }
+         }
+      }
+
+      /* update the lists and the approximate degrees of L_p */
+      for(q = pe[p] ; q < pe[p] + lenp ; q ++)
+      {
+         i = iw[q];
+         nel = 0;
+         ext = 0;
+         for(j = pe[i] ; j < pe[i] + elen[i] ; j ++)
+         {
+            e = iw[j];
+            if(status[e] == 1 && e != p)
+            {
+               if(wval[e] == 0)
+               {
+                  /* L_e is in L_p, aggressive absorption */
+                  status[e] = -1;
+               }
+               else
+               {
+                  list[nel++] = e;
+                  ext += wval[e];
+               }
+            }
+         }
+         list[nel++] = p;
+         nvar = nel;
+         for(j = pe[i] + elen[i] ; j < pe[i] + len[i] ; j ++)
+         {
+            v = iw[j];
+            /* variables in L_p are covered by p */
+            if(status[v] == 0 && mark[v] != k)
+            {
+               list[nvar++] = v;
+            }
+         }
+         /* i is in L_p since p or an absorbed element was in its list,
+          * so the list does not grow
+          */
+         for(j = 0 ; j < nvar ; j ++)
+         {
+            iw[pe[i] + j] = list[j];
+         }
+         elen[i] = nel;
+         len[i] = nvar;
+
+         deg = (nvar - nel) + (lenp - 1) + ext;
+         deg = hypre_min(deg, degree[i] + lenp - 1);
+         deg = hypre_min(deg, n - k - 2);
+         deg = hypre_max(deg, 0);
+         degree[i] = deg;
+         next[i] = head[deg];
+         last[i] = -1;
+         if(head[deg] >= 0)
+         {
+            last[head[deg]] = i;
+         }
+         head[deg] = i;
+         if(deg < mindeg)
+         {
+            mindeg = deg;
+         }
+      }
+   }
+
+   /* free */
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+   hypre_TFree(pe, HYPRE_MEMORY_HOST);
+   hypre_TFree(len, HYPRE_MEMORY_HOST);
+   hypre_TFree(elen, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+   hypre_TFree(degree, HYPRE_MEMORY_HOST);
+   hypre_TFree(head, HYPRE_MEMORY_HOST);
+   hypre_TFree(next, HYPRE_MEMORY_HOST);
+   hypre_TFree(last, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+   hypre_TFree(wstamp, HYPRE_MEMORY_HOST);
+   hypre_TFree(wval, HYPRE_MEMORY_HOST);
+   hypre_TFree(list, HYPRE_MEMORY_HOST);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILULocalNDOrder
+ *--------------------------------------------------------------------------*/
+
+/* This function computes a nested dissection ordering of a symmetric csr
+ * matrix (entire).  A part of the graph is split with the level structure
+ * rooted at a pseudo-peripheral node: the nodes of the middle level that are
+ * adjacent to the next level form the separator, the levels before it (and
+ * the rest of the middle level) and the levels after it are the two halves.
+ * The separator is ordered after both halves, so the halves are independent
+ * in the factors and in the triangular solves.  Disconnected parts are split
+ * without separator.  Parts with at most ILU_ND_LEAF_SIZE nodes, or with less
+ * than three levels, are kept in their order.
+ * A: the csr matrix, A_data is not needed
+ * perm: the permutation array, space should be allocated outside
+ */
+HYPRE_Int
+hypre_ILULocalNDOrder( hypre_CSRMatrix *A, HYPRE_Int *perm)
+{
+   HYPRE_Int      i, j, v, lo, hi, size, root, nreach, nlev, newnlev, mid, count;
+   HYPRE_Int      na, nb, ns, deg, min_degree, cand;
+   HYPRE_Int      *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Int      n           = hypre_CSRMatrixNumRows(A);
+   /* the part of node v is perm[part[v]], ... , -1 for separators */
+   HYPRE_Int      *part, *level, *queue, *work;
+   /* stack of parts [lo, hi) */
+   HYPRE_Int      *stack;
+   HYPRE_Int      nstack;
+
+   part = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   queue = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   work = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   stack = hypre_TAlloc(HYPRE_Int, 2*n+2, HYPRE_MEMORY_HOST);
+
+   for(i = 0 ; i < n ; i ++)
+   {
+      perm[i] = i;
+   }
+   nstack = 0;
+   stack[nstack++] = 0;
+   stack[nstack++] = n;
+
+   while(nstack > 0)
+   {
+      hi = stack[--nstack];
+      lo = stack[--nstack];
+      size = hi - lo;
+      if(size <= ILU_ND_LEAF_SIZE)
+      {
+         continue;
+      }
+
+      /* start from a node of minimum degree in this part */
+      min_degree = n;
+      root = perm[lo];
+      for(i = lo ; i < hi ; i ++)
+      {
+         v = perm[i];
+         deg = 0;
+         for(j = A_i[v] ; j < A_i[v+1] ; j ++)
+         {
+            if(A_j[j] != v && part[A_j[j]] == lo)
+            {
+               deg++;
+            }
+         }
+         if(deg < min_degree)
+         {
+            min_degree = deg;
+            root = v;
+         }
+      }
+
+      /* find a pseudo-peripheral node */
+      hypre_ILULocalNDBuildLevel(A, root, lo, hi, part, perm, level, queue, &nreach, &newnlev);
+      nlev = newnlev - 1;
+      while(nreach == size && newnlev > nlev)
+      {
+         nlev = newnlev;
+         min_degree = n;
+         cand = root;
+         for(i = nreach - 1 ; i >= 0 && level[queue[i]] == nlev - 1 ; i --)
+         {
+            v = queue[i];
+            deg = 0;
+            for(j = A_i[v] ; j < A_i[v+1] ; j ++)
+            {
+               if(A_j[j] != v && part[A_j[j]] == lo)
+               {
+                  deg++;
+               }
+            }
+            if(deg < min_degree)
+            {
+               min_degree = deg;
+               cand = v;
+            }
+         }
+         hypre_ILULocalNDBuildLevel(A, cand, lo, hi, part, perm, level, queue, &nreach, &newnlev);
+         if(newnlev > nlev)
+         {
+            root = cand;
+         }
+         else
+         {
+            /* restore the level structure of root */
+            hypre_ILULocalNDBuildLevel(A, root, lo, hi, part, perm, level, queue, &nreach, &newnlev);
+         }
+      }
+      nlev = newnlev;
+
+      na = nb = ns = 0;
+      if(nreach < size)
+      {
+         /* not connected: the component of root and the rest */
+         for(i = 0 ; i < nreach ; i ++)
+         {
+            work[na++] = queue[i];
+         }
+         for(i = lo ; i < hi ; i ++)
+         {
+            if(level[perm[i]] < 0)
+            {
+               work[nreach + nb++] = perm[i];
+            }
+         }
+      }
+      else if(nlev < 3)
+      {
+         continue;
+      }
+      else
+      {
+         /* the middle level, keep at least one level on each side */
+         count = 0;
+         for(mid = 0 ; mid < nlev - 2 ; mid ++)
+         {
+            while(count < size && level[queue[count]] == mid)
+            {
+               count++;
+            }
+            if(2 * count >= size)
+            {
+               break;
+            }
+         }
+         mid = hypre_max(mid, 1);
+         /* separator: nodes of the middle level adjacent to the next level */
+         for(i = 0 ; i < size ; i ++)
+         {
+            v = queue[i];
+            if(level[v] < mid)
+            {
+               work[na++] = v;
+            }
+            else if(level[v] == mid)
+            {
+               for(j = A_i[v] ; j < A_i[v+1] ; j ++)
+               {
+                  if(part[A_j[j]] == lo && level[A_j[j]] == mid + 1)
+                  {
+                     break;
+                  }
+               }
+               if(j < A_i[v+1])
+               {
+                  queue[ns++] = v;
+               }
+               else
+               {
+                  work[na++] = v;
+               }
+            }
+         }
+         for(i = 0 ; i < size ; i ++)
+         {
+            v = perm[lo + i];
+            if(level[v] > mid)
+            {
+               work[na + nb++] = v;
+            }
+         }
+         for(i = 0 ; i < ns ; i ++)
+         {
+            work[na + nb + i] = queue[i];
+         }
+      }
+
+      /* new order of this part: first half, second half, separator */
+      for(i = 0 ; i < size ; i ++)
+      {
+         v = work[i];
+         perm[lo + i] = v;
+         if(i < na)
+         {
+            part[v] = lo;
+         }
+         else if(i < na + nb)
+         {
+            part[v] = lo + na;
+         }
+         else
+         {
+            part[v] = -1;
+         }
+      }
+      stack[nstack++] = lo;
+      stack[nstack++] = lo + na;
+      stack[nstack++] = lo + na;
+      stack[nstack++] = lo + na + nb;
+   }
+
+   /* free */
+   hypre_TFree(part, HYPRE_MEMORY_HOST);
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+   hypre_TFree(queue, HYPRE_MEMORY_HOST);
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+   hypre_TFree(stack, HYPRE_MEMORY_HOST);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILULocalNDBuildLevel
+ *--------------------------------------------------------------------------*/
+
+/* This function builds the level structure of a part of the graph in the
+ * nested dissection ordering
+ * A: the csr matrix, A_data is not needed
+ * root: the root of the level structure
+ * lo, hi: the part is perm[lo], ..., perm[hi-1], with part[v] = lo
+ * level: on return, the level of the nodes in the part, -1 if not reached
+ * queue: on return, the nodes reached, level by level
+ * nreachp: number of nodes reached
+ * nlevp: number of levels
+ */
+HYPRE_Int
+hypre_ILULocalNDBuildLevel(hypre_CSRMatrix *A, HYPRE_Int root, HYPRE_Int lo, HYPRE_Int hi,
+                           HYPRE_Int *part, HYPRE_Int *perm, HYPRE_Int *level,
+                           HYPRE_Int *queue, HYPRE_Int *nreachp, HYPRE_Int *nlevp)
+{
+   HYPRE_Int      i, j, v, w, nreach;
+   HYPRE_Int      *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j        = hypre_CSRMatrixJ(A);
+
+   for(i = lo ; i < hi ; i ++)
+   {
+      level[perm[i]] = -1;
+   }
+   level[root] = 0;
+   queue[0] = root;
+   nreach = 1;
+   for(i = 0 ; i < nreach ; i ++)
+   {
+      v = queue[i];
+      for(j = A_i[v] ; j < A_i[v+1] ; j ++)
+      {
+         w = A_j[j];
+         if(part[w] == lo && level[w] < 0)
+         {
+            level[w] = level[v] + 1;
+            queue[nreach++] = w;
+         }
+      }
+   }
+
+   *nreachp = nreach;
+   *nlevp = level[queue[nreach-1]] + 1;
+   return hypre_error_flag;
+}
+
 /* NSH create and solve and help functions */
 
 /* Create */
@@ -51,8 +51,31 @@ typedef struct hypre_ParILUData_struct
    /* temp vectors for solve phase */
    hypre_ParVector      *Utemp;
    hypre_ParVector      *Ftemp;
+   hypre_ParVector      *Xtemp;
    HYPRE_Real           *uext;
    HYPRE_Real           *fext;
+
+   /* level schedules of the L and U solves (threaded runs only) */
+   HYPRE_Int            num_lower_levels;
+   HYPRE_Int            *lower_level_ptr;
+   HYPRE_Int            *lower_level_rows;
+   HYPRE_Int            num_upper_levels;
+   HYPRE_Int            *upper_level_ptr;
+   HYPRE_Int            *upper_level_rows;
+
+   /* triangular solves: exact (1) or Jacobi sweeps (0) */
+   HYPRE_Int            tri_solve;
+   HYPRE_Int            lower_jacobi_iters;
+   HYPRE_Int            upper_jacobi_iters;
+
+   /* fixed-point sweeps of the iterative ILU(k) factorization (ilu_type 2) */
+   HYPRE_Int            factor_sweeps;
+
+   /* block ILU(k) of ilu_type 0 for block_size > 1, matD then holds the
+    * inverted diagonal blocks and perm the block ordering */
+   HYPRE_Int            block_size;
+   hypre_ParCSRBlockMatrix *matLB;
+   hypre_ParCSRBlockMatrix *matUB;
    
    /* data structure sor solving Schur System */
    HYPRE_Solver         schur_solver;
@@ -121,8 +144,22 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
+#define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
 #define hypre_ParILUDataUExt(ilu_data)                         ((ilu_data) -> uext)
 #define hypre_ParILUDataFExt(ilu_data)                         ((ilu_data) -> fext)
+#define hypre_ParILUDataNumLowerLevels(ilu_data)               ((ilu_data) -> num_lower_levels)
+#define hypre_ParILUDataLowerLevelPtr(ilu_data)                ((ilu_data) -> lower_level_ptr)
+#define hypre_ParILUDataLowerLevelRows(ilu_data)               ((ilu_data) -> lower_level_rows)
+#define hypre_ParILUDataNumUpperLevels(ilu_data)               ((ilu_data) -> num_upper_levels)
+#define hypre_ParILUDataUpperLevelPtr(ilu_data)                ((ilu_data) -> upper_level_ptr)
+#define hypre_ParILUDataUpperLevelRows(ilu_data)               ((ilu_data) -> upper_level_rows)
+#define hypre_ParILUDataTriSolve(ilu_data)                     ((ilu_data) -> tri_solve)
+#define hypre_ParILUDataLowerJacobiIters(ilu_data)             ((ilu_data) -> lower_jacobi_iters)
+#define hypre_ParILUDataUpperJacobiIters(ilu_data)             ((ilu_data) -> upper_jacobi_iters)
+#define hypre_ParILUDataFactorSweeps(ilu_data)                 ((ilu_data) -> factor_sweeps)
+#define hypre_ParILUDataBlockSize(ilu_data)                    ((ilu_data) -> block_size)
+#define hypre_ParILUDataMatLB(ilu_data)                        ((ilu_data) -> matLB)
+#define hypre_ParILUDataMatUB(ilu_data)                        ((ilu_data) -> matUB)
 #define hypre_ParILUDataSchurSolver(ilu_data)                  ((ilu_data) -> schur_solver)
 #define hypre_ParILUDataSchurPrecond(ilu_data)                 ((ilu_data) -> schur_precond)
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
@@ -167,6 +204,7 @@ typedef struct hypre_ParILUData_struct
 
 #define MAT_TOL 1e-14
 #define EXPAND_FACT 1.3
+#define ILU_ND_LEAF_SIZE 8
 
 
 
@@ -30,6 +30,7 @@ hypre_ILUSetup( void               *ilu_vdata,
    HYPRE_Int            nLU                  = hypre_ParILUDataNLU(ilu_data);
    HYPRE_Int            nI                   = hypre_ParILUDataNI(ilu_data);
    HYPRE_Int            fill_level           = hypre_ParILUDataLfil(ilu_data);
+   HYPRE_Int            factor_sweeps        = hypre_ParILUDataFactorSweeps(ilu_data);
    HYPRE_Int            max_row_elmts        = hypre_ParILUDataMaxRowNnz(ilu_data);
    HYPRE_Real           *droptol             = hypre_ParILUDataDroptol(ilu_data);
    HYPRE_Int            *CF_marker_array     = hypre_ParILUDataCFMarkerArray(ilu_data);
@@ -43,6 +44,15 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParCSRMatrix   *matU                = hypre_ParILUDataMatU(ilu_data);
    hypre_ParCSRMatrix   *matS                = hypre_ParILUDataMatS(ilu_data);
    //   hypre_ParCSRMatrix   *matM                = NULL;
+
+   /* block ILU(k) */
+   HYPRE_Int            block_size           = hypre_ParILUDataBlockSize(ilu_data);
+   HYPRE_Int            use_block            = 0;
+   HYPRE_Int            local_fit;
+   hypre_ParCSRBlockMatrix *matAB            = NULL;
+   hypre_ParCSRBlockMatrix *matLB            = hypre_ParILUDataMatLB(ilu_data);
+   hypre_ParCSRBlockMatrix *matUB            = hypre_ParILUDataMatUB(ilu_data);
+   hypre_CSRMatrix      *pattern;
    HYPRE_Real           nnzS/* total nnz in S */;
    HYPRE_Int            nnzS_offd;
    HYPRE_Int            size_C/* total size of coarse grid */;
@@ -78,6 +88,8 @@ hypre_ILUSetup( void               *ilu_vdata,
 
    /* ----- begin -----*/
 
+   HYPRE_ANNOTATION_BEGIN("ILU.setup");
+
    //num_threads = hypre_NumThreads();
 
    hypre_MPI_Comm_size(comm,&num_procs);
@@ -104,6 +116,19 @@ hypre_ILUSetup( void               *ilu_vdata,
       hypre_TFree(matD, HYPRE_MEMORY_HOST);
       matD = NULL;
    }
+   if(matLB)
+   {
+      hypre_ParCSRBlockMatrixDestroy(matLB);
+      matLB = NULL;
+      /* perm is an ordering of the blocks, get a new one */
+      hypre_TFree(perm, HYPRE_MEMORY_DEVICE);
+      perm = NULL;
+   }
+   if(matUB)
+   {
+      hypre_ParCSRBlockMatrixDestroy(matUB);
+      matUB = NULL;
+   }
    if(CF_marker_array)
    {
       hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
@@ -111,6 +136,14 @@ hypre_ILUSetup( void               *ilu_vdata,
    }
 
 
+   /* clear old level schedules */
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataNumLowerLevels(ilu_data) = 0;
+   hypre_ParILUDataNumUpperLevels(ilu_data) = 0;
+
    /* clear old l1_norm data, if created */
    if(hypre_ParILUDataL1Norms(ilu_data))
    {
@@ -131,6 +164,11 @@ hypre_ILUSetup( void               *ilu_vdata,
       hypre_ParVectorDestroy(hypre_ParILUDataFTemp(ilu_data));
       hypre_ParILUDataFTemp(ilu_data) = NULL;
    }
+   if (hypre_ParILUDataXTemp(ilu_data))
+   {
+      hypre_ParVectorDestroy(hypre_ParILUDataXTemp(ilu_data));
+      hypre_ParILUDataXTemp(ilu_data) = NULL;
+   }
    if (hypre_ParILUDataUExt(ilu_data))
    {
       hypre_TFree(hypre_ParILUDataUExt(ilu_data), HYPRE_MEMORY_HOST);
@@ -205,13 +243,41 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParVectorInitialize(Ftemp);
    hypre_ParVectorSetPartitioningOwner(Ftemp,0);
    hypre_ParILUDataFTemp(ilu_data) = Ftemp;
+
+   /* second iterate of the Jacobi sweeps of the iterative triangular solves */
+   if (hypre_ParILUDataTriSolve(ilu_data) == 0)
+   {
+      hypre_ParILUDataXTemp(ilu_data) = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+            hypre_ParCSRMatrixGlobalNumRows(A),
+            hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(hypre_ParILUDataXTemp(ilu_data));
+      hypre_ParVectorSetPartitioningOwner(hypre_ParILUDataXTemp(ilu_data),0);
+   }
    /* set matrix, solution and rhs pointers */
    matA = A;
    F_array = f;
    U_array = u;
 
+   /* block ILU(k) if the local rows of all processes consist of whole blocks */
+   if(ilu_type == 0 && block_size > 1)
+   {
+      local_fit = (n % block_size == 0 &&
+                   hypre_ParCSRMatrixFirstRowIndex(matA) % block_size == 0);
+      hypre_MPI_Allreduce(&local_fit, &use_block, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+      if(!use_block && my_id == 0 && print_level > 0)
+      {
+         hypre_printf("ILU SETUP: rows do not form blocks of size %d, using scalar ILU\n", block_size);
+      }
+   }
+
    // create perm arary if necessary
-   if(perm == NULL)
+   if(use_block)
+   {
+      /* ordering of the block rows */
+      matAB = hypre_ParCSRBlockMatrixConvertFromParCSRMatrix(matA, block_size);
+      hypre_ILUGetLocalBlockPerm(matAB, &perm, &nLU, reordering_type);
+   }
+   else if(perm == NULL)
    {
       switch(ilu_type)
       {
@@ -233,10 +299,20 @@ hypre_ILUSetup( void               *ilu_vdata,
    /* factorization */
    switch(ilu_type)
    {
-      case 0:  hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end); //BJ + hypre_iluk()
+      case 0:  if(use_block)
+               {
+                  hypre_ILUSetupBlockILUK(matAB, fill_level, perm, &matLB, &matD, &matUB); //BJ + block hypre_iluk()
+                  hypre_ParCSRBlockMatrixDestroy(matAB);
+               }
+               else
+               {
+                  hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end); //BJ + hypre_iluk()
+               }
                break;
       case 1:  hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end); //BJ + hypre_ilut()
                break;
+      case 2:  hypre_ILUSetupParILUK(matA, fill_level, factor_sweeps, perm, perm, &matL, &matD, &matU, &u_end); //BJ + iterative hypre_iluk()
+               break;
       case 10: hypre_ILUSetupILUK(matA, fill_level, perm, perm, nLU, nLU, &matL, &matD, &matU, &matS, &u_end); //GMRES + hypre_iluk()
                break;
       case 11: hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, nLU, nLU, &matL, &matD, &matU, &matS, &u_end); //GMRES + hypre_ilut()
@@ -296,6 +372,7 @@ hypre_ILUSetup( void               *ilu_vdata,
             if (schur_precond_gotten != (schur_precond))
             {
                hypre_printf("Schur complement got bad precond\n");
+               HYPRE_ANNOTATION_END("ILU.setup");
                return(-1);
             }
 
@@ -383,6 +460,47 @@ hypre_ILUSetup( void               *ilu_vdata,
       default:
          break;
    }
+   /* level schedules for threaded triangular solves with the full factors */
+   switch(ilu_type)
+   {
+      case 10: case 11: case 20: case 21: case 40: case 41:
+         break;
+      default:
+         /* the iterative triangular solves of block Jacobi do not need them */
+         if (matLB && hypre_NumThreads() > 1)
+         {
+            /* schedules of the block rows, from the pattern of the blocks */
+            pattern = hypre_CSRMatrixCreate(nLU, nLU, 0);
+            hypre_CSRMatrixI(pattern) = hypre_CSRBlockMatrixI(hypre_ParCSRBlockMatrixDiag(matLB));
+            hypre_CSRMatrixJ(pattern) = hypre_CSRBlockMatrixJ(hypre_ParCSRBlockMatrixDiag(matLB));
+            hypre_ILUSetupLevelSchedule(pattern, 1,
+                                        &hypre_ParILUDataNumLowerLevels(ilu_data),
+                                        &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                                        &hypre_ParILUDataLowerLevelRows(ilu_data));
+            hypre_CSRMatrixI(pattern) = hypre_CSRBlockMatrixI(hypre_ParCSRBlockMatrixDiag(matUB));
+            hypre_CSRMatrixJ(pattern) = hypre_CSRBlockMatrixJ(hypre_ParCSRBlockMatrixDiag(matUB));
+            hypre_ILUSetupLevelSchedule(pattern, 0,
+                                        &hypre_ParILUDataNumUpperLevels(ilu_data),
+                                        &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                                        &hypre_ParILUDataUpperLevelRows(ilu_data));
+            hypre_CSRMatrixI(pattern) = NULL;
+            hypre_CSRMatrixJ(pattern) = NULL;
+            hypre_CSRMatrixDestroy(pattern);
+         }
+         else if (hypre_NumThreads() > 1 &&
+             (hypre_ParILUDataTriSolve(ilu_data) || ilu_type == 30 || ilu_type == 31))
+         {
+            hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matL), 1,
+                                        &hypre_ParILUDataNumLowerLevels(ilu_data),
+                                        &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                                        &hypre_ParILUDataLowerLevelRows(ilu_data));
+            hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matU), 0,
+                                        &hypre_ParILUDataNumUpperLevels(ilu_data),
+                                        &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                                        &hypre_ParILUDataUpperLevelRows(ilu_data));
+         }
+         break;
+   }
    /* set pointers to ilu data */
    hypre_ParILUDataMatA(ilu_data)            = matA;
    hypre_ParILUDataF(ilu_data)               = F_array;
@@ -391,6 +509,8 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParILUDataMatD(ilu_data)            = matD;
    hypre_ParILUDataMatU(ilu_data)            = matU;
    hypre_ParILUDataMatS(ilu_data)            = matS;
+   hypre_ParILUDataMatLB(ilu_data)           = matLB;
+   hypre_ParILUDataMatUB(ilu_data)           = matUB;
    hypre_ParILUDataCFMarkerArray(ilu_data)   = CF_marker_array;
    hypre_ParILUDataPerm(ilu_data)            = perm;
    hypre_ParILUDataQPerm(ilu_data)           = qperm;
@@ -431,10 +551,21 @@ hypre_ILUSetup( void               *ilu_vdata,
       }
    }
 
-   (ilu_data -> operator_complexity) =  ((HYPRE_Real)size_C + nnzS +
-         hypre_ParCSRMatrixDNumNonzeros(matL) +
-         hypre_ParCSRMatrixDNumNonzeros(matU)) /
-      hypre_ParCSRMatrixDNumNonzeros(matA);
+   if(matLB)
+   {
+      /* bs x bs values per diagonal block and per block of L and U */
+      (ilu_data -> operator_complexity) =  ((HYPRE_Real)size_C * block_size +
+            (hypre_ParCSRBlockMatrixDNumNonzeros(matLB) +
+             hypre_ParCSRBlockMatrixDNumNonzeros(matUB)) * block_size * block_size) /
+         hypre_ParCSRMatrixDNumNonzeros(matA);
+   }
+   else
+   {
+      (ilu_data -> operator_complexity) =  ((HYPRE_Real)size_C + nnzS +
+            hypre_ParCSRMatrixDNumNonzeros(matL) +
+            hypre_ParCSRMatrixDNumNonzeros(matU)) /
+         hypre_ParCSRMatrixDNumNonzeros(matA);
+   }
    if ((my_id == 0) && (print_level > 0))
    {
       hypre_printf("ILU SETUP: operator complexity = %f  \n", ilu_data -> operator_complexity);
@@ -455,6 +586,80 @@ hypre_ILUSetup( void               *ilu_vdata,
    rel_res_norms = hypre_CTAlloc(HYPRE_Real, (ilu_data -> max_iter), HYPRE_MEMORY_HOST);
    (ilu_data -> rel_res_norms) = rel_res_norms;
 
+   HYPRE_ANNOTATION_END("ILU.setup");
+
+   return hypre_error_flag;
+}
+
+/* Level schedule of a triangular solve
+ * T = strictly lower (lower = 1) or strictly upper (lower = 0) triangular factor
+ * A row depends only on rows of earlier levels, so the rows of one level can
+ * be solved in parallel.  Level l consists of the rows
+ * level_rows[level_ptr[l]], ..., level_rows[level_ptr[l+1]-1], in increasing
+ * order.  The levels are computed by one sweep in the order of the sequential
+ * solve; no schedule is returned (num_levels = 0) if T is not triangular.
+ */
+HYPRE_Int
+hypre_ILUSetupLevelSchedule(hypre_CSRMatrix *T, HYPRE_Int lower, HYPRE_Int *num_levels_ptr,
+      HYPRE_Int **level_ptr_ptr, HYPRE_Int **level_rows_ptr)
+{
+   HYPRE_Int      n = hypre_CSRMatrixNumRows(T);
+   HYPRE_Int      *T_i = hypre_CSRMatrixI(T);
+   HYPRE_Int      *T_j = hypre_CSRMatrixJ(T);
+   HYPRE_Int      *level, *level_ptr, *level_rows;
+   HYPRE_Int      num_levels = 0;
+   HYPRE_Int      i, ii, j, col, lev;
+
+   *num_levels_ptr = 0;
+   *level_ptr_ptr  = NULL;
+   *level_rows_ptr = NULL;
+
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < n; ii++)
+   {
+      i = lower ? ii : n - 1 - ii;
+      lev = 0;
+      for (j = T_i[i]; j < T_i[i+1]; j++)
+      {
+         col = T_j[j];
+         if (lower ? (col >= i) : (col <= i))
+         {
+            hypre_TFree(level, HYPRE_MEMORY_HOST);
+            return hypre_error_flag;
+         }
+         lev = hypre_max(lev, level[col] + 1);
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* bucket the rows by level */
+   level_ptr  = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_ptr[level[i] + 1]++;
+   }
+   for (lev = 0; lev < num_levels; lev++)
+   {
+      level_ptr[lev + 1] += level_ptr[lev];
+   }
+   for (i = 0; i < n; i++)
+   {
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (lev = num_levels; lev > 0; lev--)
+   {
+      level_ptr[lev] = level_ptr[lev - 1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levels_ptr = num_levels;
+   *level_ptr_ptr  = level_ptr;
+   *level_rows_ptr = level_rows;
+
    return hypre_error_flag;
 }
 
@@ -2050,6 +2255,649 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE
    return hypre_error_flag;
 }
 
+/* Iterative ILU(k), the fine-grained parallel ILU of Chow and Patel
+ * A: input matrix
+ * lfil: level of fill, the pattern is the ILU(k) pattern of hypre_ILUSetupILUKSymbolic
+ * num_sweeps: number of fixed-point sweeps
+ * perm: permutation array indicating ordering of factorization. Perm could come from a
+ *    CF_marker: array or a reordering routine.
+ * qperm: permutation array for column
+ * Lptr, Dptr, Uptr: L, D, U factors, stored as in hypre_ILUSetupILUK.
+ *
+ * All rows are factored (no Schur complement).  The nonzeros of L and U solve
+ *    (LU)_ij = a_ij on the pattern:
+ *       l_ij = (a_ij - sum_{k<j} l_ik u_kj) / u_jj    for j < i
+ *       u_ij =  a_ij - sum_{k<i} l_ik u_kj            for j >= i
+ *    These equations are solved by Jacobi sweeps starting from L = A_L D_A^{-1}
+ *    and U = D_A + A_U.  A sweep only reads the values of the previous one, so
+ *    the nonzeros of a sweep are computed in parallel and the factors do not
+ *    depend on the number of threads.  After enough sweeps they are the ILU(k)
+ *    factors.  U is kept by columns during the sweeps for the inner products.
+ */
+HYPRE_Int
+hypre_ILUSetupParILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int num_sweeps,
+      HYPRE_Int *perm, HYPRE_Int *qperm, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr,
+      hypre_ParCSRMatrix **Uptr, HYPRE_Int **u_end)
+{
+   /*
+    * 1: Setup and create buffers
+    * matL/U: the ParCSR matrix for L and U
+    * L/U_diag: the diagonal csr matrix of matL/U
+    * UT_*: U with its diagonal stored by columns, rows sorted and the
+    *    diagonal last in each column
+    * U_pos: position in UT of each entry of U_diag
+    * A_L, A_UT: entries of A on the pattern of L and UT
+    * L/UT_old, L/UT_new: values of the previous and the current sweep
+    * iw =  working array store the reverse of active col number
+    */
+   HYPRE_Real              local_nnz, total_nnz;
+   HYPRE_Int               i, ii, j, k, kl, ku, k_end, q, col, sweep;
+   HYPRE_Real              s, piv;
+   HYPRE_Int               *iw;
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+
+   /* data objects for A */
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real              *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Real              *L_diag_data   = NULL;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j      = NULL;
+   HYPRE_Real              *U_diag_data   = NULL;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j      = NULL;
+   HYPRE_Int               *S_diag_i;
+   HYPRE_Int               *S_diag_j      = NULL;
+
+   /* U by columns and the sweep values */
+   HYPRE_Int               *UT_i;
+   HYPRE_Int               *UT_j;
+   HYPRE_Int               *UT_next;
+   HYPRE_Int               *U_pos;
+   HYPRE_Real              *A_L;
+   HYPRE_Real              *A_UT;
+   HYPRE_Real              *L_old, *L_new, *UT_old, *UT_new, *tmp;
+
+   /* problem size */
+   HYPRE_Int               n;
+   HYPRE_Int               nnz_L;
+   HYPRE_Int               nnz_UT;
+   /* reverse permutation array */
+   HYPRE_Int               *rperm;
+
+   /* start setup */
+   n =  hypre_CSRMatrixNumRows(A_diag);
+
+   D_data = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_DEVICE);
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, (n+1), HYPRE_MEMORY_DEVICE);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, (n+1), HYPRE_MEMORY_DEVICE);
+   S_diag_i = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_DEVICE);
+
+   /*
+    * 2: Symbolic factorization
+    * setup iw and rperm first
+    */
+   iw = hypre_CTAlloc(HYPRE_Int, 4*n, HYPRE_MEMORY_HOST);
+   rperm = iw + 3*n;
+   L_diag_i[0] = U_diag_i[0] = S_diag_i[0] = 0;
+   for(i=0; i<n; i++)
+   {
+      rperm[qperm[i]] = i;
+   }
+
+   hypre_ILUSetupILUKSymbolic(n, A_diag_i, A_diag_j, lfil, perm, rperm, iw,
+         n, L_diag_i, U_diag_i, S_diag_i, &L_diag_j, &U_diag_j, &S_diag_j, u_end);
+
+   /* no Schur complement */
+   hypre_TFree(S_diag_i, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(S_diag_j, HYPRE_MEMORY_DEVICE);
+
+   nnz_L = L_diag_i[n];
+   nnz_UT = U_diag_i[n] + n;
+
+   /* the inner products merge sorted rows of L and columns of U */
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      hypre_qsort0(L_diag_j, L_diag_i[ii], L_diag_i[ii+1]-1);
+   }
+
+   /* U and its diagonal by columns, rows are added in increasing order */
+   UT_i = hypre_CTAlloc(HYPRE_Int, n+1, HYPRE_MEMORY_HOST);
+   UT_j = hypre_TAlloc(HYPRE_Int, nnz_UT, HYPRE_MEMORY_HOST);
+   UT_next = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   U_pos = hypre_TAlloc(HYPRE_Int, U_diag_i[n], HYPRE_MEMORY_HOST);
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      UT_i[ii+1]++;
+      for(k = U_diag_i[ii] ; k < U_diag_i[ii+1] ; k ++)
+      {
+         UT_i[U_diag_j[k]+1]++;
+      }
+   }
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      UT_i[ii+1] += UT_i[ii];
+      UT_next[ii] = UT_i[ii];
+   }
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      /* all entries of column ii are in rows before ii, so the diagonal is last */
+      UT_j[UT_next[ii]++] = ii;
+      for(k = U_diag_i[ii] ; k < U_diag_i[ii+1] ; k ++)
+      {
+         col = U_diag_j[k];
+         q = UT_next[col]++;
+         UT_j[q] = ii;
+         U_pos[k] = q;
+      }
+   }
+
+   /* copy data from A onto the pattern, iw are -1 after symbolic factorization */
+   A_L = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+   A_UT = hypre_CTAlloc(HYPRE_Real, nnz_UT, HYPRE_MEMORY_HOST);
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      i = perm[ii];
+      for(j = L_diag_i[ii] ; j < L_diag_i[ii+1] ; j ++)
+      {
+         iw[L_diag_j[j]] = j;
+      }
+      iw[ii] = UT_i[ii+1] - 1;
+      for(j = U_diag_i[ii] ; j < U_diag_i[ii+1] ; j ++)
+      {
+         iw[U_diag_j[j]] = U_pos[j];
+      }
+      for(j = A_diag_i[i] ; j < A_diag_i[i+1] ; j ++)
+      {
+         col = rperm[A_diag_j[j]];
+         /* A for sure to be inside the pattern */
+         if(col < ii)
+         {
+            A_L[iw[col]] = A_diag_data[j];
+         }
+         else
+         {
+            A_UT[iw[col]] = A_diag_data[j];
+         }
+      }
+      for(j = L_diag_i[ii] ; j < L_diag_i[ii+1] ; j ++)
+      {
+         iw[L_diag_j[j]] = -1;
+      }
+      iw[ii] = -1;
+      for(j = U_diag_i[ii] ; j < U_diag_i[ii+1] ; j ++)
+      {
+         iw[U_diag_j[j]] = -1;
+      }
+   }
+
+   /*
+    * 3: Fixed-point sweeps
+    * initial guess: L = A_L D_A^{-1}, U = D_A + A_U
+    */
+   L_old = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE);
+   L_new = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE);
+   UT_old = hypre_TAlloc(HYPRE_Real, nnz_UT, HYPRE_MEMORY_HOST);
+   UT_new = hypre_TAlloc(HYPRE_Real, nnz_UT, HYPRE_MEMORY_HOST);
+   for(q = 0 ; q < nnz_UT ; q ++)
+   {
+      UT_old[q] = A_UT[q];
+   }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,j,col,piv) HYPRE_SMP_SCHEDULE
+#endif
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      for(j = L_diag_i[ii] ; j < L_diag_i[ii+1] ; j ++)
+      {
+         col = L_diag_j[j];
+         piv = A_UT[UT_i[col+1]-1];
+         if(fabs(piv) < MAT_TOL)
+         {
+            piv = 1e-06;
+         }
+         L_old[j] = A_L[j] / piv;
+      }
+   }
+
+   for(sweep = 0 ; sweep < num_sweeps ; sweep ++)
+   {
+      /* L part: the entries of row ii before j have col < L_diag_j[j] */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,j,col,kl,ku,k_end,s,piv) HYPRE_SMP_SCHEDULE
+#endif
+      for(ii = 0 ; ii < n ; ii ++)
+      {
+         for(j = L_diag_i[ii] ; j < L_diag_i[ii+1] ; j ++)
+         {
+            col = L_diag_j[j];
+            s = A_L[j];
+            kl = L_diag_i[ii];
+            ku = UT_i[col];
+            k_end = UT_i[col+1] - 1;
+            while(kl < j && ku < k_end)
+            {
+               if(L_diag_j[kl] == UT_j[ku])
+               {
+                  s -= L_old[kl++] * UT_old[ku++];
+               }
+               else if(L_diag_j[kl] < UT_j[ku])
+               {
+                  kl++;
+               }
+               else
+               {
+                  ku++;
+               }
+            }
+            piv = UT_old[k_end];
+            if(fabs(piv) < MAT_TOL)
+            {
+               piv = 1e-06;
+            }
+            L_new[j] = s / piv;
+         }
+      }
+      /* U part: the entries of column ii before q have row < UT_j[q] */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,q,i,kl,ku,k_end,s) HYPRE_SMP_SCHEDULE
+#endif
+      for(ii = 0 ; ii < n ; ii ++)
+      {
+         for(q = UT_i[ii] ; q < UT_i[ii+1] ; q ++)
+         {
+            i = UT_j[q];
+            s = A_UT[q];
+            kl = L_diag_i[i];
+            k_end = L_diag_i[i+1];
+            ku = UT_i[ii];
+            while(kl < k_end && ku < q)
+            {
+               if(L_diag_j[kl] == UT_j[ku])
+               {
+                  s -= L_old[kl++] * UT_old[ku++];
+               }
+               else if(L_diag_j[kl] < UT_j[ku])
+               {
+                  kl++;
+               }
+               else
+               {
+                  ku++;
+               }
+            }
+            UT_new[q] = s;
+         }
+      }
+      tmp = L_old; L_old = L_new; L_new = tmp;
+      tmp = UT_old; UT_old = UT_new; UT_new = tmp;
+   }
+
+   /*
+    * 4: Finishing up and free
+    * diagonal part (we store the inverse)
+    */
+   L_diag_data = L_old;
+   hypre_TFree(L_new, HYPRE_MEMORY_DEVICE);
+   if(U_diag_i[n])
+   {
+      U_diag_data = hypre_TAlloc(HYPRE_Real, U_diag_i[n], HYPRE_MEMORY_DEVICE);
+   }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,k) HYPRE_SMP_SCHEDULE
+#endif
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      D_data[ii] = UT_old[UT_i[ii+1]-1];
+      if(fabs(D_data[ii]) < MAT_TOL)
+      {
+         D_data[ii] = 1e-06;
+      }
+      D_data[ii] = 1./ D_data[ii];
+      for(k = U_diag_i[ii] ; k < U_diag_i[ii+1] ; k ++)
+      {
+         U_diag_data[k] = UT_old[U_pos[k]];
+      }
+   }
+
+   matL = hypre_ParCSRMatrixCreate( comm,
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixRowStarts(A),
+         hypre_ParCSRMatrixColStarts(A),
+         0 /* num_cols_offd */,
+         L_diag_i[n],
+         0 /* num_nonzeros_offd */);
+
+   /* Have A own coarse_partitioning instead of L */
+   hypre_ParCSRMatrixSetColStartsOwner(matL,0);
+   hypre_ParCSRMatrixSetRowStartsOwner(matL,0);
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (L_diag_i[n]>0)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      /* we allocated some initial length, so free them */
+      hypre_TFree(L_diag_j, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(L_diag_data, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (L_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixRowStarts(A),
+         hypre_ParCSRMatrixColStarts(A),
+         0,
+         U_diag_i[n],
+         0 );
+
+   /* Have A own coarse_partitioning instead of U */
+   hypre_ParCSRMatrixSetColStartsOwner(matU,0);
+   hypre_ParCSRMatrixSetRowStartsOwner(matU,0);
+
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (U_diag_i[n]>0)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      /* we allocated some initial length, so free them */
+      hypre_TFree(U_diag_j, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (U_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   /* free */
+   hypre_TFree(iw,HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_i,HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_j,HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_next,HYPRE_MEMORY_HOST);
+   hypre_TFree(U_pos,HYPRE_MEMORY_HOST);
+   hypre_TFree(A_L,HYPRE_MEMORY_HOST);
+   hypre_TFree(A_UT,HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_old,HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_new,HYPRE_MEMORY_HOST);
+
+   /* set matrix pointers */
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+
+   return hypre_error_flag;
+}
+
+/* Block ILU(k)
+ * A: input block matrix, only its local (diag) part is factored
+ * lfil: level of fill-in, the pattern is the ILU(k) pattern of the blocks
+ * perm: permutation array of the block rows. Perm could come from a
+ *    reordering routine.
+ * Lptr, Dptr, Uptr: L, D, U factors.  L and U hold the bs x bs blocks of the
+ *    strictly lower and upper parts, D holds the inverses of the diagonal
+ *    blocks (bs*bs values per block row, stored as the blocks of A).
+ *
+ * Same elimination as hypre_ILUSetupILUK with dense blocks:
+ *    L_ij = L_ij D_j^{-1}, then row i is updated with - L_ij U_j*.
+ * A diagonal block that cannot be inverted is replaced by its diagonal, with
+ *    small entries replaced as in the scalar factorization.
+ */
+HYPRE_Int
+hypre_ILUSetupBlockILUK(hypre_ParCSRBlockMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm,
+      hypre_ParCSRBlockMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRBlockMatrix **Uptr)
+{
+   HYPRE_Real              local_nnz, total_nnz;
+   HYPRE_Int               i, ii, j, k, kl, ku, jpiv, col, icol;
+   HYPRE_Int               *iw, *rperm, *u_end = NULL;
+   MPI_Comm                comm = hypre_ParCSRBlockMatrixComm(A);
+   HYPRE_Int               num_procs, num_starts;
+
+   /* data objects for A */
+   hypre_CSRBlockMatrix    *A_diag        = hypre_ParCSRBlockMatrixDiag(A);
+   HYPRE_Real              *A_diag_data   = hypre_CSRBlockMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRBlockMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRBlockMatrixJ(A_diag);
+   HYPRE_Int               bs             = hypre_CSRBlockMatrixBlockSize(A_diag);
+   HYPRE_Int               bnnz           = bs * bs;
+
+   /* data objects for L, D, U */
+   hypre_ParCSRBlockMatrix *matL;
+   hypre_ParCSRBlockMatrix *matU;
+   hypre_CSRBlockMatrix    *L_diag;
+   hypre_CSRBlockMatrix    *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Real              *L_diag_data   = NULL;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j      = NULL;
+   HYPRE_Real              *U_diag_data   = NULL;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j      = NULL;
+   HYPRE_Int               *S_diag_i;
+   HYPRE_Int               *S_diag_j      = NULL;
+   HYPRE_BigInt            *row_starts;
+
+   /* work blocks */
+   HYPRE_Real              *target, *neg_l, *diag, *ident;
+
+   /* problem size (number of block rows) */
+   HYPRE_Int               n = hypre_CSRBlockMatrixNumRows(A_diag);
+
+   hypre_MPI_Comm_size(comm,&num_procs);
+
+   D_data = hypre_CTAlloc(HYPRE_Real, n * bnnz, HYPRE_MEMORY_DEVICE);
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, (n+1), HYPRE_MEMORY_DEVICE);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, (n+1), HYPRE_MEMORY_DEVICE);
+   S_diag_i = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_DEVICE);
+
+   /*
+    * 1: Symbolic factorization of the block pattern
+    */
+   iw = hypre_CTAlloc(HYPRE_Int, 4*n, HYPRE_MEMORY_HOST);
+   rperm = iw + 3*n;
+   for(i=0; i<n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+   hypre_ILUSetupILUKSymbolic(n, A_diag_i, A_diag_j, lfil, perm, rperm, iw,
+         n, L_diag_i, U_diag_i, S_diag_i, &L_diag_j, &U_diag_j, &S_diag_j, &u_end);
+
+   if(L_diag_i[n])
+   {
+      L_diag_data = hypre_CTAlloc(HYPRE_Real, L_diag_i[n] * bnnz, HYPRE_MEMORY_DEVICE);
+   }
+   if(U_diag_i[n])
+   {
+      U_diag_data = hypre_CTAlloc(HYPRE_Real, U_diag_i[n] * bnnz, HYPRE_MEMORY_DEVICE);
+   }
+   neg_l = hypre_TAlloc(HYPRE_Real, 3 * bnnz, HYPRE_MEMORY_HOST);
+   diag  = neg_l + bnnz;
+   ident = neg_l + 2 * bnnz;
+   hypre_CSRBlockMatrixBlockSetScalar(ident, 0.0, bs);
+   for(k = 0 ; k < bs ; k ++)
+   {
+      ident[k*bs+k] = 1.0;
+   }
+
+   /*
+    * 2: Numeric factorization, block row by block row
+    */
+   for( ii = 0; ii < n; ii++ )
+   {
+      i = perm[ii];
+      kl = L_diag_i[ii+1];
+      ku = U_diag_i[ii+1];
+      /* set up working arrays */
+      for(j = L_diag_i[ii] ; j < kl ; j ++)
+      {
+         iw[L_diag_j[j]] = j;
+      }
+      iw[ii] = ii;
+      for(j = U_diag_i[ii] ; j < ku ; j ++)
+      {
+         iw[U_diag_j[j]] = j;
+      }
+      /* copy blocks of A into L, D and U */
+      for(j = A_diag_i[i] ; j < A_diag_i[i+1] ; j ++)
+      {
+         col = rperm[A_diag_j[j]];
+         icol = iw[col];
+         if(col < ii)
+         {
+            target = L_diag_data + icol * bnnz;
+         }
+         else if(col == ii)
+         {
+            target = D_data + ii * bnnz;
+         }
+         else
+         {
+            target = U_diag_data + icol * bnnz;
+         }
+         hypre_CSRBlockMatrixBlockCopyData(A_diag_data + j * bnnz, target, 1.0, bs);
+      }
+      /* elimination */
+      for(j = L_diag_i[ii] ; j < kl ; j ++)
+      {
+         jpiv = L_diag_j[j];
+         /* L_ij = L_ij D_jpiv^{-1}, keep - L_ij for the update */
+         hypre_CSRBlockMatrixBlockMultAdd(L_diag_data + j * bnnz, D_data + jpiv * bnnz,
+                                          0.0, neg_l, bs);
+         hypre_CSRBlockMatrixBlockCopyData(neg_l, L_diag_data + j * bnnz, 1.0, bs);
+         hypre_CSRBlockMatrixBlockCopyData(neg_l, neg_l, -1.0, bs);
+
+         for(k = U_diag_i[jpiv] ; k < U_diag_i[jpiv+1] ; k ++)
+         {
+            col = U_diag_j[k];
+            icol = iw[col];
+            if(icol < 0)
+            {
+               /* not in pattern */
+               continue;
+            }
+            if(col < ii)
+            {
+               target = L_diag_data + icol * bnnz;
+            }
+            else if(col == ii)
+            {
+               target = D_data + ii * bnnz;
+            }
+            else
+            {
+               target = U_diag_data + icol * bnnz;
+            }
+            hypre_CSRBlockMatrixBlockMultAdd(neg_l, U_diag_data + k * bnnz, 1.0, target, bs);
+         }
+      }
+      /* reset working array */
+      for(j = L_diag_i[ii] ; j < kl ; j ++)
+      {
+         iw[L_diag_j[j]] = -1;
+      }
+      iw[ii] = -1;
+      for(j = U_diag_i[ii] ; j < ku ; j ++)
+      {
+         iw[U_diag_j[j]] = -1;
+      }
+
+      /* diagonal block (we store the inverse) */
+      target = D_data + ii * bnnz;
+      hypre_CSRBlockMatrixBlockCopyData(target, diag, 1.0, bs);
+      if(hypre_CSRBlockMatrixBlockInvMult(diag, ident, target, bs))
+      {
+         hypre_CSRBlockMatrixBlockSetScalar(target, 0.0, bs);
+         for(k = 0 ; k < bs ; k ++)
+         {
+            if(fabs(diag[k*bs+k]) < MAT_TOL)
+            {
+               diag[k*bs+k] = 1e-06;
+            }
+            target[k*bs+k] = 1. / diag[k*bs+k];
+         }
+      }
+   }
+
+   /*
+    * 3: Assemble the L and U block matrices, each with its own partitioning
+    *    so that they do not depend on A after the setup
+    */
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_starts = 2;
+#else
+   num_starts = num_procs + 1;
+#endif
+   row_starts = hypre_TAlloc(HYPRE_BigInt, num_starts, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(row_starts, hypre_ParCSRBlockMatrixRowStarts(A), HYPRE_BigInt, num_starts,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   matL = hypre_ParCSRBlockMatrixCreate( comm, bs,
+         hypre_ParCSRBlockMatrixGlobalNumRows(A),
+         hypre_ParCSRBlockMatrixGlobalNumRows(A),
+         row_starts,
+         row_starts,
+         0 /* num_cols_offd */,
+         L_diag_i[n],
+         0 /* num_nonzeros_offd */);
+   L_diag = hypre_ParCSRBlockMatrixDiag(matL);
+   hypre_CSRBlockMatrixI(L_diag) = L_diag_i;
+   hypre_CSRBlockMatrixJ(L_diag) = L_diag_j;
+   hypre_CSRBlockMatrixData(L_diag) = L_diag_data;
+   local_nnz = (HYPRE_Real) (L_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRBlockMatrixDNumNonzeros(matL) = total_nnz;
+
+   row_starts = hypre_TAlloc(HYPRE_BigInt, num_starts, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(row_starts, hypre_ParCSRBlockMatrixRowStarts(A), HYPRE_BigInt, num_starts,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   matU = hypre_ParCSRBlockMatrixCreate( comm, bs,
+         hypre_ParCSRBlockMatrixGlobalNumRows(A),
+         hypre_ParCSRBlockMatrixGlobalNumRows(A),
+         row_starts,
+         row_starts,
+         0,
+         U_diag_i[n],
+         0 );
+   U_diag = hypre_ParCSRBlockMatrixDiag(matU);
+   hypre_CSRBlockMatrixI(U_diag) = U_diag_i;
+   hypre_CSRBlockMatrixJ(U_diag) = U_diag_j;
+   hypre_CSRBlockMatrixData(U_diag) = U_diag_data;
+   local_nnz = (HYPRE_Real) (U_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRBlockMatrixDNumNonzeros(matU) = total_nnz;
+
+   /* free */
+   hypre_TFree(iw,HYPRE_MEMORY_HOST);
+   hypre_TFree(neg_l,HYPRE_MEMORY_HOST);
+   hypre_TFree(u_end,HYPRE_MEMORY_HOST);
+   hypre_TFree(S_diag_i,HYPRE_MEMORY_DEVICE);
+   hypre_TFree(S_diag_j,HYPRE_MEMORY_DEVICE);
+
+   /* set matrix pointers */
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+
+   return hypre_error_flag;
+}
+
 /* ILUT
  * A: input matrix
  * lfil: maximum nnz per row in L and U
@@ -39,6 +39,8 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Real           *matD          = hypre_ParILUDataMatD(ilu_data);
    hypre_ParCSRMatrix   *matU          = hypre_ParILUDataMatU(ilu_data);
    hypre_ParCSRMatrix   *matS          = hypre_ParILUDataMatS(ilu_data);
+   hypre_ParCSRBlockMatrix *matLB      = hypre_ParILUDataMatLB(ilu_data);
+   hypre_ParCSRBlockMatrix *matUB      = hypre_ParILUDataMatUB(ilu_data);
 
    HYPRE_Int            iter, num_procs,  my_id;
 
@@ -57,6 +59,20 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Real           *uext          = hypre_ParILUDataUExt(ilu_data);
    hypre_ParVector      *residual;
 
+   /* level schedules of the triangular solves */
+   HYPRE_Int            num_lower_levels = hypre_ParILUDataNumLowerLevels(ilu_data);
+   HYPRE_Int            *lower_level_ptr = hypre_ParILUDataLowerLevelPtr(ilu_data);
+   HYPRE_Int            *lower_level_rows = hypre_ParILUDataLowerLevelRows(ilu_data);
+   HYPRE_Int            num_upper_levels = hypre_ParILUDataNumUpperLevels(ilu_data);
+   HYPRE_Int            *upper_level_ptr = hypre_ParILUDataUpperLevelPtr(ilu_data);
+   HYPRE_Int            *upper_level_rows = hypre_ParILUDataUpperLevelRows(ilu_data);
+
+   /* iterative triangular solves */
+   HYPRE_Int            tri_solve      = hypre_ParILUDataTriSolve(ilu_data);
+   HYPRE_Int            lower_jacobi_iters = hypre_ParILUDataLowerJacobiIters(ilu_data);
+   HYPRE_Int            upper_jacobi_iters = hypre_ParILUDataUpperJacobiIters(ilu_data);
+   hypre_ParVector      *Xtemp         = hypre_ParILUDataXTemp(ilu_data);
+
    HYPRE_Real           alpha          = -1;
    HYPRE_Real           beta           = 1;
    HYPRE_Real           conv_factor    = 0.0;
@@ -82,6 +98,7 @@ hypre_ILUSolve( void               *ilu_vdata,
    hypre_ParVector      *x             = hypre_ParILUDataX(ilu_data);
 
    /* begin */
+   HYPRE_ANNOTATION_BEGIN("ILU.solve");
 
    if(logging > 1)
    {
@@ -161,6 +178,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         HYPRE_ANNOTATION_END("ILU.solve");
          return hypre_error_flag;
       }
 
@@ -179,6 +197,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             rel_resnorm = 0.0;
             (ilu_data -> final_rel_residual_norm) = rel_resnorm;
          }
+         HYPRE_ANNOTATION_END("ILU.solve");
          return hypre_error_flag;
       }
    }
@@ -209,8 +228,24 @@ hypre_ILUSolve( void               *ilu_vdata,
 
       /* Do one solve on LUe=r */
       switch(ilu_type){
-         case 0: case 1:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+         case 0: case 1: case 2:
+            if (matLB)
+            {
+               hypre_ILUSolveBlockLU(matA, F_array, U_array, perm, matLB, matD, matUB, Ftemp, Utemp,
+                     num_lower_levels, lower_level_ptr, lower_level_rows,
+                     num_upper_levels, upper_level_ptr, upper_level_rows); //BJ, block factors
+            }
+            else if (tri_solve == 0 && Xtemp)
+            {
+               hypre_ILUSolveLUIter(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                     Xtemp, lower_jacobi_iters, upper_jacobi_iters); //BJ, Jacobi sweeps
+            }
+            else
+            {
+               hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                     num_lower_levels, lower_level_ptr, lower_level_rows,
+                     num_upper_levels, upper_level_ptr, upper_level_rows); //BJ
+            }
             break;
          case 10: case 11:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, perm, nLU, matL, matD, matU, matS,
@@ -221,14 +256,26 @@ hypre_ILUSolve( void               *ilu_vdata,
                   Utemp, Ftemp, schur_solver, rhs, x, u_end); //MR+NSH
             break;
          case 30: case 31:
-            hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext); //RAS
+            hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext,
+                  num_lower_levels, lower_level_ptr, lower_level_rows,
+                  num_upper_levels, upper_level_ptr, upper_level_rows); //RAS
             break;
          case 40: case 41:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, qperm, nLU, matL, matD, matU, matS,
                   Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end); //GMRES
             break;
          default:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            if (tri_solve == 0 && Xtemp)
+            {
+               hypre_ILUSolveLUIter(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                     Xtemp, lower_jacobi_iters, upper_jacobi_iters); //BJ, Jacobi sweeps
+            }
+            else
+            {
+               hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                     num_lower_levels, lower_level_ptr, lower_level_rows,
+                     num_upper_levels, upper_level_ptr, upper_level_rows); //BJ
+            }
             break;
 
       }
@@ -314,6 +361,9 @@ hypre_ILUSolve( void               *ilu_vdata,
          hypre_printf("                operator = %f\n",operat_cmplxty);
       }
    }
+
+   HYPRE_ANNOTATION_END("ILU.solve");
+
    return hypre_error_flag;
 }
 
@@ -648,6 +698,10 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
  * L, D and U factors only have local scope (no off-diagonal processor terms)
  * so apart from the residual calculation (which uses A), the solves with the
  * L and U factors are local.
+ * If level schedules of L and U are given (see hypre_ILUSetupLevelSchedule),
+ * the rows of each level are solved in parallel.  Every row is updated in the
+ * same order as in the sequential sweep, so the result does not depend on the
+ * number of threads.
 */
 
 HYPRE_Int
@@ -655,7 +709,9 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParVector    *u, HYPRE_Int *perm,
                   HYPRE_Int nLU, hypre_ParCSRMatrix *L,
                   HYPRE_Real* D, hypre_ParCSRMatrix *U,
-                  hypre_ParVector *ftemp, hypre_ParVector *utemp)
+                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                  HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
    hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
    HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
@@ -675,12 +731,27 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    HYPRE_Real      alpha;
    HYPRE_Real      beta;
-   HYPRE_Int       i, j, k1, k2;
+   HYPRE_Int       i, j, k1, k2, k, lev;
+   HYPRE_Int       seq_lower_ptr[2], seq_upper_ptr[2];
 
    /* begin */
    alpha = -1.0;
    beta = 1.0;
 
+   /* without a schedule (of all nLU rows), the sweeps are one level each */
+   if (!lower_level_rows || lower_level_ptr[num_lower_levels] != nLU)
+   {
+      num_lower_levels = 1; lower_level_rows = NULL;
+      seq_lower_ptr[0] = 0; seq_lower_ptr[1] = nLU;
+      lower_level_ptr = seq_lower_ptr;
+   }
+   if (!upper_level_rows || upper_level_ptr[num_upper_levels] != nLU)
+   {
+      num_upper_levels = 1; upper_level_rows = NULL;
+      seq_upper_ptr[0] = 0; seq_upper_ptr[1] = nLU;
+      upper_level_ptr = seq_upper_ptr;
+   }
+
    /* Initialize Utemp to zero.
     * This is necessary for correctness, when we use optimized
     * vector operations in the case where sizeof(L, D or U) < sizeof(A)
@@ -690,36 +761,283 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
 
    /* L solve - Forward solve */
-   /* copy rhs to account for diagonal of L (which is identity) */
-   for( i = 0; i < nLU; i++ )
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, k1, k2) if (lower_level_rows != NULL)
+#endif
+   for (lev = 0; lev < num_lower_levels; lev++)
    {
-      utemp_data[perm[i]] = ftemp_data[perm[i]];
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (k = lower_level_ptr[lev]; k < lower_level_ptr[lev+1]; k++)
+      {
+         i = lower_level_rows ? lower_level_rows[k] : k;
+         /* copy rhs to account for diagonal of L (which is identity) */
+         utemp_data[perm[i]] = ftemp_data[perm[i]];
+         /* update with remaining (off-diagonal) entries of L */
+         k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
+         for(j=k1; j <k2; j++)
+         {
+            utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+         }
+      }
    }
-   /* update with remaining (off-diagonal) entries of L */
-   for( i = 0; i < nLU; i++ )
+   /*-------------------- U solve - Backward substitution */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, k1, k2) if (upper_level_rows != NULL)
+#endif
+   for (lev = 0; lev < num_upper_levels; lev++)
    {
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j=k1; j <k2; j++)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (k = upper_level_ptr[lev]; k < upper_level_ptr[lev+1]; k++)
       {
-         utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+         i = upper_level_rows ? upper_level_rows[k] : nLU-1-k;
+         /* first update with the remaining (off-diagonal) entries of U */
+         k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
+         for(j=k1; j <k2; j++)
+         {
+            utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+         }
+         /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+         utemp_data[perm[i]] *= D[i];
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+
+   return hypre_error_flag;
+}
+
+
+/* Block incomplete LU solve
+ * Same as hypre_ILUSolveLU for the block factors of hypre_ILUSetupBlockILUK.
+ * perm is an ordering of the block rows: block row i of the factors holds the
+ * rows bs*perm[i], ..., bs*perm[i]+bs-1 of A.  D holds the inverses of the
+ * diagonal blocks.  The level schedules, if given, are schedules of the block
+ * rows.  ftemp holds the residual for the L solve and the right-hand sides of
+ * the U solve.
+*/
+
+HYPRE_Int
+hypre_ILUSolveBlockLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                  hypre_ParVector    *u, HYPRE_Int *perm,
+                  hypre_ParCSRBlockMatrix *L,
+                  HYPRE_Real* D, hypre_ParCSRBlockMatrix *U,
+                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                  HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
+{
+   hypre_CSRBlockMatrix *L_diag = hypre_ParCSRBlockMatrixDiag(L);
+   HYPRE_Real      *L_diag_data = hypre_CSRBlockMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i = hypre_CSRBlockMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j = hypre_CSRBlockMatrixJ(L_diag);
+
+   hypre_CSRBlockMatrix *U_diag = hypre_ParCSRBlockMatrixDiag(U);
+   HYPRE_Real      *U_diag_data = hypre_CSRBlockMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i = hypre_CSRBlockMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j = hypre_CSRBlockMatrixJ(U_diag);
+
+   HYPRE_Real      *utemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+
+   HYPRE_Int       bs = hypre_CSRBlockMatrixBlockSize(L_diag);
+   HYPRE_Int       bnnz = bs * bs;
+   HYPRE_Int       nLU = hypre_CSRBlockMatrixNumRows(L_diag);
+
+   HYPRE_Real      alpha;
+   HYPRE_Real      beta;
+   HYPRE_Real      *x, *r;
+   HYPRE_Int       i, j, c, k, lev;
+   HYPRE_Int       seq_lower_ptr[2], seq_upper_ptr[2];
+
+   /* begin */
+   alpha = -1.0;
+   beta = 1.0;
+
+   /* without a schedule (of all nLU block rows), the sweeps are one level each */
+   if (!lower_level_rows || lower_level_ptr[num_lower_levels] != nLU)
+   {
+      num_lower_levels = 1; lower_level_rows = NULL;
+      seq_lower_ptr[0] = 0; seq_lower_ptr[1] = nLU;
+      lower_level_ptr = seq_lower_ptr;
+   }
+   if (!upper_level_rows || upper_level_ptr[num_upper_levels] != nLU)
+   {
+      num_upper_levels = 1; upper_level_rows = NULL;
+      seq_upper_ptr[0] = 0; seq_upper_ptr[1] = nLU;
+      upper_level_ptr = seq_upper_ptr;
+   }
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* L solve - Forward solve */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, c, x, r) if (lower_level_rows != NULL)
+#endif
+   for (lev = 0; lev < num_lower_levels; lev++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (k = lower_level_ptr[lev]; k < lower_level_ptr[lev+1]; k++)
+      {
+         i = lower_level_rows ? lower_level_rows[k] : k;
+         x = utemp_data + perm[i] * bs;
+         r = ftemp_data + perm[i] * bs;
+         /* copy rhs to account for diagonal of L (which is identity) */
+         for (c = 0; c < bs; c++)
+         {
+            x[c] = r[c];
+         }
+         /* update with remaining (off-diagonal) blocks of L */
+         for (j = L_diag_i[i]; j < L_diag_i[i+1]; j++)
+         {
+            hypre_CSRBlockMatrixBlockMatvec(alpha, L_diag_data + j * bnnz,
+                                            utemp_data + perm[L_diag_j[j]] * bs, beta, x, bs);
+         }
       }
    }
    /*-------------------- U solve - Backward substitution */
-   for( i = nLU-1; i >= 0; i-- )
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, c, x, r) if (upper_level_rows != NULL)
+#endif
+   for (lev = 0; lev < num_upper_levels; lev++)
    {
-      /* first update with the remaining (off-diagonal) entries of U */
-      k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
-      for(j=k1; j <k2; j++)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (k = upper_level_ptr[lev]; k < upper_level_ptr[lev+1]; k++)
       {
-         utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+         i = upper_level_rows ? upper_level_rows[k] : nLU-1-k;
+         x = utemp_data + perm[i] * bs;
+         r = ftemp_data + perm[i] * bs;
+         /* first update with the remaining (off-diagonal) blocks of U */
+         for (c = 0; c < bs; c++)
+         {
+            r[c] = x[c];
+         }
+         for (j = U_diag_i[i]; j < U_diag_i[i+1]; j++)
+         {
+            hypre_CSRBlockMatrixBlockMatvec(alpha, U_diag_data + j * bnnz,
+                                            utemp_data + perm[U_diag_j[j]] * bs, beta, r, bs);
+         }
+         /* multiply by the inverse of the diagonal block */
+         hypre_CSRBlockMatrixBlockMatvec(beta, D + i * bnnz, r, 0.0, x, bs);
       }
-      /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
-      utemp_data[perm[i]] *= D[i];
    }
 
    /* Update solution */
    hypre_ParVectorAxpy(beta, utemp, u);
 
+   return hypre_error_flag;
+}
+
+
+/* Incomplete LU solve with iterative triangular solves
+ * Same as hypre_ILUSolveLU, but L^{-1} and U^{-1} are applied approximately
+ * with a fixed number of Jacobi sweeps on the factors, starting from zero:
+ *    x_{k+1} = r - L x_k           (L has a unit diagonal)
+ *    y_{k+1} = D (x - U y_k)       (D is stored as its inverse)
+ * The rows of a sweep are independent.  The sweeps alternate between two
+ * vectors, ftemp is reused for the U sweeps once the residual is no longer
+ * needed.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                  hypre_ParVector    *u, HYPRE_Int *perm,
+                  HYPRE_Int nLU, hypre_ParCSRMatrix *L,
+                  HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                  hypre_ParVector *xtemp,
+                  HYPRE_Int lower_jacobi_iters, HYPRE_Int upper_jacobi_iters)
+{
+   hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
+   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j = hypre_CSRMatrixJ(L_diag);
+
+   hypre_CSRMatrix *U_diag = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j = hypre_CSRMatrixJ(U_diag);
+
+   HYPRE_Real      *utemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+   HYPRE_Real      *xtemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(xtemp));
+
+   HYPRE_Real      *rhs, *x_old, *x_new, *x_swap;
+   HYPRE_Real      alpha;
+   HYPRE_Real      beta;
+   HYPRE_Real      res;
+   HYPRE_Int       i, j, iter;
+
+   /* begin */
+   alpha = -1.0;
+   beta = 1.0;
+
+   lower_jacobi_iters = hypre_max(lower_jacobi_iters, 1);
+   upper_jacobi_iters = hypre_max(upper_jacobi_iters, 1);
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* L solve - Jacobi sweeps, the last one writes xtemp */
+   rhs   = ftemp_data;
+   x_new = (lower_jacobi_iters % 2) ? xtemp_data : utemp_data;
+   x_old = (lower_jacobi_iters % 2) ? utemp_data : xtemp_data;
+   for (iter = 0; iter < lower_jacobi_iters; iter++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         res = rhs[perm[i]];
+         if (iter > 0)
+         {
+            for (j = L_diag_i[i]; j < L_diag_i[i+1]; j++)
+            {
+               res -= L_diag_data[j] * x_old[perm[L_diag_j[j]]];
+            }
+         }
+         x_new[perm[i]] = res;
+      }
+      x_swap = x_old; x_old = x_new; x_new = x_swap;
+   }
+
+   /*-------------------- U solve - Jacobi sweeps, the last one writes utemp */
+   rhs   = xtemp_data;
+   x_new = (upper_jacobi_iters % 2) ? utemp_data : ftemp_data;
+   x_old = (upper_jacobi_iters % 2) ? ftemp_data : utemp_data;
+   for (iter = 0; iter < upper_jacobi_iters; iter++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         res = rhs[perm[i]];
+         if (iter > 0)
+         {
+            for (j = U_diag_i[i]; j < U_diag_i[i+1]; j++)
+            {
+               res -= U_diag_data[j] * x_old[perm[U_diag_j[j]]];
+            }
+         }
+         /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+         x_new[perm[i]] = D[i] * res;
+      }
+      x_swap = x_old; x_old = x_new; x_new = x_swap;
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
 
    return hypre_error_flag;
 }
@@ -730,6 +1048,7 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
  * so apart from the residual calculation (which uses A), the solves with the
  * L and U factors are local.
  * fext and uext are tempory arrays for external data
+ * The level schedules are used as in hypre_ILUSolveLU.
 */
 
 HYPRE_Int
@@ -738,7 +1057,9 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParCSRMatrix *L,
                   HYPRE_Real* D, hypre_ParCSRMatrix *U,
                   hypre_ParVector *ftemp, hypre_ParVector *utemp,
-                  HYPRE_Real *fext, HYPRE_Real *uext)
+                  HYPRE_Real *fext, HYPRE_Real *uext,
+                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                  HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
 
    hypre_ParCSRCommPkg        *comm_pkg;
@@ -772,12 +1093,27 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    HYPRE_Real                 alpha;
    HYPRE_Real                 beta;
-   HYPRE_Int                  i, j, k1, k2;
+   HYPRE_Int                  i, j, k1, k2, k, lev;
+   HYPRE_Int                  seq_lower_ptr[2], seq_upper_ptr[2];
 
    /* begin */
    alpha = -1.0;
    beta = 1.0;
 
+   /* without a schedule (of all n_total rows), the sweeps are one level each */
+   if (!lower_level_rows || lower_level_ptr[num_lower_levels] != n_total)
+   {
+      num_lower_levels = 1; lower_level_rows = NULL;
+      seq_lower_ptr[0] = 0; seq_lower_ptr[1] = n_total;
+      lower_level_ptr = seq_lower_ptr;
+   }
+   if (!upper_level_rows || upper_level_ptr[num_upper_levels] != n_total)
+   {
+      num_upper_levels = 1; upper_level_rows = NULL;
+      seq_upper_ptr[0] = 0; seq_upper_ptr[1] = n_total;
+      upper_level_ptr = seq_upper_ptr;
+   }
+
    /* prepare for communication */
    comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    /* setup if not yet built */
@@ -818,93 +1154,112 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    hypre_ParCSRCommHandleDestroy(comm_handle);
 
    /* L solve - Forward solve */
-   for( i = 0 ; i < n_total ; i ++)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, k1, k2, col, jcol, idx) if (lower_level_rows != NULL)
+#endif
+   for (lev = 0; lev < num_lower_levels; lev++)
    {
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      if( i < n )
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (k = lower_level_ptr[lev]; k < lower_level_ptr[lev+1]; k++)
       {
-         /* diag part */
-         utemp_data[perm[i]] = ftemp_data[perm[i]];
-         for(j=k1; j <k2; j++)
+         i = lower_level_rows ? lower_level_rows[k] : k;
+         k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
+         if( i < n )
          {
-            col = L_diag_j[j];
-            if( col < n )
+            /* diag part */
+            utemp_data[perm[i]] = ftemp_data[perm[i]];
+            for(j=k1; j <k2; j++)
             {
-               utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[col]];
-            }
-            else
-            {
-               jcol = col - n;
-               utemp_data[perm[i]] -= L_diag_data[j] * uext[jcol];
+               col = L_diag_j[j];
+               if( col < n )
+               {
+                  utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[col]];
+               }
+               else
+               {
+                  jcol = col - n;
+                  utemp_data[perm[i]] -= L_diag_data[j] * uext[jcol];
+               }
             }
          }
-      }
-      else
-      {
-         /* offd part */
-         idx = i - n;
-         uext[idx] = fext[idx];
-         for(j=k1; j <k2; j++)
+         else
          {
-            col = L_diag_j[j];
-            if(col < n)
-            {
-               uext[idx] -= L_diag_data[j] * utemp_data[perm[col]];
-            }
-            else
+            /* offd part */
+            idx = i - n;
+            uext[idx] = fext[idx];
+            for(j=k1; j <k2; j++)
             {
-               jcol = col - n;
-               uext[idx] -= L_diag_data[j] * uext[jcol];
+               col = L_diag_j[j];
+               if(col < n)
+               {
+                  uext[idx] -= L_diag_data[j] * utemp_data[perm[col]];
+               }
+               else
+               {
+                  jcol = col - n;
+                  uext[idx] -= L_diag_data[j] * uext[jcol];
+               }
             }
          }
       }
    }
 
    /*-------------------- U solve - Backward substitution */
-   for( i = n_total-1; i >= 0; i-- )
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev, k, i, j, k1, k2, col, jcol, idx) if (upper_level_rows != NULL)
+#endif
+   for (lev = 0; lev < num_upper_levels; lev++)
    {
-      /* first update with the remaining (off-diagonal) entries of U */
-      k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
-      if( i < n )
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (k = upper_level_ptr[lev]; k < upper_level_ptr[lev+1]; k++)
       {
-         /* diag part */
-         for(j=k1; j <k2; j++)
+         i = upper_level_rows ? upper_level_rows[k] : n_total-1-k;
+         /* first update with the remaining (off-diagonal) entries of U */
+         k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
+         if( i < n )
          {
-            col = U_diag_j[j];
-            if( col < n )
+            /* diag part */
+            for(j=k1; j <k2; j++)
             {
-               utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[col]];
-            }
-            else
-            {
-               jcol = col - n;
-               utemp_data[perm[i]] -= U_diag_data[j] * uext[jcol];
+               col = U_diag_j[j];
+               if( col < n )
+               {
+                  utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[col]];
+               }
+               else
+               {
+                  jcol = col - n;
+                  utemp_data[perm[i]] -= U_diag_data[j] * uext[jcol];
+               }
             }
+            /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+            utemp_data[perm[i]] *= D[i];
          }
-         /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
-         utemp_data[perm[i]] *= D[i];
-      }
-      else
-      {
-         /* 2nd part of offd */
-         idx = i - n;
-         for(j=k1; j <k2; j++)
+         else
          {
-            col = U_diag_j[j];
-            if( col < n )
+            /* 2nd part of offd */
+            idx = i - n;
+            for(j=k1; j <k2; j++)
             {
-               uext[idx] -= U_diag_data[j] * utemp_data[perm[col]];
-            }
-            else
-            {
-               jcol = col - n;
-               uext[idx] -= U_diag_data[j] * uext[jcol];
+               col = U_diag_j[j];
+               if( col < n )
+               {
+                  uext[idx] -= U_diag_data[j] * utemp_data[perm[col]];
+               }
+               else
+               {
+                  jcol = col - n;
+                  uext[idx] -= U_diag_data[j] * uext[jcol];
+               }
             }
+            /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+            uext[idx] *= D[i];
          }
-         /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
-         uext[idx] *= D[i];
       }
-
    }
    /* Update solution */
    hypre_ParVectorAxpy(beta, utemp, u);
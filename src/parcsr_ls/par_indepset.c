@@ -37,28 +37,39 @@ hypre_BoomerAMGIndepSetInit( hypre_ParCSRMatrix *S,
    hypre_CSRMatrix *S_diag = hypre_ParCSRMatrixDiag(S);
    MPI_Comm         comm = hypre_ParCSRMatrixComm(S);
    HYPRE_Int        S_num_nodes = hypre_CSRMatrixNumRows(S_diag);
-   HYPRE_BigInt     big_i;
-   HYPRE_Int        i, my_id;
+   HYPRE_BigInt     skip = 0;
+   HYPRE_Int        i, seed, my_id;
    HYPRE_Int        ierr = 0;
 
    hypre_MPI_Comm_rank(comm,&my_id);
-   i = 2747 + my_id;
+   seed = 2747 + my_id;
    if (seq_rand)
    {
-      i = 2747;
+      /* continue the sequence of the previous processes */
+      seed = 2747;
+      skip = hypre_ParCSRMatrixFirstRowIndex(S);
    }
-   hypre_SeedRand(i);
-   if (seq_rand)
+
+   /* Node i gets number skip+i+1 of the sequence of hypre_Rand.  Each thread
+      jumps to the start of its part, so the measures do not depend on the
+      number of threads. */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
    {
-      for (big_i = 0; big_i < hypre_ParCSRMatrixFirstRowIndex(S); big_i++)
+      HYPRE_Int i_begin, i_end, state;
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, S_num_nodes);
+
+      state = hypre_RandIAt(seed, skip + i_begin);
+      for (i = i_begin; i < i_end; i++)
       {
-         hypre_Rand();
+         state = hypre_RandIAt(state, 1);
+         measure_array[i] += hypre_RandAt(state, 0);
       }
    }
-   for (i = 0; i < S_num_nodes; i++)
-   {
-      measure_array[i] += hypre_Rand();
-   }
+
+   /* leave the generator where the sequential loop would */
+   hypre_SeedRand(hypre_RandIAt(seed, skip + S_num_nodes));
 
    return (ierr);
 }
@@ -131,6 +142,9 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
       S_offd_j = hypre_CSRMatrixJ(S_offd);
    }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_size; ig++)
    {
       i = graph_array[ig];
@@ -139,6 +153,9 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
          IS_marker[i] = 1;
       }
    }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_offd_size; ig++)
    {
       i = graph_array_offd[ig];
@@ -149,9 +166,15 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
    }
 
    /*-------------------------------------------------------
-    * Remove nodes from the initial independent set
+    * Remove nodes from the initial independent set.
+    *
+    * Threads only ever clear markers, so the result does not
+    * depend on the order of the updates.
     *-------------------------------------------------------*/
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig, i, j, jS, jj) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_size; ig++)
    {
       i = graph_array[ig];
@@ -171,10 +194,16 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
             {
                if (measure_array[i] > measure_array[j])
                {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                   IS_marker[j] = 0;
                }
                else if (measure_array[j] > measure_array[i])
                {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                   IS_marker[i] = 0;
                }
             }
@@ -194,10 +223,16 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
             {
                if (measure_array[i] > measure_array[j])
                {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                   IS_marker_offd[jj] = 0;
                }
                else if (measure_array[j] > measure_array[i])
                {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic write
+#endif
                   IS_marker[i] = 0;
                }
             }
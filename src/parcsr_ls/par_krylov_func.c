@@ -177,6 +177,23 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiInnerProdInit
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProdInit( HYPRE_Int           nprod,
+                                   void              **x,
+                                   void              **y,
+                                   HYPRE_Real         *local_result,
+                                   HYPRE_Real         *result,
+                                   hypre_MPI_Request  *request )
+{
+   return ( hypre_ParVectorMultiInnerProdInit( nprod, (hypre_ParVector **) x,
+                                               (hypre_ParVector **) y,
+                                               local_result, result, request ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -261,7 +278,18 @@ hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha,
                                      (hypre_ParVector *) y, k, unroll));
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpyNorm
+ *--------------------------------------------------------------------------*/
 
+HYPRE_Real
+hypre_ParKrylovAxpyNorm( HYPRE_Complex alpha,
+                         void   *x,
+                         void   *y )
+{
+   return ( hypre_ParVectorAxpyNorm( alpha, (hypre_ParVector *) x,
+                                     (hypre_ParVector *) y ) );
+}
 
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovCommInfo
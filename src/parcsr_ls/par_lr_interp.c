@@ -196,15 +196,15 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
-      P_marker       = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_CTAllocArena(HYPRE_Int, n_fine);
+      P_marker       = hypre_CTAllocArena(HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd       = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd       = hypre_CTAllocArena(HYPRE_Int,    full_off_procNodes);
+      fine_to_coarse_offd = hypre_CTAllocArena(HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_CTAllocArena(HYPRE_Int,    full_off_procNodes);
    }
 
    hypre_initialize_vecs(n_fine, full_off_procNodes, fine_to_coarse,
@@ -393,15 +393,15 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
     * interpolation routine. */
    if (n_fine)
    {
-      ahat = hypre_CTAlloc(HYPRE_Real, n_fine, HYPRE_MEMORY_HOST);
-      ihat = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      ipnt = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      ahat = hypre_CTAllocArena(HYPRE_Real, n_fine);
+      ihat = hypre_CTAllocArena(HYPRE_Int,  n_fine);
+      ipnt = hypre_CTAllocArena(HYPRE_Int,  n_fine);
    }
    if (full_off_procNodes)
    {
-      ahat_offd = hypre_CTAlloc(HYPRE_Real, full_off_procNodes, HYPRE_MEMORY_HOST);
-      ihat_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      ipnt_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+      ahat_offd = hypre_CTAllocArena(HYPRE_Real, full_off_procNodes);
+      ihat_offd = hypre_CTAllocArena(HYPRE_Int,  full_off_procNodes);
+      ipnt_offd = hypre_CTAllocArena(HYPRE_Int,  full_off_procNodes);
    }
 
    for (i = 0; i < n_fine; i++)
@@ -1215,13 +1215,13 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_CTAllocArena(HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      fine_to_coarse_offd = hypre_CTAllocArena(HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_CTAllocArena(HYPRE_Int,    full_off_procNodes);
    }
 
    /* This function is smart enough to check P_marker and P_marker_offd only,
@@ -1276,13 +1276,13 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
       jj_counter_offd = start_indexing;
       if (n_fine)
       {
-         P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+         P_marker = hypre_CTAllocArena(HYPRE_Int,  n_fine);
          for (i = 0; i < n_fine; i++)
          {  P_marker[i] = -1; }
       }
       if (full_off_procNodes)
       {
-         P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+         P_marker_offd = hypre_CTAllocArena(HYPRE_Int,  full_off_procNodes);
          for (i = 0; i < full_off_procNodes; i++)
          {  P_marker_offd[i] = -1;}
       }
@@ -2092,15 +2092,15 @@ hypre_BoomerAMGBuildExtPICCInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_CTAllocArena(HYPRE_Int,  n_fine);
+      P_marker = hypre_CTAllocArena(HYPRE_Int,  n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_CTAllocArena(HYPRE_Int,  full_off_procNodes);
+      fine_to_coarse_offd = hypre_CTAllocArena(HYPRE_BigInt,  full_off_procNodes);
+      tmp_CF_marker_offd = hypre_CTAllocArena(HYPRE_Int,  full_off_procNodes);
    }
 
    /*clist = hypre_CTAlloc(HYPRE_Int, MAX_C_CONNECTIONS);
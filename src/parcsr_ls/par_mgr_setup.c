@@ -111,6 +111,8 @@ hypre_MGRSetup( void               *mgr_vdata,
    HYPRE_Real wall_time;
 
    /* ----- begin -----*/
+   HYPRE_ANNOTATION_BEGIN("MGR.setup");
+
    block_size = (mgr_data -> block_size);
    block_cf_marker = (mgr_data -> block_cf_marker);
    set_c_points_method = (mgr_data -> set_c_points_method);
@@ -170,6 +172,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       coarse_grid_solver_setup((mgr_data -> coarse_grid_solver), A, f, u);
       (mgr_data -> num_coarse_levels) = 0;
 
+      HYPRE_ANNOTATION_END("MGR.setup");
       return hypre_error_flag;
    }
 
@@ -1142,6 +1145,8 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_TFree(reserved_coarse_indexes, HYPRE_MEMORY_HOST);
    }
 
+   HYPRE_ANNOTATION_END("MGR.setup");
+
    return hypre_error_flag;
 }
 
@@ -75,6 +75,8 @@ hypre_MGRSolve( void               *mgr_vdata,
 
    HYPRE_Int    i;
 
+   HYPRE_ANNOTATION_BEGIN("MGR.solve");
+
    if(logging > 1)
    {
       residual = (mgr_data -> residual);
@@ -90,6 +92,7 @@ hypre_MGRSolve( void               *mgr_vdata,
       HYPRE_BoomerAMGGetFinalRelativeResidualNorm(cg_solver, &rel_resnorm);
       (mgr_data -> num_iterations) = iter;
       (mgr_data -> final_rel_residual_norm) = rel_resnorm;
+      HYPRE_ANNOTATION_END("MGR.solve");
       return hypre_error_flag;
    }
 
@@ -166,6 +169,7 @@ hypre_MGRSolve( void               *mgr_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         HYPRE_ANNOTATION_END("MGR.solve");
          return hypre_error_flag;
       }
 
@@ -184,6 +188,7 @@ hypre_MGRSolve( void               *mgr_vdata,
             rel_resnorm = 0.0;
             (mgr_data -> final_rel_residual_norm) = rel_resnorm;
          }
+         HYPRE_ANNOTATION_END("MGR.solve");
          return hypre_error_flag;
       }
    }
@@ -346,6 +351,8 @@ hypre_MGRSolve( void               *mgr_vdata,
       }
    }
 
+   HYPRE_ANNOTATION_END("MGR.solve");
+
    return hypre_error_flag;
 }
 
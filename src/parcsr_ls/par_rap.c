@@ -23,6 +23,54 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorSymbolic
+ *
+ * Builds RAP as hypre_BoomerAMGBuildCoarseOperatorKT does and returns the
+ * plan with which hypre_BoomerAMGBuildCoarseOperatorNumeric recomputes its
+ * values when those of RT, A and P change but their patterns do not.  The
+ * plan keeps the product A P; free it with hypre_ParCSRMatMatPlanDestroy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorSymbolic( hypre_ParCSRMatrix      *RT,
+                                            hypre_ParCSRMatrix      *A,
+                                            hypre_ParCSRMatrix      *P,
+                                            HYPRE_Int                keepTranspose,
+                                            hypre_ParCSRMatrix     **RAP_ptr,
+                                            hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   hypre_BoomerAMGBuildCoarseOperatorKT(RT, A, P, keepTranspose, RAP_ptr);
+
+   *plan_ptr = hypre_ParCSRMatrixRAPPlanCreate(RT, A, P, *RAP_ptr);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorNumeric
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorNumeric( hypre_ParCSRMatMatPlan *plan,
+                                           hypre_ParCSRMatrix     *RT,
+                                           hypre_ParCSRMatrix     *A,
+                                           hypre_ParCSRMatrix     *P,
+                                           hypre_ParCSRMatrix     *RAP )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RAP] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRMatrixRAPNumeric(plan, RT, A, P, RAP);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RAP] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                                       hypre_ParCSRMatrix  *A,
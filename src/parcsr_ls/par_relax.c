@@ -42,7 +42,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    HYPRE_Real      *A_offd_data  = hypre_CSRMatrixData(A_offd);
    HYPRE_Int       *A_offd_j     = hypre_CSRMatrixJ(A_offd);
    hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
-   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
 
    HYPRE_BigInt     global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
    HYPRE_Int        n       = hypre_CSRMatrixNumRows(A_diag);
@@ -64,6 +64,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    }
    HYPRE_Real     *Vext_data = NULL;
    HYPRE_Real     *v_buf_data = NULL;
+   HYPRE_Int       halo_persistent = 0;
    HYPRE_Real     *tmp_data;
 
    hypre_Vector   *Ztemp_local;
@@ -104,6 +105,14 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
    num_threads = hypre_NumThreads();
+
+   /* matrix values stored in single precision (mixed precision AMG) */
+   if (hypre_CSRMatrixDataFloat(A_diag) && relax_type != 7)
+   {
+      return hypre_BoomerAMGRelaxFloat(A, f, cf_marker, relax_type, relax_points,
+                                       relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
    /*-----------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
     *     relax_type = 0 -> Jacobi or CF-Jacobi
@@ -144,9 +153,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 
             /* printf("!! Proc %d: n %d,  num_sends %d, num_cols_offd %d\n", my_id, n, num_sends, num_cols_offd); */
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -164,7 +171,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
          /*-----------------------------------------------------------------
           * Copy current approximation into temporary vector.
@@ -179,7 +186,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -253,8 +260,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
@@ -266,9 +272,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -286,12 +290,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -365,8 +369,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
@@ -380,11 +383,6 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             Ztemp_data = hypre_VectorData(Ztemp_local);
          }
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-         // JSP: persistent comm can be similarly used for other smoothers
-         hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
-
          if (num_procs > 1)
          {
 #ifdef HYPRE_PROFILE
@@ -393,15 +391,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-            v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -424,20 +414,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-            comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
-#endif
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
-#else
-            hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
 
 #ifdef HYPRE_PROFILE
@@ -832,13 +814,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
               }
            }
         }
-#ifndef HYPRE_USING_PERSISTENT_COMM
         if (num_procs > 1)
         {
-           hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-           hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+           hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
         }
-#endif
 #ifdef HYPRE_PROFILE
         hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
 #endif
@@ -1186,10 +1165,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                  hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -1206,13 +1182,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                      = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
-                  Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -1623,8 +1598,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
@@ -1647,10 +1621,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                  hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -1667,13 +1638,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                      = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
-                  Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -2327,8 +2297,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
@@ -2377,9 +2346,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -2397,12 +2364,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -3054,8 +3021,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
@@ -3069,11 +3035,6 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             Ztemp_data = hypre_VectorData(Ztemp_local);
          }
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-         // JSP: persistent comm can be similarly used for other smoothers
-         hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
-
          if (num_procs > 1)
          {
 #ifdef HYPRE_PROFILE
@@ -3081,16 +3042,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 #endif
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-            v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                                       hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -3114,20 +3066,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
-#endif
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-#ifdef HYPRE_USING_PERSISTENT_COMM
-            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
-#else
-            hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
 
 #ifdef HYPRE_PROFILE
@@ -3323,13 +3267,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             }
          }
 
-#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
-#endif
 #ifdef HYPRE_PROFILE
          hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
 #endif
@@ -3351,10 +3292,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                  hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -3371,12 +3309,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                      = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -3791,8 +3729,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
@@ -3813,9 +3750,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-            v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
 
             if (num_cols_offd)
             {
@@ -3833,12 +3768,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+            comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
             comm_handle = NULL;
          }
 
@@ -4250,8 +4185,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
          }
       }
       break;
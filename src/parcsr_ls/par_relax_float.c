@@ -0,0 +1,324 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Relaxation for matrices whose values are stored in single precision
+ * (see hypre_CSRMatrixSetDataFloat).  Matrix entries are read as floats,
+ * all arithmetic and the vectors remain in HYPRE_Real.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFloatPoint
+ *
+ * Relaxes point i using the single precision entries of A.  Diagonal block
+ * columns inside [ns,ne) use the current iterate u, the remaining columns use
+ * tmp (a copy of u taken before the sweep) and the offd part uses Vext.
+ * D is the scaling (diagonal of A or l1 norm of row i).
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_BoomerAMGRelaxFloatPoint( HYPRE_Int    i,
+                                HYPRE_Int    ns,
+                                HYPRE_Int    ne,
+                                HYPRE_Int   *A_diag_i,
+                                HYPRE_Int   *A_diag_j,
+                                hypre_float *A_diag_data,
+                                HYPRE_Int   *A_offd_i,
+                                HYPRE_Int   *A_offd_j,
+                                hypre_float *A_offd_data,
+                                HYPRE_Real  *f_data,
+                                HYPRE_Real  *u_data,
+                                HYPRE_Real  *tmp_data,
+                                HYPRE_Real  *Vtemp_data,
+                                HYPRE_Real  *Vext_data,
+                                HYPRE_Real   D,
+                                HYPRE_Int    use_l1,
+                                HYPRE_Int    weighted,
+                                HYPRE_Real   relax_weight,
+                                HYPRE_Real   omega )
+{
+   HYPRE_Int  ii, jj;
+   HYPRE_Real res, res0, res2;
+
+   res  = f_data[i];
+   res0 = 0.0;
+   res2 = 0.0;
+   for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+   {
+      ii = A_diag_j[jj];
+      if (ii >= ns && ii < ne)
+      {
+         res0 -= (HYPRE_Real) A_diag_data[jj] * u_data[ii];
+         if (weighted)
+         {
+            res2 += (HYPRE_Real) A_diag_data[jj] * Vtemp_data[ii];
+         }
+      }
+      else
+      {
+         res -= (HYPRE_Real) A_diag_data[jj] * tmp_data[ii];
+      }
+   }
+   for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+   {
+      ii = A_offd_j[jj];
+      res -= (HYPRE_Real) A_offd_data[jj] * Vext_data[ii];
+   }
+
+   if (!weighted)
+   {
+      if (use_l1)
+      {
+         u_data[i] += (res + res0 - (HYPRE_Real) A_diag_data[A_diag_i[i]] * u_data[i]) / D;
+      }
+      else
+      {
+         u_data[i] = (res + res0) / D;
+      }
+   }
+   else
+   {
+      u_data[i] *= (1.0 - relax_weight*omega);
+      u_data[i] += relax_weight*(omega*res + res0 + (1.0 - omega)*res2) / D;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFloat
+ *
+ * Single precision matrix counterpart of hypre_BoomerAMGRelax for
+ * relax_type = 0 (Jacobi), 3, 4, 6 (hybrid SOR/SSOR) and 8, 13, 14
+ * (l1 hybrid Gauss-Seidel).  Relaxation types that only use the matvec
+ * (such as 7) are handled by hypre_BoomerAMGRelax directly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxFloat( hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           HYPRE_Int          *cf_marker,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           relax_points,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Real          omega,
+                           HYPRE_Real         *l1_norms,
+                           hypre_ParVector    *u,
+                           hypre_ParVector    *Vtemp,
+                           hypre_ParVector    *Ztemp )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_float     *A_diag_data  = hypre_CSRMatrixDataFloat(A_diag);
+   HYPRE_Int       *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_float     *A_offd_data  = hypre_CSRMatrixDataFloat(A_offd);
+   HYPRE_Int       *A_offd_i     = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+
+   HYPRE_Int        n             = hypre_CSRMatrixNumRows(A_diag);
+
+   HYPRE_Real      *u_data     = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data     = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real      *Ztemp_data = NULL;
+   HYPRE_Real      *tmp_data;
+   HYPRE_Real      *Vext_data  = NULL;
+   HYPRE_Real      *v_buf_data = NULL;
+   HYPRE_Int        halo_persistent = 0;
+
+   HYPRE_Int        i, j, ii, jj, ns, ne, size, rest;
+   HYPRE_Int        num_procs, num_threads, num_sends, index, start;
+   HYPRE_Int        forward, backward, use_l1, weighted;
+   HYPRE_Real       D, res;
+   HYPRE_Real       zero = 0.0;
+
+   switch (relax_type)
+   {
+      case 0:
+         forward = 0; backward = 0; use_l1 = 0; break;
+      case 3:
+         forward = 1; backward = 0; use_l1 = 0; break;
+      case 4:
+         forward = 0; backward = 1; use_l1 = 0; break;
+      case 6:
+         forward = 1; backward = 1; use_l1 = 0; break;
+      case 8:
+         forward = 1; backward = 1; use_l1 = 1; break;
+      case 13:
+         forward = 1; backward = 0; use_l1 = 1; break;
+      case 14:
+         forward = 0; backward = 1; use_l1 = 1; break;
+      default:
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Relaxation type not supported with single precision matrix values!\n");
+         return hypre_error_flag;
+   }
+
+   if (use_l1 && !l1_norms)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "l1 norms are required for this relaxation type!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+   weighted = (relax_weight != 1.0 || omega != 1.0);
+
+   /*-----------------------------------------------------------------
+    * Start the halo exchange of u.
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      hypre_ParCSRCommPkgHaloBuffers(comm_pkg, &v_buf_data, &Vext_data, &halo_persistent);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+         {
+            v_buf_data[index++] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommPkgHaloStart(comm_pkg, halo_persistent, v_buf_data, Vext_data);
+   }
+
+   if (relax_type == 0 || weighted)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+   }
+
+   if (num_procs > 1)
+   {
+      hypre_ParCSRCommPkgHaloWait(comm_pkg, halo_persistent, comm_handle, Vext_data);
+      comm_handle = NULL;
+   }
+
+   if (relax_type == 0)
+   {
+      /*-----------------------------------------------------------------
+       * Weighted Jacobi
+       *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         if ((relax_points == 0 || cf_marker[i] == relax_points) &&
+             A_diag_data[A_diag_i[i]] != zero)
+         {
+            res = f_data[i];
+            for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= (HYPRE_Real) A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= (HYPRE_Real) A_offd_data[jj] * Vext_data[ii];
+            }
+            u_data[i] *= 1.0 - relax_weight;
+            u_data[i] += relax_weight * res / (HYPRE_Real) A_diag_data[A_diag_i[i]];
+         }
+      }
+   }
+   else
+   {
+      /*-----------------------------------------------------------------
+       * Hybrid (l1) Gauss-Seidel/SOR: sequential within each thread
+       * block, Jacobi across thread blocks and processors.
+       *-----------------------------------------------------------------*/
+
+      if (num_threads > 1)
+      {
+         Ztemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ztemp));
+         tmp_data = Ztemp_data;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < n; i++)
+         {
+            tmp_data[i] = u_data[i];
+         }
+      }
+      else
+      {
+         tmp_data = u_data;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,ns,ne,size,rest,D) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_threads; j++)
+      {
+         size = n/num_threads;
+         rest = n - size*num_threads;
+         if (j < rest)
+         {
+            ns = j*size+j;
+            ne = (j+1)*size+j+1;
+         }
+         else
+         {
+            ns = j*size+rest;
+            ne = (j+1)*size+rest;
+         }
+
+         if (forward)
+         {
+            for (i = ns; i < ne; i++)
+            {
+               D = use_l1 ? l1_norms[i] : (HYPRE_Real) A_diag_data[A_diag_i[i]];
+               if ((relax_points == 0 || cf_marker[i] == relax_points) && D != zero)
+               {
+                  hypre_BoomerAMGRelaxFloatPoint(i, ns, ne, A_diag_i, A_diag_j, A_diag_data,
+                                                 A_offd_i, A_offd_j, A_offd_data,
+                                                 f_data, u_data, tmp_data, Vtemp_data, Vext_data,
+                                                 D, use_l1, weighted, relax_weight, omega);
+               }
+            }
+         }
+
+         if (backward)
+         {
+            for (i = ne-1; i > ns-1; i--)
+            {
+               D = use_l1 ? l1_norms[i] : (HYPRE_Real) A_diag_data[A_diag_i[i]];
+               if ((relax_points == 0 || cf_marker[i] == relax_points) && D != zero)
+               {
+                  hypre_BoomerAMGRelaxFloatPoint(i, ns, ne, A_diag_i, A_diag_j, A_diag_data,
+                                                 A_offd_i, A_offd_j, A_offd_data,
+                                                 f_data, u_data, tmp_data, Vtemp_data, Vext_data,
+                                                 D, use_l1, weighted, relax_weight, omega);
+               }
+            }
+         }
+      }
+   }
+
+   hypre_ParCSRCommPkgHaloFree(comm_pkg, halo_persistent, v_buf_data, Vext_data);
+
+   return hypre_error_flag;
+}
@@ -1159,3 +1159,117 @@ hypre_ParCSRRelax_L1_Jacobi( hypre_ParCSRMatrix *A,
     return 0;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxTwoStageGaussSeidel
+
+  l1 Gauss-Seidel (relax types 8, 13 and 14) with the triangular solve
+  replaced by num_sweeps Jacobi sweeps:
+
+     r = f - A u,   e_0 = 0,   e_{k+1} = D^{-1}(r - T e_k),   u += w e_{num_sweeps}
+
+  where D_ii = l1_norms[i] and T is the strictly lower (forward sweep) or
+  strictly upper (backward sweep) part of the local diagonal block.  Type 8
+  does a forward and a backward sweep.  The rows of a Jacobi sweep are
+  independent, so for given l1 norms the result does not depend on the
+  number of threads.
+  Only the points given by relax_points are relaxed.  omega is not used.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxTwoStageGaussSeidel( hypre_ParCSRMatrix *A,
+                                         hypre_ParVector    *f,
+                                         HYPRE_Int          *cf_marker,
+                                         HYPRE_Int           relax_type,
+                                         HYPRE_Int           relax_points,
+                                         HYPRE_Real          relax_weight,
+                                         HYPRE_Real         *l1_norms,
+                                         HYPRE_Int           num_sweeps,
+                                         hypre_ParVector    *u,
+                                         hypre_ParVector    *Vtemp )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int        n           = hypre_CSRMatrixNumRows(A_diag);
+
+   HYPRE_Real      *u_data      = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *r_data      = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real      *e_old       = NULL;
+   HYPRE_Real      *e_new       = NULL;
+   HYPRE_Real      *e_swap;
+
+   HYPRE_Int        i, ii, jj, k, stage, num_stages, lower;
+   HYPRE_Real       res;
+   HYPRE_Real       zero = 0.0;
+
+   if (!cf_marker)
+   {
+      relax_points = 0;
+   }
+   num_sweeps = hypre_max(num_sweeps, 1);
+   num_stages = (relax_type == 8) ? 2 : 1;
+
+   if (num_sweeps > 1)
+   {
+      e_old = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+      e_new = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   }
+
+   for (stage = 0; stage < num_stages; stage++)
+   {
+      lower = (relax_type == 14) ? 0 : (stage == 0);
+
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+
+      for (k = 0; k < num_sweeps; k++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < n; i++)
+         {
+            /*-----------------------------------------------------------
+             * If i is of the right type and its l1 norm is nonzero,
+             * relax point i; otherwise, its correction is zero.
+             *-----------------------------------------------------------*/
+            if ((relax_points == 0 || cf_marker[i] == relax_points) &&
+                l1_norms[i] != zero)
+            {
+               res = r_data[i];
+               if (k > 0)
+               {
+                  for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+                  {
+                     ii = A_diag_j[jj];
+                     if ((lower ? ii < i : ii > i) &&
+                         (relax_points == 0 || cf_marker[ii] == relax_points))
+                     {
+                        res -= A_diag_data[jj] * e_old[ii];
+                     }
+                  }
+               }
+               if (k == num_sweeps - 1)
+               {
+                  u_data[i] += (relax_weight * res) / l1_norms[i];
+               }
+               else
+               {
+                  e_new[i] = res / l1_norms[i];
+               }
+            }
+            else if (k < num_sweeps - 1)
+            {
+               e_new[i] = zero;
+            }
+         }
+         e_swap = e_old; e_old = e_new; e_new = e_swap;
+      }
+   }
+
+   hypre_TFree(e_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(e_new, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -158,7 +158,7 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    hypre_ParCSRMatrixSetRowStartsOwner(S,0);
    S_diag = hypre_ParCSRMatrixDiag(S);
    hypre_CSRMatrixI(S_diag) = hypre_CTAlloc(HYPRE_Int,  num_variables+1, HYPRE_MEMORY_HOST);
-   hypre_CSRMatrixJ(S_diag) = hypre_CTAlloc(HYPRE_Int,  num_nonzeros_diag, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixJ(S_diag) = hypre_CTAllocArena(HYPRE_Int,  num_nonzeros_diag);
    S_offd = hypre_ParCSRMatrixOffd(S);
    hypre_CSRMatrixI(S_offd) = hypre_CTAlloc(HYPRE_Int,  num_variables+1, HYPRE_MEMORY_HOST);
 
@@ -174,13 +174,13 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    if (num_cols_offd)
    {
       A_offd_data = hypre_CSRMatrixData(A_offd);
-      hypre_CSRMatrixJ(S_offd) = hypre_CTAlloc(HYPRE_Int, num_nonzeros_offd, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixJ(S_offd) = hypre_CTAllocArena(HYPRE_Int, num_nonzeros_offd);
       S_temp_offd_j = hypre_CSRMatrixJ(S_offd);
       HYPRE_BigInt *col_map_offd_S = hypre_TAlloc(HYPRE_BigInt,  num_cols_offd, HYPRE_MEMORY_HOST);
       hypre_ParCSRMatrixColMapOffd(S) = col_map_offd_S;
       if (num_functions > 1)
       {
-         dof_func_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
+         dof_func_offd = hypre_CTAllocArena(HYPRE_Int,  num_cols_offd);
       }
 
       S_offd_j = hypre_TAlloc(HYPRE_Int, num_nonzeros_offd, HYPRE_MEMORY_HOST);
@@ -208,8 +208,8 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    if (num_functions > 1)
    {
-      int_buf_data = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                   HYPRE_MEMORY_HOST);
+      int_buf_data = hypre_CTAllocArena(HYPRE_Int,
+                                        hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
       index = 0;
       for (i = 0; i < num_sends; i++)
       {
@@ -227,7 +227,7 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    }
 
    /*HYPRE_Int prefix_sum_workspace[2*(hypre_NumThreads() + 1)];*/
-   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2*(hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+   prefix_sum_workspace = hypre_TAllocArena(HYPRE_Int,  2*(hypre_NumThreads() + 1));
 
    /* give S same nonzero structure as A */
 #ifdef HYPRE_USING_OPENMP
@@ -660,7 +660,7 @@ hypre_BoomerAMGCreateSFromCFMarker(hypre_ParCSRMatrix   *A,
    hypre_ParCSRMatrixSetRowStartsOwner(S,0);
    S_diag = hypre_ParCSRMatrixDiag(S);
    hypre_CSRMatrixI(S_diag) = hypre_CTAlloc(HYPRE_Int,  num_variables+1, HYPRE_MEMORY_HOST);
-   hypre_CSRMatrixJ(S_diag) = hypre_CTAlloc(HYPRE_Int,  num_nonzeros_diag, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixJ(S_diag) = hypre_CTAllocArena(HYPRE_Int,  num_nonzeros_diag);
    S_offd = hypre_ParCSRMatrixOffd(S);
    hypre_CSRMatrixI(S_offd) = hypre_CTAlloc(HYPRE_Int,  num_variables+1, HYPRE_MEMORY_HOST);
 
@@ -675,13 +675,13 @@ hypre_BoomerAMGCreateSFromCFMarker(hypre_ParCSRMatrix   *A,
    if (num_cols_offd)
    {
       A_offd_data = hypre_CSRMatrixData(A_offd);
-      hypre_CSRMatrixJ(S_offd) = hypre_CTAlloc(HYPRE_Int,  num_nonzeros_offd, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixJ(S_offd) = hypre_CTAllocArena(HYPRE_Int,  num_nonzeros_offd);
       S_temp_offd_j = hypre_CSRMatrixJ(S_offd);
       HYPRE_BigInt *col_map_offd_S = hypre_TAlloc(HYPRE_BigInt,  num_cols_offd, HYPRE_MEMORY_HOST);
       hypre_ParCSRMatrixColMapOffd(S) = col_map_offd_S;
       if (num_functions > 1)
       {
-         dof_func_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
+         dof_func_offd = hypre_CTAllocArena(HYPRE_Int,  num_cols_offd);
       }
 
       S_offd_j = hypre_CTAlloc(HYPRE_Int,  num_nonzeros_offd, HYPRE_MEMORY_HOST);
@@ -709,8 +709,8 @@ hypre_BoomerAMGCreateSFromCFMarker(hypre_ParCSRMatrix   *A,
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    if (num_functions > 1)
    {
-      int_buf_data = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg,
-               num_sends), HYPRE_MEMORY_HOST);
+      int_buf_data = hypre_CTAllocArena(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+               num_sends));
       index = 0;
       for (i = 0; i < num_sends; i++)
       {
@@ -728,15 +728,15 @@ hypre_BoomerAMGCreateSFromCFMarker(hypre_ParCSRMatrix   *A,
    /*-------------------------------------------------------------------
     * Get the CF_marker data for the off-processor columns
     *-------------------------------------------------------------------*/
-   if (num_cols_offd) CF_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   if (num_cols_offd) CF_marker_offd = hypre_CTAllocArena(HYPRE_Int, num_cols_offd);
    if (!comm_pkg)
    {
       hypre_MatvecCommPkgCreate(A);
       comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    }
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-   int_buf_data = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg,
-            num_sends), HYPRE_MEMORY_HOST);
+   int_buf_data = hypre_CTAllocArena(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+            num_sends));
 
    index = 0;
    for (i = 0; i < num_sends; i++)
@@ -753,7 +753,7 @@ hypre_BoomerAMGCreateSFromCFMarker(hypre_ParCSRMatrix   *A,
    hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
 
    /*HYPRE_Int prefix_sum_workspace[2*(hypre_NumThreads() + 1)];*/
-   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2*(hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+   prefix_sum_workspace = hypre_TAllocArena(HYPRE_Int,  2*(hypre_NumThreads() + 1));
 
    /* give S same nonzero structure as A */
 
@@ -52,6 +52,25 @@ HYPRE_ParCSRMatrixDestroy( HYPRE_ParCSRMatrix matrix )
    return( hypre_ParCSRMatrixDestroy( (hypre_ParCSRMatrix *) matrix ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixGetMemorySize
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixGetMemorySize( HYPRE_ParCSRMatrix  matrix,
+                                 size_t             *size )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *size = hypre_ParCSRMatrixMemorySize( (hypre_ParCSRMatrix *) matrix );
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixInitialize
  *--------------------------------------------------------------------------*/
@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,7 +38,78 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommPkg:
+ *   Node-aware plan for the job 1 exchange of a hypre_ParCSRCommPkg.
+ *   Messages to ranks on the same node are sent directly.  Data for ranks on
+ *   other nodes is gathered on the rank of the node that handles the
+ *   destination node (stage 1), sent with one message per pair of nodes
+ *   (stage 2) and scattered on the destination node (stage 3).
+ *
+ *   The send_map of a stage indexes the data of the previous stage (the send
+ *   data of the exchange for stage 1), and recv_map indexes the receive data
+ *   of the exchange with the data received in stage 3.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int   num_sends;
+   HYPRE_Int  *send_procs;
+   HYPRE_Int  *send_starts;
+   HYPRE_Int  *send_map;
+   HYPRE_Int   num_recvs;
+   HYPRE_Int  *recv_procs;
+   HYPRE_Int  *recv_starts;
+} hypre_ParCSRNodeCommStage;
+
+typedef struct
+{
+   /* indices of the on-node send_procs and recv_procs of the comm_pkg */
+   HYPRE_Int                  num_local_sends;
+   HYPRE_Int                 *local_sends;
+   HYPRE_Int                  num_local_recvs;
+   HYPRE_Int                 *local_recvs;
+
+   hypre_ParCSRNodeCommStage  stages[3];
+   HYPRE_Int                 *recv_map;
+} hypre_ParCSRNodeCommPkg;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommPkg:
+ *   Shared memory plan for the job 1 exchange of a hypre_ParCSRCommPkg.
+ *   send_buffer is this rank's part of data_win, in send_map_starts layout,
+ *   and flags its part of flag_win: flags[0] is the epoch of the data in
+ *   send_buffer and flags[1+l] the last epoch read by node rank l.  Each
+ *   on-node receive reads the segment recv_segments[k] of the sender once
+ *   recv_flags[k][0] has reached the epoch of the exchange.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_MPI_Win         data_win;
+   hypre_MPI_Win         flag_win;
+   HYPRE_Complex        *send_buffer;
+   volatile HYPRE_Int   *flags;
+   HYPRE_Int             my_local_id;
+   HYPRE_Int             epoch;
+   /* an exchange is in progress; others fall back to messages */
+   HYPRE_Int             busy;
+
+   /* indices of the on-node send_procs (with their node ranks) and
+      recv_procs of the comm_pkg, and of the others */
+   HYPRE_Int             num_local_sends;
+   HYPRE_Int            *local_sends;
+   HYPRE_Int            *local_send_ids;
+   HYPRE_Int             num_local_recvs;
+   HYPRE_Int            *local_recvs;
+   HYPRE_Complex       **recv_segments;
+   volatile HYPRE_Int  **recv_flags;
+   HYPRE_Int             num_remote_sends;
+   HYPRE_Int            *remote_sends;
+   HYPRE_Int             num_remote_recvs;
+   HYPRE_Int            *remote_recvs;
+} hypre_ParCSRShmCommPkg;
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -59,6 +129,12 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   /* stage buffers of a node-aware exchange in progress */
+   HYPRE_Complex        *node_comm_buffer;
+   /* a shared memory exchange is in progress */
+   HYPRE_Int             shm_comm;
+   /* a neighborhood collective exchange is in progress */
+   HYPRE_Int             neighbor_comm;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -81,9 +157,29 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* persistent handles, created on first use when persistent communication
+      is on (HYPRE_SetPersistentComm); the multivector handles are for the
+      interleaved halos of jobs 1 and 2 and are rebuilt if num_vectors changes */
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+   hypre_ParCSRPersistentCommHandle *persistent_mv_comm_handles[2];
+   HYPRE_Int                         persistent_mv_num_vectors[2];
+
+   /* distributed graph communicators for the neighborhood collectives
+      (HYPRE_SetNeighborComm): [0] has the edges of job 1 (recv_procs ->
+      send_procs), [1] those of job 2; counts and displacements are per
+      neighbor, in entries, for job 1 (swapped for job 2) */
+   HYPRE_Int                    has_neighbor_comm;
+   MPI_Comm                     neighbor_comm[2];
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+
+   /* node-aware plan for job 1 (hypre_ParCSRCommPkgCreateNodeComm) */
+   hypre_ParCSRNodeCommPkg     *node_comm_pkg;
+
+   /* shared memory plan for job 1 (hypre_ParCSRCommPkgCreateShmComm) */
+   hypre_ParCSRShmCommPkg      *shm_comm_pkg;
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -116,6 +212,14 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg,i)      (comm_pkg -> neighbor_comm[i])
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
+#define hypre_ParCSRCommPkgNodeCommPkg(comm_pkg)         (comm_pkg -> node_comm_pkg)
+#define hypre_ParCSRCommPkgShmCommPkg(comm_pkg)          (comm_pkg -> shm_comm_pkg)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -159,6 +263,9 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleNodeCommBuffer(comm_handle)         (comm_handle -> node_comm_buffer)
+#define hypre_ParCSRCommHandleShmComm(comm_handle)                (comm_handle -> shm_comm)
+#define hypre_ParCSRCommHandleNeighborComm(comm_handle)           (comm_handle -> neighbor_comm)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 #ifndef hypre_PARCSR_ASSUMED_PART
@@ -466,6 +573,66 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * Plan of a product C = A B or C = A^T B of Parallel CSR matrices:
+ * everything that only depends on the sparsity patterns of A, B and C, so
+ * that the values of C can be recomputed for new values of A and B.
+ *
+ * The columns of C are numbered in one local index space (codes): the diag
+ * columns, then the offd columns.  For C = A B the plan holds the pattern of
+ * the rows of B needed from other processes and the entry-wise package that
+ * exchanges their values.  For C = A^T B it holds the transposed pattern of
+ * A and the pattern of the contributions to rows of C owned by other
+ * processes, with the positions in C of the contributions received.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_ParCSRMatMatPlan_struct
+{
+   HYPRE_Int             transpose;      /* C = A^T B instead of C = A B */
+
+   HYPRE_Int             num_codes;      /* columns of C (diag and offd) */
+   HYPRE_Int             num_cols_diag;  /* diag columns of C */
+   HYPRE_Int            *B_offd_code;    /* codes of the offd columns of B */
+
+   /* transposed patterns of A_diag and A_offd and the positions of their
+      entries in A (C = A^T B) */
+   HYPRE_Int            *AT_diag_i;
+   HYPRE_Int            *AT_diag_j;
+   HYPRE_Int            *AT_diag_pos;
+   HYPRE_Int            *AT_offd_i;
+   HYPRE_Int            *AT_offd_j;
+   HYPRE_Int            *AT_offd_pos;
+
+   /* values exchanged with the other processes */
+   hypre_ParCSRCommPkg  *comm_pkg;       /* entry-wise package */
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;      /* C = A B: rows of B sent */
+   HYPRE_Int            *send_i;
+   HYPRE_Int            *send_code;      /* C = A^T B: local columns of B */
+   HYPRE_Complex        *send_data;
+   HYPRE_Int            *recv_i;         /* C = A B: external rows of B */
+   HYPRE_Int            *recv_code;      /* C = A B: codes of the entries,
+                                            C = A^T B: positions in C */
+   HYPRE_Complex        *recv_data;
+
+   /* triple product C = A^T (B D): plan of B D and the product B D */
+   struct hypre_ParCSRMatMatPlan_struct *inner;
+   hypre_ParCSRMatrix   *inner_matrix;
+
+} hypre_ParCSRMatMatPlan;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the product plan
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRMatMatPlanTranspose(plan)      ((plan) -> transpose)
+#define hypre_ParCSRMatMatPlanNumCodes(plan)       ((plan) -> num_codes)
+#define hypre_ParCSRMatMatPlanNumColsDiag(plan)    ((plan) -> num_cols_diag)
+#define hypre_ParCSRMatMatPlanBOffdCode(plan)      ((plan) -> B_offd_code)
+#define hypre_ParCSRMatMatPlanCommPkg(plan)        ((plan) -> comm_pkg)
+#define hypre_ParCSRMatMatPlanInner(plan)          ((plan) -> inner)
+#define hypre_ParCSRMatMatPlanInnerMatrix(plan)    ((plan) -> inner_matrix)
+
 #endif
 /******************************************************************************
  *
@@ -639,6 +806,7 @@ HYPRE_Int hypre_MatTCommPkgCreate ( hypre_ParCSRMatrix *A );
 /* HYPRE_parcsr_matrix.c */
 HYPRE_Int HYPRE_ParCSRMatrixCreate ( MPI_Comm comm , HYPRE_BigInt global_num_rows , HYPRE_BigInt global_num_cols , HYPRE_BigInt *row_starts , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_offd , HYPRE_Int num_nonzeros_diag , HYPRE_Int num_nonzeros_offd , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixDestroy ( HYPRE_ParCSRMatrix matrix );
+HYPRE_Int HYPRE_ParCSRMatrixGetMemorySize ( HYPRE_ParCSRMatrix matrix , size_t *size );
 HYPRE_Int HYPRE_ParCSRMatrixInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name , HYPRE_ParCSRMatrix *matrix );
@@ -748,15 +916,34 @@ HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A , hypre_P
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in, HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVector ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int num_vectors , HYPRE_Complex *send_data , HYPRE_Complex *recv_data );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
+HYPRE_Int hypre_ParCSRCommPkgHaloBuffers ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Complex **send_data_ptr , HYPRE_Complex **recv_data_ptr , HYPRE_Int *persistent_ptr );
+hypre_ParCSRCommHandle *hypre_ParCSRCommPkgHaloStart ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int persistent , HYPRE_Complex *send_data , HYPRE_Complex *recv_data );
+HYPRE_Int hypre_ParCSRCommPkgHaloWait ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int persistent , hypre_ParCSRCommHandle *comm_handle , HYPRE_Complex *recv_data );
+HYPRE_Int hypre_ParCSRCommPkgHaloFree ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int persistent , HYPRE_Complex *send_data , HYPRE_Complex *recv_data );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm , HYPRE_BigInt *col_map_offd , HYPRE_BigInt first_col_diag , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_diag , HYPRE_Int num_cols_offd , HYPRE_Int *p_num_recvs , HYPRE_Int **p_recv_procs , HYPRE_Int **p_recv_vec_starts , HYPRE_Int *p_num_sends , HYPRE_Int **p_send_procs , HYPRE_Int **p_send_map_starts , HYPRE_Int **p_send_map_elmts );
 HYPRE_Int
 hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag, HYPRE_Int num_cols_offd, hypre_ParCSRCommPkg *comm_pkg);
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatrixPersistentCommSetup ( hypre_ParCSRMatrix *A , HYPRE_Int transpose );
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRMatrixNeighborCommSetup ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
+size_t hypre_ParCSRCommPkgMemorySize ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros , HYPRE_Int num_rows , HYPRE_Complex *a_data , HYPRE_Int *a_i , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros , HYPRE_Complex *a_data , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_jdata_datatype );
 HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_cols, HYPRE_BigInt first_col_diag, HYPRE_Int num_cols_diag, HYPRE_BigInt *col_starts, hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg **extend_comm_pkg);
+/* par_csr_matmat_plan.c */
+hypre_ParCSRMatMatPlan *hypre_ParCSRMatMatPlanCreate ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C , HYPRE_Int transpose );
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatSymbolic ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatMatPlan **plan_ptr );
+hypre_ParCSRMatrix *hypre_ParCSRTMatMatSymbolic ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatMatNumeric ( hypre_ParCSRMatMatPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C );
+hypre_ParCSRMatMatPlan *hypre_ParCSRMatrixRAPPlanCreate ( hypre_ParCSRMatrix *R , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP );
+HYPRE_Int hypre_ParCSRMatrixRAPNumeric ( hypre_ParCSRMatMatPlan *plan , hypre_ParCSRMatrix *R , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP );
+
 /* par_csr_matop.c */
 void hypre_ParMatmul_RowSizes (HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i , HYPRE_Int **C_offd_i , HYPRE_Int *A_diag_i , HYPRE_Int *A_diag_j , HYPRE_Int *A_offd_i , HYPRE_Int *A_offd_j , HYPRE_Int *B_diag_i , HYPRE_Int *B_diag_j , HYPRE_Int *B_offd_i , HYPRE_Int *B_offd_j , HYPRE_Int *B_ext_diag_i , HYPRE_Int *B_ext_diag_j , HYPRE_Int *B_ext_offd_i , HYPRE_Int *B_ext_offd_j , HYPRE_Int *map_B_to_C , HYPRE_Int *C_diag_size , HYPRE_Int *C_offd_size , HYPRE_Int num_rows_diag_A , HYPRE_Int num_cols_offd_A , HYPRE_Int allsquare , HYPRE_Int num_cols_diag_B , HYPRE_Int num_cols_offd_B , HYPRE_Int num_cols_offd_C );
 hypre_ParCSRMatrix *hypre_ParMatmul ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B );
@@ -780,13 +967,13 @@ hypre_CSRMatrix* hypre_ExchangeExternalRowsWait(void *vequest);
 HYPRE_Int hypre_ExchangeExternalRowsDeviceInit( hypre_CSRMatrix *B_ext, hypre_ParCSRCommPkg *comm_pkg_A, void **request_ptr);
 hypre_CSRMatrix* hypre_ExchangeExternalRowsDeviceWait(void *vrequest);
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreateMultiVector(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandleMultiVector(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors);
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
 hypre_CSRMatrix* hypre_ParcsrGetExternalRowsWait(void *vrequest);
@@ -813,6 +1000,7 @@ void hypre_ParCSRMatrixDropEntries ( hypre_ParCSRMatrix *C , hypre_ParCSRMatrix
 /* par_csr_matrix.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatrixCreate ( MPI_Comm comm , HYPRE_BigInt global_num_rows , HYPRE_BigInt global_num_cols , HYPRE_BigInt *row_starts , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_offd , HYPRE_Int num_nonzeros_diag , HYPRE_Int num_nonzeros_offd );
 HYPRE_Int hypre_ParCSRMatrixDestroy ( hypre_ParCSRMatrix *matrix );
+size_t hypre_ParCSRMatrixMemorySize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixInitialize_v2( hypre_ParCSRMatrix *matrix, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
@@ -820,6 +1008,8 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
+HYPRE_Int hypre_ParCSRMatrixSetSELL ( hypre_ParCSRMatrix *matrix , HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int hypre_ParCSRMatrixSetDataFloat ( hypre_ParCSRMatrix *matrix , HYPRE_Int keep_data );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix , const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix , const HYPRE_Int base_i , const HYPRE_Int base_j , const char *filename );
@@ -841,14 +1031,36 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_In
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int type);
 
+/* par_csr_node_comm.c */
+HYPRE_Int hypre_ParCSRCommPkgCreateNodeComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNodeComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Real hypre_ParCSRCommPkgAvgMessageSize ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRMatrixNodeCommSetup ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRNodeCommStart ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int *num_requests_ptr , hypre_MPI_Request **requests_ptr , HYPRE_Complex **buffer_ptr );
+HYPRE_Int hypre_ParCSRNodeCommFinish ( hypre_ParCSRCommHandle *comm_handle );
+
+/* par_csr_shm_comm.c */
+HYPRE_Int hypre_ParCSRCommPkgCreateShmComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyShmComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRMatrixShmCommSetup ( hypre_ParCSRMatrix *A );
+HYPRE_Complex *hypre_ParCSRCommPkgShmSendBuffer ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRShmCommStart ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int *num_requests_ptr , hypre_MPI_Request **requests_ptr );
+HYPRE_Int hypre_ParCSRShmCommFinish ( hypre_ParCSRCommHandle *comm_handle );
+
 /* par_csr_matvec.c */
 // y = alpha*A*x + beta*b
+HYPRE_Int hypre_ParCSRMatrixMatvecOverlapped ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *b, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y , HYPRE_Int *CF_marker , HYPRE_Int fpt );
 
+/* par_csr_rap_stream.c */
+HYPRE_Int hypre_ParCSRMatrixRAPStreamInit( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose, void **request_ptr );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPStreamWait( void *request );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPStream( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
+
 /* par_csr_triplemat.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
 hypre_ParCSRMatrix *hypre_ParCSRMatMatHost( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
@@ -869,6 +1081,7 @@ HYPRE_Int HYPRE_Destroy2DSystem ( HYPRE_ParCSR_System_Problem *sys_prob );
 hypre_ParVector *hypre_ParVectorCreate ( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning );
 hypre_ParVector *hypre_ParMultiVectorCreate ( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_Int num_vectors );
 HYPRE_Int hypre_ParVectorDestroy ( hypre_ParVector *vector );
+size_t hypre_ParVectorMemorySize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize_v2( hypre_ParVector *vector, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParVectorSetDataOwner ( hypre_ParVector *vector , HYPRE_Int owns_data );
@@ -886,6 +1099,8 @@ HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Real hypre_ParVectorAxpyNorm ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorMultiInnerProdInit ( HYPRE_Int nprod , hypre_ParVector **x , hypre_ParVector **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -40,10 +39,14 @@ static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 
 /**
  * When send_data and recv_data are NULL, buffers are internally allocated
- * and CommHandle owns the buffer
+ * and CommHandle owns the buffer.  For jobs 1 and 2, the buffers hold
+ * num_vectors interleaved values per entry (see
+ * hypre_ParCSRCommHandleCreateMultiVector).
  */
 hypre_ParCSRPersistentCommHandle*
-hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+hypre_ParCSRPersistentCommHandleCreateMultiVector( HYPRE_Int            job,
+                                                   hypre_ParCSRCommPkg *comm_pkg,
+                                                   HYPRE_Int            num_vectors )
 {
    HYPRE_Int i;
    size_t num_bytes_send, num_bytes_recv;
@@ -67,16 +70,16 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
    switch (job_type)
    {
       case HYPRE_COMM_PKG_JOB_COMPLEX:
-         num_bytes_send = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
-         recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs), HYPRE_MEMORY_HOST);
+         num_bytes_send = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors;
+         num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors;
+         send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors, HYPRE_MEMORY_HOST);
+         recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors, HYPRE_MEMORY_HOST);
          for (i = 0; i < num_recvs; ++i)
          {
             HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
             HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
             HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_Complex *)recv_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
+            hypre_MPI_Recv_init( (HYPRE_Complex *)recv_buff + vec_start * num_vectors, vec_len * num_vectors, HYPRE_MPI_COMPLEX,
                                   ip, 0, comm, requests + i );
          }
          for (i = 0; i < num_sends; ++i)
@@ -84,22 +87,22 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
             HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
             HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
             HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_Complex *)send_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
+            hypre_MPI_Send_init( (HYPRE_Complex *)send_buff + vec_start * num_vectors, vec_len * num_vectors, HYPRE_MPI_COMPLEX,
                                  ip, 0, comm, requests + num_recvs + i );
          }
          break;
 
       case HYPRE_COMM_PKG_JOB_COMPLEX_TRANSPOSE:
-         num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_send = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
-         send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs), HYPRE_MEMORY_HOST);
+         num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors;
+         num_bytes_send = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors;
+         recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors, HYPRE_MEMORY_HOST);
+         send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) * num_vectors, HYPRE_MEMORY_HOST);
          for (i = 0; i < num_sends; ++i)
          {
             HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
             HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
             HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_Complex *)recv_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
+            hypre_MPI_Recv_init( (HYPRE_Complex *)recv_buff + vec_start * num_vectors, vec_len * num_vectors, HYPRE_MPI_COMPLEX,
                                  ip, 0, comm, requests + i );
          }
          for (i = 0; i < num_recvs; ++i)
@@ -107,7 +110,7 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
             HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
             HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
             HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_Complex *)send_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
+            hypre_MPI_Send_init( (HYPRE_Complex *)send_buff + vec_start * num_vectors, vec_len * num_vectors, HYPRE_MPI_COMPLEX,
                                  ip, 0, comm, requests + num_sends + i );
          }
          break;
@@ -217,6 +220,11 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
    return ( comm_handle );
 }
 
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+{
+   return hypre_ParCSRPersistentCommHandleCreateMultiVector(job, comm_pkg, 1);
+}
 
 hypre_ParCSRPersistentCommHandle*
 hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
@@ -231,9 +239,41 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
    return comm_pkg->persistent_comm_handles[type];
 }
 
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRCommPkgGetPersistentCommHandleMultiVector( HYPRE_Int            job,
+                                                       hypre_ParCSRCommPkg *comm_pkg,
+                                                       HYPRE_Int            num_vectors )
+{
+   HYPRE_Int k = job - 1;
+
+   hypre_assert(job == 1 || job == 2);
+
+   if (comm_pkg->persistent_mv_comm_handles[k] &&
+       comm_pkg->persistent_mv_num_vectors[k] != num_vectors)
+   {
+      hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_mv_comm_handles[k]);
+      comm_pkg->persistent_mv_comm_handles[k] = NULL;
+   }
+
+   if (!comm_pkg->persistent_mv_comm_handles[k])
+   {
+      comm_pkg->persistent_mv_comm_handles[k] =
+         hypre_ParCSRPersistentCommHandleCreateMultiVector(job, comm_pkg, num_vectors);
+      comm_pkg->persistent_mv_num_vectors[k] = num_vectors;
+   }
+
+   return comm_pkg->persistent_mv_comm_handles[k];
+}
+
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+   {
+      hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+   }
    hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
@@ -249,12 +289,16 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* callers may pack directly into the send buffer of the handle */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -284,15 +328,74 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgNeighborStart
+ *
+ * Starts the exchange of job (1, 2, 11, 12, 21 or 22) as one
+ * MPI_Ineighbor_alltoallv on the graph communicator of comm_pkg.  The
+ * neighbors of a graph are ordered as recv_procs and send_procs (swapped for
+ * the transpose graph), so the data layout is that of the point-to-point
+ * exchange.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRCommPkgNeighborStart( HYPRE_Int            job,
+                                  hypre_ParCSRCommPkg *comm_pkg,
+                                  void                *send_data,
+                                  void                *recv_data,
+                                  hypre_MPI_Request   *request )
+{
+   HYPRE_Int           transpose = (job % 10 == 2);
+   hypre_MPI_Datatype  datatype;
+   hypre_int          *send_counts, *send_displs, *recv_counts, *recv_displs;
+
+   switch (job)
+   {
+      case 11:
+      case 12:
+         datatype = HYPRE_MPI_INT;
+         break;
+      case 21:
+      case 22:
+         datatype = HYPRE_MPI_BIG_INT;
+         break;
+      default:
+         datatype = HYPRE_MPI_COMPLEX;
+         break;
+   }
+
+   if (transpose)
+   {
+      send_counts = hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg);
+      send_displs = hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg);
+      recv_counts = hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg);
+      recv_displs = hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg);
+   }
+   else
+   {
+      send_counts = hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg);
+      send_displs = hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg);
+      recv_counts = hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg);
+      recv_displs = hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg);
+   }
+
+   hypre_MPI_Ineighbor_alltoallv(send_data, send_counts, send_displs, datatype,
+                                 recv_data, recv_counts, recv_displs, datatype,
+                                 hypre_ParCSRCommPkgNeighborComm(comm_pkg, transpose),
+                                 request);
+}
 
 hypre_ParCSRCommHandle*
 hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
@@ -325,6 +428,11 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    HYPRE_Int                  ip, vec_start, vec_len;
    void                      *send_data;
    void                      *recv_data;
+   HYPRE_Complex             *node_comm_buffer = NULL;
+   HYPRE_Int                  use_node_comm = (job == 1 && hypre_ParCSRCommPkgNodeCommPkg(comm_pkg));
+   HYPRE_Int                  use_shm_comm  = (job == 1 && hypre_ParCSRCommPkgShmCommPkg(comm_pkg) &&
+                                               !hypre_ParCSRCommPkgShmCommPkg(comm_pkg) -> busy);
+   HYPRE_Int                  use_neighbor_comm = 0;
 
    /*--------------------------------------------------------------------
     * hypre_Initialize sets up a communication handle,
@@ -412,152 +520,180 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
 #else /* #ifndef HYPRE_WITH_GPU_AWARE_MPI */
    send_data = send_data_in;
    recv_data = recv_data_in;
+   /* the stages of the node-aware exchange are packed on the host, and
+      the shared memory window is host memory */
+   use_node_comm = 0;
+   use_shm_comm  = 0;
    // TODO RL
    HYPRE_CUDA_CALL( cudaStreamSynchronize(hypre_HandleCudaComputeStream(hypre_handle())) );
 #endif
 
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
-
-   hypre_MPI_Comm_size(comm, &num_procs);
-   hypre_MPI_Comm_rank(comm, &my_id);
+   if (use_node_comm)
+   {
+      hypre_ParCSRNodeCommStart(comm_pkg, (HYPRE_Complex *) send_data, (HYPRE_Complex *) recv_data,
+                                &num_requests, &requests, &node_comm_buffer);
+   }
+   else if (use_shm_comm)
+   {
+      hypre_ParCSRShmCommStart(comm_pkg, (HYPRE_Complex *) send_data, (HYPRE_Complex *) recv_data,
+                               &num_requests, &requests);
+   }
+   else if ( hypre_ParCSRCommPkgHasNeighborComm(comm_pkg) &&
+             hypre_HandleNeighborComm(hypre_handle()) )
+   {
+      /* a single neighborhood collective replaces the sends and receives */
+      use_neighbor_comm = 1;
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
-   j = 0;
-   switch (job)
+      hypre_ParCSRCommPkgNeighborStart(job, comm_pkg, send_data, recv_data, requests);
+   }
+   else
    {
-      case  1:
-      {
-         HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
-         HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
-            hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
-      }
-      case  2:
-      {
-         HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
-         HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
-            hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
-      }
-      case  11:
-      {
-         HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
-         HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
-      }
-      case  12:
+      num_requests = num_sends + num_recvs;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+      hypre_MPI_Comm_size(comm, &num_procs);
+      hypre_MPI_Comm_rank(comm, &my_id);
+
+      j = 0;
+      switch (job)
       {
-         HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
-         HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
-         for (i = 0; i < num_sends; i++)
+         case  1:
          {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
+            HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+               hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_recvs; i++)
+         case  2:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
+            HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+               hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
-      }
-      case  21:
-      {
-         HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
-         HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
-         for (i = 0; i < num_recvs; i++)
+         case  11:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
+            HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_sends; i++)
+         case  12:
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
+            HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
-      }
-      case  22:
-      {
-         HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
-         HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
-         for (i = 0; i < num_sends; i++)
+         case  21:
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
+            HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_recvs; i++)
+         case  22:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
+            HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
       }
    }
+
    /*--------------------------------------------------------------------
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
@@ -575,6 +711,86 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
    hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+   hypre_ParCSRCommHandleNodeCommBuffer(comm_handle)     = node_comm_buffer;
+   hypre_ParCSRCommHandleShmComm(comm_handle)            = use_shm_comm;
+   hypre_ParCSRCommHandleNeighborComm(comm_handle)       = use_neighbor_comm;
+
+   return ( comm_handle );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateMultiVector
+ *
+ * Same as hypre_ParCSRCommHandleCreate with job = 1 (Matvec) or job = 2
+ * (MatvecT), but exchanges num_vectors values per entry with a single
+ * message per neighbor.  send_data and recv_data are host HYPRE_Complex
+ * arrays stored row-wise (interleaved): value k of entry i is at
+ * i*num_vectors + k.  The handle is completed with
+ * hypre_ParCSRCommHandleDestroy.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreateMultiVector( HYPRE_Int            job,
+                                         hypre_ParCSRCommPkg *comm_pkg,
+                                         HYPRE_Int            num_vectors,
+                                         HYPRE_Complex       *send_data,
+                                         HYPRE_Complex       *recv_data )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm                   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 *send_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                 *recv_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   HYPRE_Int                  num_requests = num_sends + num_recvs;
+   hypre_ParCSRCommHandle    *comm_handle;
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  i, j, ip, vec_start, vec_len;
+
+   /* job = 2 reverses the roles of the send and receive maps */
+   HYPRE_Int                  num_out     = job == 2 ? num_recvs   : num_sends;
+   HYPRE_Int                  num_in      = job == 2 ? num_sends   : num_recvs;
+   HYPRE_Int                 *out_starts  = job == 2 ? recv_starts : send_starts;
+   HYPRE_Int                 *in_starts   = job == 2 ? send_starts : recv_starts;
+
+   if (job != 1 && job != 2)
+   {
+      hypre_error_in_arg(1);
+      return NULL;
+   }
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (i = 0; i < num_in; i++)
+   {
+      ip = job == 2 ? hypre_ParCSRCommPkgSendProc(comm_pkg, i) : hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+      vec_start = in_starts[i];
+      vec_len = in_starts[i+1] - vec_start;
+      hypre_MPI_Irecv(&recv_data[vec_start*num_vectors], vec_len*num_vectors, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_out; i++)
+   {
+      ip = job == 2 ? hypre_ParCSRCommPkgRecvProc(comm_pkg, i) : hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+      vec_start = out_starts[i];
+      vec_len = out_starts[i+1] - vec_start;
+      hypre_MPI_Isend(&send_data[vec_start*num_vectors], vec_len*num_vectors, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = out_starts[num_out] * num_vectors * sizeof(HYPRE_Complex);
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = in_starts[num_in] * num_vectors * sizeof(HYPRE_Complex);
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
 
    return ( comm_handle );
 }
@@ -587,7 +803,17 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
       return hypre_error_flag;
    }
 
-   if (hypre_ParCSRCommHandleNumRequests(comm_handle))
+   if (hypre_ParCSRCommHandleNodeCommBuffer(comm_handle))
+   {
+      /* completes the node-aware exchange and all its requests */
+      hypre_ParCSRNodeCommFinish(comm_handle);
+   }
+   else if (hypre_ParCSRCommHandleShmComm(comm_handle))
+   {
+      /* completes the messages and the on-node reads */
+      hypre_ParCSRShmCommFinish(comm_handle);
+   }
+   else if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
       hypre_MPI_Status *status0;
       status0 = hypre_CTAlloc(hypre_MPI_Status,
@@ -626,6 +852,106 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgHaloBuffers, hypre_ParCSRCommPkgHaloStart,
+ * hypre_ParCSRCommPkgHaloWait, hypre_ParCSRCommPkgHaloFree
+ *
+ * Host halo exchange (job 1) for smoothers.  If persistent communication is
+ * on, Buffers sets *persistent_ptr, the send and receive buffers are those of
+ * the persistent handle of comm_pkg and the exchange restarts its requests;
+ * otherwise the buffers are allocated here (the send buffer is the shared
+ * memory window of comm_pkg if it has one) and a regular comm handle is used.
+ * The flag is passed on to Start, Wait and Free.  Start returns NULL in the
+ * persistent case.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgHaloBuffers( hypre_ParCSRCommPkg  *comm_pkg,
+                                HYPRE_Complex       **send_data_ptr,
+                                HYPRE_Complex       **recv_data_ptr,
+                                HYPRE_Int            *persistent_ptr )
+{
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+   HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+
+   if (hypre_HandlePersistentComm(hypre_handle()))
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+      *send_data_ptr  = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      *recv_data_ptr  = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      *persistent_ptr = 1;
+   }
+   else
+   {
+      *send_data_ptr = hypre_ParCSRCommPkgShmSendBuffer(comm_pkg);
+      if (!*send_data_ptr)
+      {
+         *send_data_ptr = hypre_CTAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                        HYPRE_MEMORY_HOST);
+      }
+      *recv_data_ptr = hypre_CTAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
+                                     HYPRE_MEMORY_HOST);
+      *persistent_ptr = 0;
+   }
+
+   return hypre_error_flag;
+}
+
+hypre_ParCSRCommHandle *
+hypre_ParCSRCommPkgHaloStart( hypre_ParCSRCommPkg *comm_pkg,
+                              HYPRE_Int            persistent,
+                              HYPRE_Complex       *send_data,
+                              HYPRE_Complex       *recv_data )
+{
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleStart(comm_pkg->persistent_comm_handles[HYPRE_COMM_PKG_JOB_COMPLEX],
+                                            HYPRE_MEMORY_HOST, send_data);
+      return NULL;
+   }
+
+   return hypre_ParCSRCommHandleCreate(1, comm_pkg, send_data, recv_data);
+}
+
+HYPRE_Int
+hypre_ParCSRCommPkgHaloWait( hypre_ParCSRCommPkg    *comm_pkg,
+                             HYPRE_Int               persistent,
+                             hypre_ParCSRCommHandle *comm_handle,
+                             HYPRE_Complex          *recv_data )
+{
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleWait(comm_pkg->persistent_comm_handles[HYPRE_COMM_PKG_JOB_COMPLEX],
+                                           HYPRE_MEMORY_HOST, recv_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRCommPkgHaloFree( hypre_ParCSRCommPkg *comm_pkg,
+                             HYPRE_Int            persistent,
+                             HYPRE_Complex       *send_data,
+                             HYPRE_Complex       *recv_data )
+{
+   if (!persistent)
+   {
+      if (!comm_pkg || !hypre_ParCSRCommPkgShmCommPkg(comm_pkg) ||
+          send_data != hypre_ParCSRCommPkgShmCommPkg(comm_pkg) -> send_buffer)
+      {
+         hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 
 /* hypre_MatCommPkgCreate_core does all the communications and computations for
    hypre_MatCommPkgCreate ( hypre_ParCSRMatrix *A) and
@@ -943,6 +1269,159 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                     comm_pkg );
 #endif
 
+   if (hypre_HandleNeighborComm(hypre_handle()))
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPersistentCommSetup
+ *
+ * Creates the persistent handles for the halo exchanges of A (job 1, and
+ * job 2 if transpose is nonzero), creating the comm_pkg of A if needed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPersistentCommSetup( hypre_ParCSRMatrix *A,
+                                       HYPRE_Int           transpose )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+   if (transpose)
+   {
+      hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ *
+ * Creates the distributed graph communicators used by the halo exchanges of
+ * comm_pkg when neighborhood collectives are on (HYPRE_SetNeighborComm).
+ * This is collective on the communicator of comm_pkg.  If the MPI library
+ * cannot create them, comm_pkg keeps using point-to-point messages.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm    comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int  *send_procs = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int  *recv_procs = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int  *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int  *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   hypre_int  *send_counts, *send_displs, *recv_counts, *recv_displs;
+   HYPRE_Int   i, ierr;
+
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   ierr = hypre_MPI_Dist_graph_create_adjacent(comm, num_recvs, recv_procs,
+                                               num_sends, send_procs, 0,
+                                               &hypre_ParCSRCommPkgNeighborComm(comm_pkg, 0));
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      return hypre_error_flag;
+   }
+   ierr = hypre_MPI_Dist_graph_create_adjacent(comm, num_sends, send_procs,
+                                               num_recvs, recv_procs, 0,
+                                               &hypre_ParCSRCommPkgNeighborComm(comm_pkg, 1));
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg, 0));
+      return hypre_error_flag;
+   }
+
+   /* one extra entry, so that the arrays are not NULL without neighbors */
+   send_counts = hypre_TAlloc(hypre_int, num_sends + 1, HYPRE_MEMORY_HOST);
+   send_displs = hypre_TAlloc(hypre_int, num_sends + 1, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_TAlloc(hypre_int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   recv_displs = hypre_TAlloc(hypre_int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      send_displs[i] = (hypre_int) send_map_starts[i];
+      send_counts[i] = (hypre_int) (send_map_starts[i+1] - send_map_starts[i]);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_displs[i] = (hypre_int) recv_vec_starts[i];
+      recv_counts[i] = (hypre_int) (recv_vec_starts[i+1] - recv_vec_starts[i]);
+   }
+
+   hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg) = send_counts;
+   hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg) = send_displs;
+   hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg) = recv_counts;
+   hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg) = recv_displs;
+   hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)    = 1;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   if (!hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg, 0));
+   hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg, 1));
+   hypre_TFree(hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgHasNeighborComm(comm_pkg) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixNeighborCommSetup
+ *
+ * Creates the graph communicators of the comm_pkg of A (creating the
+ * comm_pkg if needed).  Collective on the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixNeighborCommSetup( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      /* creates the graph communicators too */
+      hypre_MatvecCommPkgCreate(A);
+   }
+   else
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(hypre_ParCSRMatrixCommPkg(A));
+   }
+
    return hypre_error_flag;
 }
 
@@ -950,7 +1429,6 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
@@ -959,7 +1437,16 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
    }
-#endif
+   for (i = 0; i < 2; ++i)
+   {
+      if (comm_pkg->persistent_mv_comm_handles[i])
+      {
+         hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_mv_comm_handles[i]);
+      }
+   }
+   hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
+   hypre_ParCSRCommPkgDestroyNodeComm(comm_pkg);
+   hypre_ParCSRCommPkgDestroyShmComm(comm_pkg);
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
@@ -991,6 +1478,45 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgMemorySize
+ *
+ * Bytes held by the communication maps of comm_pkg (persistent handles and
+ * the node-aware and shared memory plans are not included).
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParCSRCommPkgMemorySize( hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int num_sends, num_recvs;
+   size_t    size;
+
+   if (!comm_pkg)
+   {
+      return 0;
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+
+   size  = sizeof(hypre_ParCSRCommPkg);
+   size += sizeof(HYPRE_Int) * (2 * (num_sends + num_recvs) + 2);
+   if (hypre_ParCSRCommPkgSendMapElmts(comm_pkg))
+   {
+      size += sizeof(HYPRE_Int) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   }
+   if (hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg))
+   {
+      size += sizeof(HYPRE_Int) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   }
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      size += sizeof(hypre_int) * 2 * (num_sends + num_recvs);
+   }
+
+   return size;
+}
+
 /* AHB 11/06 : alternate to the extend function below - creates a
  * second comm pkg based on indices - this makes it easier to use the
  * global partition
@@ -0,0 +1,1102 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Symbolic/numeric products of ParCSR matrices with fixed sparsity patterns.
+ *
+ * The symbolic phase computes a product (pattern and values) with the usual
+ * routines and records in a plan what only depends on the patterns: the
+ * pattern of the rows exchanged with the other processes, an entry-wise
+ * communication package for their values, and the column codes of all
+ * entries.  The numeric phase recomputes the values of C in place for new
+ * values of A and B: no hashing or merging of rows and no communication of
+ * the patterns.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanTransposePattern
+ *
+ * Pattern of the transpose of the num_rows x num_cols pattern (A_i, A_j)
+ * and, for each of its entries, the position of the entry in A.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPlanTransposePattern( HYPRE_Int   num_rows,
+                                        HYPRE_Int   num_cols,
+                                        HYPRE_Int  *A_i,
+                                        HYPRE_Int  *A_j,
+                                        HYPRE_Int **AT_i_ptr,
+                                        HYPRE_Int **AT_j_ptr,
+                                        HYPRE_Int **AT_pos_ptr )
+{
+   HYPRE_Int  nnz    = A_i[num_rows];
+   HYPRE_Int *AT_i   = hypre_CTAlloc(HYPRE_Int, num_cols + 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int *AT_j   = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Int *AT_pos = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i, j, k;
+
+   for (j = 0; j < nnz; j++)
+   {
+      AT_i[A_j[j]+1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i+1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = A_i[i]; j < A_i[i+1]; j++)
+      {
+         k = AT_i[A_j[j]]++;
+         AT_j[k]   = i;
+         AT_pos[k] = j;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i-1];
+   }
+   AT_i[0] = 0;
+
+   *AT_i_ptr   = AT_i;
+   *AT_j_ptr   = AT_j;
+   *AT_pos_ptr = AT_pos;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCode
+ *
+ * Code of the global column J of C (diag columns, then offd columns), or
+ * missing if C has no such column.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_ParCSRMatMatPlanCode( HYPRE_BigInt  J,
+                            HYPRE_BigInt  first_col,
+                            HYPRE_Int     num_cols_diag,
+                            HYPRE_BigInt *col_map_offd,
+                            HYPRE_Int     num_cols_offd,
+                            HYPRE_Int     missing )
+{
+   HYPRE_Int k;
+
+   if (J >= first_col && J < first_col + (HYPRE_BigInt) num_cols_diag)
+   {
+      return (HYPRE_Int) (J - first_col);
+   }
+
+   k = hypre_BigBinarySearch(col_map_offd, J, num_cols_offd);
+
+   return k < 0 ? missing : num_cols_diag + k;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCommPkgCreate
+ *
+ * Entry-wise communication package: the processes of comm_pkg (reversed if
+ * reverse is set), with the send and receive starts given by the row
+ * pointers send_i and recv_i of the rows exchanged.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg *
+hypre_ParCSRMatMatPlanCommPkgCreate( hypre_ParCSRCommPkg *comm_pkg,
+                                     HYPRE_Int            reverse,
+                                     HYPRE_Int           *send_i,
+                                     HYPRE_Int           *recv_i )
+{
+   HYPRE_Int            num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int           *send_procs = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int           *recv_procs = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int           *send_starts;
+   HYPRE_Int           *recv_starts;
+   hypre_ParCSRCommPkg *comm_pkg_j;
+   HYPRE_Int            p;
+
+   if (reverse)
+   {
+      num_sends   = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      num_recvs   = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      send_procs  = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      recv_procs  = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      send_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      recv_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+   else
+   {
+      send_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      recv_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+
+   comm_pkg_j = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(comm_pkg_j)     = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRCommPkgNumSends(comm_pkg_j) = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg_j) = num_recvs;
+   if (num_sends)
+   {
+      hypre_ParCSRCommPkgSendProcs(comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg_j), send_procs, HYPRE_Int, num_sends,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   if (num_recvs)
+   {
+      hypre_ParCSRCommPkgRecvProcs(comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg_j), recv_procs, HYPRE_Int, num_recvs,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   for (p = 0; p <= num_sends; p++)
+   {
+      hypre_ParCSRCommPkgSendMapStart(comm_pkg_j, p) = send_i[send_starts[p]];
+   }
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (p = 0; p <= num_recvs; p++)
+   {
+      hypre_ParCSRCommPkgRecvVecStart(comm_pkg_j, p) = recv_i[recv_starts[p]];
+   }
+
+   return comm_pkg_j;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanSetupExternalRows
+ *
+ * C = A B: pattern of the rows of B that correspond to the offd columns of
+ * A, with their columns coded in C, and the package exchanging their values.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPlanSetupExternalRows( hypre_ParCSRMatMatPlan *plan,
+                                         hypre_ParCSRMatrix     *A,
+                                         hypre_ParCSRMatrix     *B,
+                                         hypre_ParCSRMatrix     *C )
+{
+   hypre_ParCSRCommPkg     *comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int                num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   HYPRE_Int                num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   HYPRE_Int                num_rows_send   = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends);
+   HYPRE_Int                num_rows_recv   = hypre_ParCSRCommPkgRecvVecStart(comm_pkg_A, num_recvs);
+
+   hypre_CSRMatrix         *B_diag          = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int               *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int               *B_diag_j        = hypre_CSRMatrixJ(B_diag);
+   hypre_CSRMatrix         *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int               *B_offd_j        = hypre_CSRMatrixJ(B_offd);
+   HYPRE_BigInt            *col_map_offd_B  = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt             first_col_B     = hypre_ParCSRMatrixFirstColDiag(B);
+
+   HYPRE_BigInt             first_col_C     = hypre_ParCSRMatrixFirstColDiag(C);
+   HYPRE_BigInt            *col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_Int                num_cols_diag_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(C));
+   HYPRE_Int                num_cols_offd_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Int               *send_i, *recv_i, *row_length;
+   HYPRE_BigInt            *send_j, *recv_j;
+   HYPRE_Int                i, j, k, r;
+
+   /* row lengths */
+   send_i     = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+   recv_i     = hypre_CTAlloc(HYPRE_Int, num_rows_recv + 1, HYPRE_MEMORY_HOST);
+   row_length = hypre_TAlloc(HYPRE_Int, num_rows_send, HYPRE_MEMORY_HOST);
+   plan -> send_rows = hypre_TAlloc(HYPRE_Int, num_rows_send, HYPRE_MEMORY_HOST);
+   send_i[0] = 0;
+   for (i = 0; i < num_rows_send; i++)
+   {
+      r = hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, i);
+      plan -> send_rows[i] = r;
+      row_length[i] = B_diag_i[r+1] - B_diag_i[r] + B_offd_i[r+1] - B_offd_i[r];
+      send_i[i+1] = send_i[i] + row_length[i];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg_A, row_length, recv_i + 1);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   for (i = 0; i < num_rows_recv; i++)
+   {
+      recv_i[i+1] += recv_i[i];
+   }
+
+   plan -> comm_pkg = hypre_ParCSRMatMatPlanCommPkgCreate(comm_pkg_A, 0, send_i, recv_i);
+
+   /* column indices */
+   send_j = hypre_TAlloc(HYPRE_BigInt, send_i[num_rows_send], HYPRE_MEMORY_HOST);
+   recv_j = hypre_TAlloc(HYPRE_BigInt, recv_i[num_rows_recv], HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows_send; i++)
+   {
+      r = plan -> send_rows[i];
+      k = send_i[i];
+      for (j = B_diag_i[r]; j < B_diag_i[r+1]; j++)
+      {
+         send_j[k++] = first_col_B + (HYPRE_BigInt) B_diag_j[j];
+      }
+      for (j = B_offd_i[r]; j < B_offd_i[r+1]; j++)
+      {
+         send_j[k++] = col_map_offd_B[B_offd_j[j]];
+      }
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, plan -> comm_pkg, send_j, recv_j);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   plan -> recv_code = hypre_TAlloc(HYPRE_Int, recv_i[num_rows_recv], HYPRE_MEMORY_HOST);
+   for (j = 0; j < recv_i[num_rows_recv]; j++)
+   {
+      plan -> recv_code[j] = hypre_ParCSRMatMatPlanCode(recv_j[j], first_col_C, num_cols_diag_C,
+                                                        col_map_offd_C, num_cols_offd_C,
+                                                        plan -> num_codes);
+   }
+
+   plan -> num_send_rows = num_rows_send;
+   plan -> send_i        = send_i;
+   plan -> recv_i        = recv_i;
+   plan -> send_data     = hypre_TAlloc(HYPRE_Complex, send_i[num_rows_send], HYPRE_MEMORY_HOST);
+   plan -> recv_data     = hypre_TAlloc(HYPRE_Complex, recv_i[num_rows_recv], HYPRE_MEMORY_HOST);
+
+   hypre_TFree(row_length, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_j, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanSetupContributions
+ *
+ * C = A^T B: pattern of the rows of A_offd^T B (contributions to rows of C
+ * owned by other processes, with the columns of B coded locally), the
+ * package sending them to their owners, and the positions in C of the
+ * contributions received: p >= 0 in C_diag, -p-2 in C_offd, -1 if C has no
+ * such entry.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPlanSetupContributions( hypre_ParCSRMatMatPlan *plan,
+                                          hypre_ParCSRMatrix     *A,
+                                          hypre_ParCSRMatrix     *B,
+                                          hypre_ParCSRMatrix     *C )
+{
+   hypre_ParCSRCommPkg     *comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int                num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   HYPRE_Int                num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   HYPRE_Int                num_rows_recv   = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends);
+   HYPRE_Int                num_rows_send   = hypre_ParCSRCommPkgRecvVecStart(comm_pkg_A, num_recvs);
+
+   hypre_CSRMatrix         *B_diag          = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int               *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int               *B_diag_j        = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int                num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   hypre_CSRMatrix         *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int               *B_offd_j        = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int                num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt            *col_map_offd_B  = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt             first_col_B     = hypre_ParCSRMatrixFirstColDiag(B);
+
+   hypre_CSRMatrix         *C_diag          = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int               *C_diag_i        = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int               *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Int                num_cols_diag_C = hypre_CSRMatrixNumCols(C_diag);
+   hypre_CSRMatrix         *C_offd          = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int               *C_offd_i        = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int               *C_offd_j        = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Int                num_cols_offd_C = hypre_CSRMatrixNumCols(C_offd);
+   HYPRE_BigInt            *col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_BigInt             first_col_C     = hypre_ParCSRMatrixFirstColDiag(C);
+
+   HYPRE_Int               *AT_offd_i       = plan -> AT_offd_i;
+   HYPRE_Int               *AT_offd_j       = plan -> AT_offd_j;
+
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Int               *send_i, *send_code, *recv_i, *recv_code, *row_length, *marker;
+   HYPRE_BigInt            *send_j, *recv_j;
+   HYPRE_Int                num_codes_B     = num_cols_diag_B + num_cols_offd_B;
+   HYPRE_Int                i, j, k, l, r, code, cnt, row;
+   HYPRE_BigInt             J;
+
+   /* pattern of A_offd^T B, two passes */
+   send_i = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+   marker = hypre_TAlloc(HYPRE_Int, num_codes_B, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_codes_B; j++)
+   {
+      marker[j] = -1;
+   }
+   send_i[0] = 0;
+   for (i = 0; i < num_rows_send; i++)
+   {
+      cnt = 0;
+      for (k = AT_offd_i[i]; k < AT_offd_i[i+1]; k++)
+      {
+         r = AT_offd_j[k];
+         for (l = B_diag_i[r]; l < B_diag_i[r+1]; l++)
+         {
+            if (marker[B_diag_j[l]] != i)
+            {
+               marker[B_diag_j[l]] = i;
+               cnt++;
+            }
+         }
+         for (l = B_offd_i[r]; l < B_offd_i[r+1]; l++)
+         {
+            code = num_cols_diag_B + B_offd_j[l];
+            if (marker[code] != i)
+            {
+               marker[code] = i;
+               cnt++;
+            }
+         }
+      }
+      send_i[i+1] = send_i[i] + cnt;
+   }
+
+   send_code = hypre_TAlloc(HYPRE_Int, send_i[num_rows_send], HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_codes_B; j++)
+   {
+      marker[j] = -1;
+   }
+   cnt = 0;
+   for (i = 0; i < num_rows_send; i++)
+   {
+      for (k = AT_offd_i[i]; k < AT_offd_i[i+1]; k++)
+      {
+         r = AT_offd_j[k];
+         for (l = B_diag_i[r]; l < B_diag_i[r+1]; l++)
+         {
+            if (marker[B_diag_j[l]] != i)
+            {
+               marker[B_diag_j[l]] = i;
+               send_code[cnt++] = B_diag_j[l];
+            }
+         }
+         for (l = B_offd_i[r]; l < B_offd_i[r+1]; l++)
+         {
+            code = num_cols_diag_B + B_offd_j[l];
+            if (marker[code] != i)
+            {
+               marker[code] = i;
+               send_code[cnt++] = code;
+            }
+         }
+      }
+   }
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   /* row lengths, sent to the owners (as in the transpose matvec) */
+   row_length = hypre_TAlloc(HYPRE_Int, num_rows_send, HYPRE_MEMORY_HOST);
+   recv_i     = hypre_CTAlloc(HYPRE_Int, num_rows_recv + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows_send; i++)
+   {
+      row_length[i] = send_i[i+1] - send_i[i];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg_A, row_length, recv_i + 1);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   for (i = 0; i < num_rows_recv; i++)
+   {
+      recv_i[i+1] += recv_i[i];
+   }
+
+   plan -> comm_pkg = hypre_ParCSRMatMatPlanCommPkgCreate(comm_pkg_A, 1, send_i, recv_i);
+
+   /* global column indices */
+   send_j = hypre_TAlloc(HYPRE_BigInt, send_i[num_rows_send], HYPRE_MEMORY_HOST);
+   recv_j = hypre_TAlloc(HYPRE_BigInt, recv_i[num_rows_recv], HYPRE_MEMORY_HOST);
+   for (j = 0; j < send_i[num_rows_send]; j++)
+   {
+      code = send_code[j];
+      send_j[j] = code < num_cols_diag_B ? first_col_B + (HYPRE_BigInt) code :
+                                           col_map_offd_B[code - num_cols_diag_B];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, plan -> comm_pkg, send_j, recv_j);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* positions in C of the contributions received */
+   recv_code = hypre_TAlloc(HYPRE_Int, recv_i[num_rows_recv], HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows_recv; i++)
+   {
+      row = hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, i);
+      for (j = recv_i[i]; j < recv_i[i+1]; j++)
+      {
+         J = recv_j[j];
+         recv_code[j] = -1;
+         code = hypre_ParCSRMatMatPlanCode(J, first_col_C, num_cols_diag_C,
+                                           col_map_offd_C, num_cols_offd_C, -1);
+         if (code < 0)
+         {
+            continue;
+         }
+         if (code < num_cols_diag_C)
+         {
+            for (k = C_diag_i[row]; k < C_diag_i[row+1]; k++)
+            {
+               if (C_diag_j[k] == code)
+               {
+                  recv_code[j] = k;
+                  break;
+               }
+            }
+         }
+         else
+         {
+            for (k = C_offd_i[row]; k < C_offd_i[row+1]; k++)
+            {
+               if (C_offd_j[k] == code - num_cols_diag_C)
+               {
+                  recv_code[j] = -k - 2;
+                  break;
+               }
+            }
+         }
+      }
+   }
+
+   plan -> num_send_rows = num_rows_send;
+   plan -> send_i        = send_i;
+   plan -> send_code     = send_code;
+   plan -> recv_i        = recv_i;
+   plan -> recv_code     = recv_code;
+   plan -> send_data     = hypre_TAlloc(HYPRE_Complex, send_i[num_rows_send], HYPRE_MEMORY_HOST);
+   plan -> recv_data     = hypre_TAlloc(HYPRE_Complex, recv_i[num_rows_recv], HYPRE_MEMORY_HOST);
+
+   hypre_TFree(row_length, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_j, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCreate
+ *
+ * Plan of C = A B (or C = A^T B if transpose is set) for the given sparsity
+ * pattern of C, which must be that of the product or contain it: products
+ * of entries of A and B that have no entry in C are dropped.  The plan holds
+ * copies of everything it needs; A, B and C must keep their patterns and
+ * partitionings.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatMatPlan *
+hypre_ParCSRMatMatPlanCreate( hypre_ParCSRMatrix *A,
+                              hypre_ParCSRMatrix *B,
+                              hypre_ParCSRMatrix *C,
+                              HYPRE_Int           transpose )
+{
+   MPI_Comm                 comm            = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix         *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix         *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int                num_cols_offd_B = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(B));
+   HYPRE_BigInt            *col_map_offd_B  = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_Int                num_cols_diag_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(C));
+   HYPRE_Int                num_cols_offd_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+   HYPRE_BigInt            *col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_BigInt             first_col_C     = hypre_ParCSRMatrixFirstColDiag(C);
+
+   hypre_ParCSRMatMatPlan  *plan;
+   HYPRE_Int                num_procs, j;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRMatMatPlan, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatMatPlanTranspose(plan)   = transpose;
+   hypre_ParCSRMatMatPlanNumColsDiag(plan) = num_cols_diag_C;
+   hypre_ParCSRMatMatPlanNumCodes(plan)    = num_cols_diag_C + num_cols_offd_C;
+
+   /* offd columns of B in C; columns C does not have get the code
+      num_codes, which never has a position in a row of C */
+   plan -> B_offd_code = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_cols_offd_B; j++)
+   {
+      plan -> B_offd_code[j] = hypre_ParCSRMatMatPlanCode(col_map_offd_B[j], first_col_C,
+                                                          num_cols_diag_C, col_map_offd_C,
+                                                          num_cols_offd_C, plan -> num_codes);
+   }
+
+   if (transpose)
+   {
+      hypre_ParCSRMatMatPlanTransposePattern(hypre_CSRMatrixNumRows(A_diag),
+                                             hypre_CSRMatrixNumCols(A_diag),
+                                             hypre_CSRMatrixI(A_diag), hypre_CSRMatrixJ(A_diag),
+                                             &plan -> AT_diag_i, &plan -> AT_diag_j,
+                                             &plan -> AT_diag_pos);
+   }
+
+   if (num_procs > 1)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+
+      if (transpose)
+      {
+         hypre_ParCSRMatMatPlanTransposePattern(hypre_CSRMatrixNumRows(A_offd),
+                                                hypre_CSRMatrixNumCols(A_offd),
+                                                hypre_CSRMatrixI(A_offd), hypre_CSRMatrixJ(A_offd),
+                                                &plan -> AT_offd_i, &plan -> AT_offd_j,
+                                                &plan -> AT_offd_pos);
+         hypre_ParCSRMatMatPlanSetupContributions(plan, A, B, C);
+      }
+      else
+      {
+         hypre_ParCSRMatMatPlanSetupExternalRows(plan, A, B, C);
+      }
+   }
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanDestroy( hypre_ParCSRMatMatPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRMatMatPlanDestroy(plan -> inner);
+      hypre_ParCSRMatrixDestroy(plan -> inner_matrix);
+
+      if (plan -> comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> comm_pkg);
+      }
+      hypre_TFree(plan -> B_offd_code, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> AT_diag_i,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> AT_diag_j,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> AT_diag_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> AT_offd_i,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> AT_offd_j,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> AT_offd_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_rows,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_i,      HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_code,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> send_data,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_i,      HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_code,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> recv_data,   HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatSymbolic, hypre_ParCSRTMatMatSymbolic
+ *
+ * C = A B and C = A^T B (computed by hypre_ParCSRMatMatHost and
+ * hypre_ParCSRTMatMatKTHost) and the plan to recompute their values.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatMatSymbolic( hypre_ParCSRMatrix      *A,
+                            hypre_ParCSRMatrix      *B,
+                            hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   hypre_ParCSRMatrix *C = hypre_ParCSRMatMatHost(A, B);
+
+   *plan_ptr = C ? hypre_ParCSRMatMatPlanCreate(A, B, C, 0) : NULL;
+
+   return C;
+}
+
+hypre_ParCSRMatrix *
+hypre_ParCSRTMatMatSymbolic( hypre_ParCSRMatrix      *A,
+                             hypre_ParCSRMatrix      *B,
+                             hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   hypre_ParCSRMatrix *C = hypre_ParCSRTMatMatKTHost(A, B, 0);
+
+   *plan_ptr = C ? hypre_ParCSRMatMatPlanCreate(A, B, C, 1) : NULL;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumericAB
+ *
+ * Values of C = A B.  The rows of C are accumulated through pos, which
+ * holds the position in row i of C of each column code (-1 if none): first
+ * the local part A_diag B, overlapped with the exchange of the external
+ * rows of B, then A_offd B_ext.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatMatNumericAB( hypre_ParCSRMatMatPlan *plan,
+                             hypre_ParCSRMatrix     *A,
+                             hypre_ParCSRMatrix     *B,
+                             hypre_ParCSRMatrix     *C )
+{
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex           *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix         *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int               *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex           *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int                num_rows      = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix         *B_diag        = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int               *B_diag_i      = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int               *B_diag_j      = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex           *B_diag_data   = hypre_CSRMatrixData(B_diag);
+   hypre_CSRMatrix         *B_offd        = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               *B_offd_i      = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int               *B_offd_j      = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex           *B_offd_data   = hypre_CSRMatrixData(B_offd);
+
+   hypre_CSRMatrix         *C_diag        = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int               *C_diag_i      = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int               *C_diag_j      = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex           *C_diag_data   = hypre_CSRMatrixData(C_diag);
+   hypre_CSRMatrix         *C_offd        = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int               *C_offd_i      = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int               *C_offd_j      = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex           *C_offd_data   = hypre_CSRMatrixData(C_offd);
+
+   HYPRE_Int                num_codes     = plan -> num_codes;
+   HYPRE_Int                num_cols_diag = plan -> num_cols_diag;
+   HYPRE_Int               *B_offd_code   = plan -> B_offd_code;
+   HYPRE_Int               *send_rows     = plan -> send_rows;
+   HYPRE_Int               *send_i        = plan -> send_i;
+   HYPRE_Complex           *send_data     = plan -> send_data;
+   HYPRE_Int               *recv_i        = plan -> recv_i;
+   HYPRE_Int               *recv_code     = plan -> recv_code;
+   HYPRE_Complex           *recv_data     = plan -> recv_data;
+
+   hypre_ParCSRCommHandle  *comm_handle   = NULL;
+   HYPRE_Int                i;
+
+   /* values of the external rows of B */
+   if (plan -> comm_pkg)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < plan -> num_send_rows; i++)
+      {
+         HYPRE_Int r = send_rows[i];
+         HYPRE_Int k = send_i[i];
+         HYPRE_Int j;
+
+         for (j = B_diag_i[r]; j < B_diag_i[r+1]; j++)
+         {
+            send_data[k++] = B_diag_data[j];
+         }
+         for (j = B_offd_i[r]; j < B_offd_i[r+1]; j++)
+         {
+            send_data[k++] = B_offd_data[j];
+         }
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> comm_pkg, send_data, recv_data);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int     *pos = hypre_TAlloc(HYPRE_Int, num_codes + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Int      j, k, l, p;
+      HYPRE_Complex  a;
+
+      for (j = 0; j <= num_codes; j++)
+      {
+         pos[j] = -1;
+      }
+
+      /* C = A_diag B */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = C_diag_i[i]; j < C_diag_i[i+1]; j++)
+         {
+            pos[C_diag_j[j]] = j;
+            C_diag_data[j] = 0.0;
+         }
+         for (j = C_offd_i[i]; j < C_offd_i[i+1]; j++)
+         {
+            pos[num_cols_diag + C_offd_j[j]] = j;
+            C_offd_data[j] = 0.0;
+         }
+
+         for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+         {
+            k = A_diag_j[j];
+            a = A_diag_data[j];
+            for (l = B_diag_i[k]; l < B_diag_i[k+1]; l++)
+            {
+               p = pos[B_diag_j[l]];
+               if (p >= 0)
+               {
+                  C_diag_data[p] += a * B_diag_data[l];
+               }
+            }
+            for (l = B_offd_i[k]; l < B_offd_i[k+1]; l++)
+            {
+               p = pos[B_offd_code[B_offd_j[l]]];
+               if (p >= 0)
+               {
+                  C_offd_data[p] += a * B_offd_data[l];
+               }
+            }
+         }
+
+         for (j = C_diag_i[i]; j < C_diag_i[i+1]; j++)
+         {
+            pos[C_diag_j[j]] = -1;
+         }
+         for (j = C_offd_i[i]; j < C_offd_i[i+1]; j++)
+         {
+            pos[num_cols_diag + C_offd_j[j]] = -1;
+         }
+      }
+
+      /* C += A_offd B_ext */
+      if (comm_handle)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp single
+#endif
+         {
+            hypre_ParCSRCommHandleDestroy(comm_handle);
+         }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            if (A_offd_i[i+1] == A_offd_i[i])
+            {
+               continue;
+            }
+
+            for (j = C_diag_i[i]; j < C_diag_i[i+1]; j++)
+            {
+               pos[C_diag_j[j]] = j;
+            }
+            for (j = C_offd_i[i]; j < C_offd_i[i+1]; j++)
+            {
+               pos[num_cols_diag + C_offd_j[j]] = j;
+            }
+
+            for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+            {
+               k = A_offd_j[j];
+               a = A_offd_data[j];
+               for (l = recv_i[k]; l < recv_i[k+1]; l++)
+               {
+                  p = pos[recv_code[l]];
+                  if (p < 0)
+                  {
+                     continue;
+                  }
+                  if (recv_code[l] < num_cols_diag)
+                  {
+                     C_diag_data[p] += a * recv_data[l];
+                  }
+                  else
+                  {
+                     C_offd_data[p] += a * recv_data[l];
+                  }
+               }
+            }
+
+            for (j = C_diag_i[i]; j < C_diag_i[i+1]; j++)
+            {
+               pos[C_diag_j[j]] = -1;
+            }
+            for (j = C_offd_i[i]; j < C_offd_i[i+1]; j++)
+            {
+               pos[num_cols_diag + C_offd_j[j]] = -1;
+            }
+         }
+      }
+
+      hypre_TFree(pos, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumericATB
+ *
+ * Values of C = A^T B: the contributions A_offd^T B to rows owned by other
+ * processes are computed and sent first, then the local rows A_diag^T B,
+ * then the contributions received are added.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatMatNumericATB( hypre_ParCSRMatMatPlan *plan,
+                              hypre_ParCSRMatrix     *A,
+                              hypre_ParCSRMatrix     *B,
+                              hypre_ParCSRMatrix     *C )
+{
+   HYPRE_Complex           *A_diag_data     = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Complex           *A_offd_data     = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A));
+
+   hypre_CSRMatrix         *B_diag          = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int               *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int               *B_diag_j        = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex           *B_diag_data     = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int                num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   hypre_CSRMatrix         *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int               *B_offd_j        = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex           *B_offd_data     = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int                num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+
+   hypre_CSRMatrix         *C_diag          = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int               *C_diag_i        = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int               *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex           *C_diag_data     = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int                num_rows        = hypre_CSRMatrixNumRows(C_diag);
+   hypre_CSRMatrix         *C_offd          = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int               *C_offd_i        = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int               *C_offd_j        = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex           *C_offd_data     = hypre_CSRMatrixData(C_offd);
+
+   HYPRE_Int                num_codes       = plan -> num_codes;
+   HYPRE_Int                num_cols_diag   = plan -> num_cols_diag;
+   HYPRE_Int               *B_offd_code     = plan -> B_offd_code;
+   HYPRE_Int               *AT_diag_i       = plan -> AT_diag_i;
+   HYPRE_Int               *AT_diag_j       = plan -> AT_diag_j;
+   HYPRE_Int               *AT_diag_pos     = plan -> AT_diag_pos;
+   HYPRE_Int               *AT_offd_i       = plan -> AT_offd_i;
+   HYPRE_Int               *AT_offd_j       = plan -> AT_offd_j;
+   HYPRE_Int               *AT_offd_pos     = plan -> AT_offd_pos;
+   HYPRE_Int               *send_i          = plan -> send_i;
+   HYPRE_Int               *send_code       = plan -> send_code;
+   HYPRE_Complex           *send_data       = plan -> send_data;
+   HYPRE_Int               *recv_code       = plan -> recv_code;
+   HYPRE_Complex           *recv_data       = plan -> recv_data;
+
+   hypre_ParCSRCommHandle  *comm_handle     = NULL;
+   HYPRE_Int                num_recv, i, p;
+
+   /* contributions to rows of C owned by other processes */
+   if (plan -> comm_pkg)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+      {
+         HYPRE_Int     *pos = hypre_TAlloc(HYPRE_Int, num_cols_diag_B + num_cols_offd_B,
+                                           HYPRE_MEMORY_HOST);
+         HYPRE_Int      j, k, l, r;
+         HYPRE_Complex  a;
+
+         for (j = 0; j < num_cols_diag_B + num_cols_offd_B; j++)
+         {
+            pos[j] = -1;
+         }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < plan -> num_send_rows; i++)
+         {
+            for (j = send_i[i]; j < send_i[i+1]; j++)
+            {
+               pos[send_code[j]] = j;
+               send_data[j] = 0.0;
+            }
+            for (k = AT_offd_i[i]; k < AT_offd_i[i+1]; k++)
+            {
+               r = AT_offd_j[k];
+               a = A_offd_data[AT_offd_pos[k]];
+               for (l = B_diag_i[r]; l < B_diag_i[r+1]; l++)
+               {
+                  send_data[pos[B_diag_j[l]]] += a * B_diag_data[l];
+               }
+               for (l = B_offd_i[r]; l < B_offd_i[r+1]; l++)
+               {
+                  send_data[pos[num_cols_diag_B + B_offd_j[l]]] += a * B_offd_data[l];
+               }
+            }
+            for (j = send_i[i]; j < send_i[i+1]; j++)
+            {
+               pos[send_code[j]] = -1;
+            }
+         }
+
+         hypre_TFree(pos, HYPRE_MEMORY_HOST);
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> comm_pkg, send_data, recv_data);
+   }
+
+   /* local rows: C = A_diag^T B */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int     *pos = hypre_TAlloc(HYPRE_Int, num_codes + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Int      j, k, l, r, q;
+      HYPRE_Complex  a;
+
+      for (j = 0; j <= num_codes; j++)
+      {
+         pos[j] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = C_diag_i[i]; j < C_diag_i[i+1]; j++)
+         {
+            pos[C_diag_j[j]] = j;
+            C_diag_data[j] = 0.0;
+         }
+         for (j = C_offd_i[i]; j < C_offd_i[i+1]; j++)
+         {
+            pos[num_cols_diag + C_offd_j[j]] = j;
+            C_offd_data[j] = 0.0;
+         }
+
+         for (k = AT_diag_i[i]; k < AT_diag_i[i+1]; k++)
+         {
+            r = AT_diag_j[k];
+            a = A_diag_data[AT_diag_pos[k]];
+            for (l = B_diag_i[r]; l < B_diag_i[r+1]; l++)
+            {
+               q = pos[B_diag_j[l]];
+               if (q >= 0)
+               {
+                  C_diag_data[q] += a * B_diag_data[l];
+               }
+            }
+            for (l = B_offd_i[r]; l < B_offd_i[r+1]; l++)
+            {
+               q = pos[B_offd_code[B_offd_j[l]]];
+               if (q >= 0)
+               {
+                  C_offd_data[q] += a * B_offd_data[l];
+               }
+            }
+         }
+
+         for (j = C_diag_i[i]; j < C_diag_i[i+1]; j++)
+         {
+            pos[C_diag_j[j]] = -1;
+         }
+         for (j = C_offd_i[i]; j < C_offd_i[i+1]; j++)
+         {
+            pos[num_cols_diag + C_offd_j[j]] = -1;
+         }
+      }
+
+      hypre_TFree(pos, HYPRE_MEMORY_HOST);
+   }
+
+   /* contributions received */
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      num_recv = hypre_ParCSRCommPkgRecvVecStart(plan -> comm_pkg,
+                                                 hypre_ParCSRCommPkgNumRecvs(plan -> comm_pkg));
+      for (i = 0; i < num_recv; i++)
+      {
+         p = recv_code[i];
+         if (p >= 0)
+         {
+            C_diag_data[p] += recv_data[i];
+         }
+         else if (p < -1)
+         {
+            C_offd_data[-p-2] += recv_data[i];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumeric
+ *
+ * Recomputes the values of C = A B (or A^T B) of the plan for the current
+ * values of A and B.  The patterns must be those the plan was created for.
+ * Host memory only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatNumeric( hypre_ParCSRMatMatPlan *plan,
+                           hypre_ParCSRMatrix     *A,
+                           hypre_ParCSRMatrix     *B,
+                           hypre_ParCSRMatrix     *C )
+{
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParCSRMatMatPlanTranspose(plan))
+   {
+      return hypre_ParCSRMatMatNumericATB(plan, A, B, C);
+   }
+
+   return hypre_ParCSRMatMatNumericAB(plan, A, B, C);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPPlanCreate
+ *
+ * Plan of the triple product RAP = R^T A P for the given pattern of RAP:
+ * the product A P is computed (symbolic phase of A P) and kept in the plan.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatMatPlan *
+hypre_ParCSRMatrixRAPPlanCreate( hypre_ParCSRMatrix *R,
+                                 hypre_ParCSRMatrix *A,
+                                 hypre_ParCSRMatrix *P,
+                                 hypre_ParCSRMatrix *RAP )
+{
+   hypre_ParCSRMatMatPlan *inner, *plan;
+   hypre_ParCSRMatrix     *AP;
+
+   AP = hypre_ParCSRMatMatSymbolic(A, P, &inner);
+   if (!AP)
+   {
+      return NULL;
+   }
+
+   plan = hypre_ParCSRMatMatPlanCreate(R, AP, RAP, 1);
+   hypre_ParCSRMatMatPlanInner(plan)       = inner;
+   hypre_ParCSRMatMatPlanInnerMatrix(plan) = AP;
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPNumeric
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPNumeric( hypre_ParCSRMatMatPlan *plan,
+                              hypre_ParCSRMatrix     *R,
+                              hypre_ParCSRMatrix     *A,
+                              hypre_ParCSRMatrix     *P,
+                              hypre_ParCSRMatrix     *RAP )
+{
+   if (!plan || !hypre_ParCSRMatMatPlanInner(plan))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatMatNumeric(hypre_ParCSRMatMatPlanInner(plan), A, P,
+                             hypre_ParCSRMatMatPlanInnerMatrix(plan));
+   hypre_ParCSRMatMatNumeric(plan, R, hypre_ParCSRMatMatPlanInnerMatrix(plan), RAP);
+
+   return hypre_error_flag;
+}
@@ -242,6 +242,75 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMemorySize
+ *
+ * Bytes held by the matrix on this process (see HYPRE_ParCSRMatrixGetMemorySize).
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParCSRMatrixMemorySize( hypre_ParCSRMatrix *matrix )
+{
+   size_t    size;
+   HYPRE_Int num_starts;
+
+   if (!matrix)
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_starts = 2;
+#else
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(matrix), &num_starts);
+   num_starts++;
+#endif
+
+   size = sizeof(hypre_ParCSRMatrix);
+
+   if ( hypre_ParCSRMatrixOwnsData(matrix) )
+   {
+      HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(matrix));
+
+      size += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixDiag(matrix));
+      size += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixOffd(matrix));
+      size += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixDiagT(matrix));
+      size += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixOffdT(matrix));
+      if (hypre_ParCSRMatrixColMapOffd(matrix))
+      {
+         size += sizeof(HYPRE_BigInt) * num_cols_offd;
+      }
+      if (hypre_ParCSRMatrixDeviceColMapOffd(matrix))
+      {
+         size += sizeof(HYPRE_BigInt) * num_cols_offd;
+      }
+      size += hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatrixCommPkg(matrix));
+      size += hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatrixCommPkgT(matrix));
+   }
+
+   if ( hypre_ParCSRMatrixOwnsRowStarts(matrix) )
+   {
+      size += sizeof(HYPRE_BigInt) * num_starts;
+   }
+   if ( hypre_ParCSRMatrixOwnsColStarts(matrix) )
+   {
+      size += sizeof(HYPRE_BigInt) * num_starts;
+   }
+   if ( hypre_ParCSRMatrixProcOrdering(matrix) )
+   {
+      size += sizeof(HYPRE_Int) * hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matrix));
+   }
+   if (matrix -> bdiaginv)
+   {
+      /* blocks are aligned globally: at most one more than the local rows */
+      size += sizeof(HYPRE_Complex) * (size_t) (matrix -> bdiag_size) *
+              (hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matrix)) + matrix -> bdiag_size);
+   }
+   size += hypre_ParCSRCommPkgMemorySize(matrix -> bdiaginv_comm_pkg);
+
+   return size;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixInitialize
  *--------------------------------------------------------------------------*/
@@ -470,6 +539,72 @@ hypre_ParCSRMatrixSetColStartsOwner( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetSELL
+ *
+ * Builds SELL-C-sigma copies of the diag and offd blocks (and of their
+ * transposes, if present), which are then used by the host matvecs.  See
+ * hypre_CSRMatrixSetSELL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetSELL( hypre_ParCSRMatrix *matrix,
+                           HYPRE_Int           chunk_size,
+                           HYPRE_Int           sigma )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetSELL(hypre_ParCSRMatrixDiag(matrix), chunk_size, sigma);
+   hypre_CSRMatrixSetSELL(hypre_ParCSRMatrixOffd(matrix), chunk_size, sigma);
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixSetSELL(hypre_ParCSRMatrixDiagT(matrix), chunk_size, sigma);
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixSetSELL(hypre_ParCSRMatrixOffdT(matrix), chunk_size, sigma);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetDataFloat
+ *
+ * Stores the values of the diag and offd blocks (and of their transposes,
+ * if present) in single precision.  See hypre_CSRMatrixSetDataFloat.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetDataFloat( hypre_ParCSRMatrix *matrix,
+                                HYPRE_Int           keep_data )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetDataFloat(hypre_ParCSRMatrixDiag(matrix), keep_data);
+   hypre_CSRMatrixSetDataFloat(hypre_ParCSRMatrixOffd(matrix), keep_data);
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixSetDataFloat(hypre_ParCSRMatrixDiagT(matrix), keep_data);
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixSetDataFloat(hypre_ParCSRMatrixOffdT(matrix), keep_data);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixRead
  *--------------------------------------------------------------------------*/
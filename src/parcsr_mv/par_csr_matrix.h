@@ -179,6 +179,66 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * Plan of a product C = A B or C = A^T B of Parallel CSR matrices:
+ * everything that only depends on the sparsity patterns of A, B and C, so
+ * that the values of C can be recomputed for new values of A and B.
+ *
+ * The columns of C are numbered in one local index space (codes): the diag
+ * columns, then the offd columns.  For C = A B the plan holds the pattern of
+ * the rows of B needed from other processes and the entry-wise package that
+ * exchanges their values.  For C = A^T B it holds the transposed pattern of
+ * A and the pattern of the contributions to rows of C owned by other
+ * processes, with the positions in C of the contributions received.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_ParCSRMatMatPlan_struct
+{
+   HYPRE_Int             transpose;      /* C = A^T B instead of C = A B */
+
+   HYPRE_Int             num_codes;      /* columns of C (diag and offd) */
+   HYPRE_Int             num_cols_diag;  /* diag columns of C */
+   HYPRE_Int            *B_offd_code;    /* codes of the offd columns of B */
+
+   /* transposed patterns of A_diag and A_offd and the positions of their
+      entries in A (C = A^T B) */
+   HYPRE_Int            *AT_diag_i;
+   HYPRE_Int            *AT_diag_j;
+   HYPRE_Int            *AT_diag_pos;
+   HYPRE_Int            *AT_offd_i;
+   HYPRE_Int            *AT_offd_j;
+   HYPRE_Int            *AT_offd_pos;
+
+   /* values exchanged with the other processes */
+   hypre_ParCSRCommPkg  *comm_pkg;       /* entry-wise package */
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;      /* C = A B: rows of B sent */
+   HYPRE_Int            *send_i;
+   HYPRE_Int            *send_code;      /* C = A^T B: local columns of B */
+   HYPRE_Complex        *send_data;
+   HYPRE_Int            *recv_i;         /* C = A B: external rows of B */
+   HYPRE_Int            *recv_code;      /* C = A B: codes of the entries,
+                                            C = A^T B: positions in C */
+   HYPRE_Complex        *recv_data;
+
+   /* triple product C = A^T (B D): plan of B D and the product B D */
+   struct hypre_ParCSRMatMatPlan_struct *inner;
+   hypre_ParCSRMatrix   *inner_matrix;
+
+} hypre_ParCSRMatMatPlan;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the product plan
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRMatMatPlanTranspose(plan)      ((plan) -> transpose)
+#define hypre_ParCSRMatMatPlanNumCodes(plan)       ((plan) -> num_codes)
+#define hypre_ParCSRMatMatPlanNumColsDiag(plan)    ((plan) -> num_cols_diag)
+#define hypre_ParCSRMatMatPlanBOffdCode(plan)      ((plan) -> B_offd_code)
+#define hypre_ParCSRMatMatPlanCommPkg(plan)        ((plan) -> comm_pkg)
+#define hypre_ParCSRMatMatPlanInner(plan)          ((plan) -> inner)
+#define hypre_ParCSRMatMatPlanInnerMatrix(plan)    ((plan) -> inner_matrix)
+
 #endif
 
 #endif
@@ -12,6 +12,492 @@
  *****************************************************************************/
 
 #include "_hypre_parcsr_mv.h"
+
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecMultiVector
+ *
+ * Host Matvec for multivectors, y = alpha*A*x + beta*b.  The halo values of
+ * all vectors are packed row-wise (interleaved) and exchanged with a single
+ * message per neighbor; the offd product then reads contiguous blocks of
+ * num_vectors values for each column.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecMultiVector( HYPRE_Complex       alpha,
+                                     hypre_ParCSRMatrix *A,
+                                     hypre_ParVector    *x,
+                                     HYPRE_Complex       beta,
+                                     hypre_ParVector    *b,
+                                     hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommPkg              *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector    *b_local = hypre_ParVectorLocalVector(b);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector    *x_tmp;
+
+   HYPRE_Int        num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int        vecstride     = hypre_VectorVectorStride(x_local);
+   HYPRE_Int        idxstride     = hypre_VectorIndexStride(x_local);
+   HYPRE_Complex   *x_local_data  = hypre_VectorData(x_local);
+   HYPRE_Complex   *x_buf_data, *x_elmt;
+   HYPRE_Int        use_persistent_comm = hypre_HandlePersistentComm(hypre_handle());
+   HYPRE_Int        num_sends, i, k;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   /* row-wise storage of the halo */
+   x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+
+   if (use_persistent_comm)
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandleMultiVector(1, comm_pkg, num_vectors);
+      x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      hypre_VectorData(x_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(x_tmp, 0);
+   }
+   else
+   {
+      x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors,
+                                HYPRE_MEMORY_HOST);
+   }
+   hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i,k,x_elmt) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      x_elmt = x_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      for (k = 0; k < num_vectors; k++)
+      {
+         x_buf_data[i*num_vectors + k] = x_elmt[k*vecstride];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   if (use_persistent_comm)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, x_buf_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreateMultiVector(1, comm_pkg, num_vectors, x_buf_data,
+                                                            hypre_VectorData(x_tmp));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   if (use_persistent_comm)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST,
+                                           hypre_VectorData(x_tmp));
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+   if (!use_persistent_comm)
+   {
+      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecTMultiVector
+ *
+ * Host MatvecT for multivectors, y = alpha*A^T*x + beta*y, with the same
+ * single-message, row-wise halo layout as hypre_ParCSRMatrixMatvecMultiVector.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecTMultiVector( HYPRE_Complex       alpha,
+                                      hypre_ParCSRMatrix *A,
+                                      hypre_ParVector    *x,
+                                      HYPRE_Complex       beta,
+                                      hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommPkg              *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag  = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd  = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *diagT = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix *offdT = hypre_ParCSRMatrixOffdT(A);
+
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector    *y_tmp;
+
+   HYPRE_Int        num_vectors   = hypre_VectorNumVectors(y_local);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int        vecstride     = hypre_VectorVectorStride(y_local);
+   HYPRE_Int        idxstride     = hypre_VectorIndexStride(y_local);
+   HYPRE_Complex   *y_local_data  = hypre_VectorData(y_local);
+   HYPRE_Complex   *y_buf_data, *y_elmt;
+   HYPRE_Int        use_persistent_comm = hypre_HandlePersistentComm(hypre_handle());
+   HYPRE_Int        num_sends, i, k;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   /* row-wise storage of the halo */
+   y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+
+   if (use_persistent_comm)
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandleMultiVector(2, comm_pkg, num_vectors);
+      hypre_VectorData(y_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(y_tmp, 0);
+      y_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors,
+                                HYPRE_MEMORY_HOST);
+   }
+   hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd)
+   {
+      if (offdT)
+      {
+         hypre_CSRMatrixMatvec(alpha, offdT, x_local, 0.0, y_tmp);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   if (use_persistent_comm)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST,
+                                            hypre_VectorData(y_tmp));
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreateMultiVector(2, comm_pkg, num_vectors,
+                                                            hypre_VectorData(y_tmp), y_buf_data);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   if (diagT)
+   {
+      hypre_CSRMatrixMatvec(alpha, diagT, x_local, beta, y_local);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   if (use_persistent_comm)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, y_buf_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   /* unpack: entries may repeat in send_map_elmts, so this is not threaded */
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      y_elmt = y_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+      for (k = 0; k < num_vectors; k++)
+      {
+         y_elmt[k*vecstride] += y_buf_data[i*num_vectors + k];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorDestroy(y_tmp);
+   if (!use_persistent_comm)
+   {
+      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/* completes the halo exchange of hypre_ParCSRMatrixMatvecOverlap */
+static inline void
+hypre_ParCSRMatrixMatvecOverlapWait( hypre_ParCSRCommHandle           *comm_handle,
+                                     hypre_ParCSRPersistentCommHandle *persistent_comm_handle,
+                                     HYPRE_Complex                    *x_tmp_data )
+{
+   if (persistent_comm_handle)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, x_tmp_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOverlap
+ *
+ * Host Matvec for a single vector, y = alpha*A*x + beta*b, that overlaps the
+ * halo exchange with the rows of A that have no offd entries.  With several
+ * OpenMP threads, the master thread completes the exchange while the other
+ * threads start on these interior rows, and joins them when it is done.  The
+ * boundary rows (the offd rownnz list, when set) are computed once the halo
+ * has arrived.  Used when HYPRE_SetMatvecOverlap is on.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecOverlap( HYPRE_Complex       alpha,
+                                 hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *x,
+                                 HYPRE_Complex       beta,
+                                 hypre_ParVector    *b,
+                                 hypre_ParVector    *y )
+{
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommPkg              *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   HYPRE_Int       *diag_i    = hypre_CSRMatrixI(diag);
+   HYPRE_Int       *diag_j    = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex   *diag_data = hypre_CSRMatrixData(diag);
+   HYPRE_Int       *offd_i    = hypre_CSRMatrixI(offd);
+   HYPRE_Int       *offd_j    = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex   *offd_data = hypre_CSRMatrixData(offd);
+   HYPRE_Int        num_rows  = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int       *offd_rownnz;
+   HYPRE_Int        num_boundary;
+
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Complex   *x_data = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex   *b_data = hypre_VectorData(hypre_ParVectorLocalVector(b));
+   HYPRE_Complex   *y_data = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Complex   *x_tmp_data, *x_buf_data, *shm_send_buffer = NULL;
+   HYPRE_Complex    tempx;
+   HYPRE_Int        num_threads = hypre_NumThreads();
+   HYPRE_Int        use_persistent_comm = hypre_HandlePersistentComm(hypre_handle());
+   HYPRE_Int        num_sends, i, ii, jj;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   /* boundary rows: use the offd rownnz list if it has been set */
+   offd_rownnz  = hypre_CSRMatrixRownnz(offd);
+   num_boundary = offd_rownnz ? hypre_CSRMatrixNumRownnz(offd) : num_rows;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   if (use_persistent_comm)
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+      x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      x_tmp_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      /* pack straight into the shared memory window, if any */
+      shm_send_buffer = hypre_ParCSRCommPkgShmSendBuffer(comm_pkg);
+      x_tmp_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+      x_buf_data = shm_send_buffer ? shm_send_buffer :
+                   hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   }
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      x_buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   if (use_persistent_comm)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, x_buf_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, x_buf_data, x_tmp_data);
+   }
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel private(i, ii, jj, tempx) if (num_threads > 1)
+#endif
+   {
+      if (num_threads > 1 && hypre_GetThreadNum() == 0)
+      {
+         hypre_ParCSRMatrixMatvecOverlapWait(comm_handle, persistent_comm_handle, x_tmp_data);
+      }
+
+      /* interior rows; dynamic scheduling lets the master thread pick up
+         the remaining chunks once the exchange has completed */
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if (offd_i[i+1] == offd_i[i])
+         {
+            tempx = 0.0;
+            for (jj = diag_i[i]; jj < diag_i[i+1]; jj++)
+            {
+               tempx += diag_data[jj] * x_data[diag_j[jj]];
+            }
+            y_data[i] = beta == 0.0 ? alpha*tempx : alpha*tempx + beta*b_data[i];
+         }
+      }
+
+      if (num_threads == 1)
+      {
+         hypre_ParCSRMatrixMatvecOverlapWait(comm_handle, persistent_comm_handle, x_tmp_data);
+      }
+
+      /* boundary rows, after the implicit barrier above */
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < num_boundary; ii++)
+      {
+         i = offd_rownnz ? offd_rownnz[ii] : ii;
+         if (offd_i[i+1] > offd_i[i])
+         {
+            tempx = 0.0;
+            for (jj = diag_i[i]; jj < diag_i[i+1]; jj++)
+            {
+               tempx += diag_data[jj] * x_data[diag_j[jj]];
+            }
+            for (jj = offd_i[i]; jj < offd_i[i+1]; jj++)
+            {
+               tempx += offd_data[jj] * x_tmp_data[offd_j[jj]];
+            }
+            y_data[i] = beta == 0.0 ? alpha*tempx : alpha*tempx + beta*b_data[i];
+         }
+      }
+   }
+
+   if (!use_persistent_comm)
+   {
+      hypre_TFree(x_tmp_data, HYPRE_MEMORY_HOST);
+      if (!shm_send_buffer)
+      {
+         hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   return hypre_error_flag;
+}
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOverlapped
+ *
+ * Returns 1 if the host single vector Matvecs with A (and x != y) overlap
+ * the halo exchange with the interior rows: HYPRE_SetMatvecOverlap is on
+ * and, since the overlapped kernel reads the double precision CSR arrays
+ * directly, the blocks of A have no single precision or SELL-C-sigma copy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecOverlapped( hypre_ParCSRMatrix *A )
+{
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   return ( hypre_HandleMatvecOverlap(hypre_handle()) &&
+            !hypre_CSRMatrixDataFloat(diag) && !hypre_CSRMatrixSell(diag) &&
+            !hypre_CSRMatrixDataFloat(offd) && !hypre_CSRMatrixSell(offd) );
+#else
+   return 0;
+#endif
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -49,7 +535,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Int vecstride = hypre_VectorVectorStride( x_local );
    HYPRE_Int idxstride = hypre_VectorIndexStride( x_local );
 
-   HYPRE_Complex *x_tmp_data, **x_buf_data;
+   HYPRE_Complex *x_tmp_data, **x_buf_data, *shm_send_buffer = NULL;
    HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -87,6 +573,20 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if ( num_vectors > 1 )
+   {
+      hypre_ParCSRMatrixMatvecMultiVector(alpha, A, x, beta, b, y);
+      return ierr;
+   }
+
+   if ( x != y && hypre_ParCSRMatrixMatvecOverlapped(A) )
+   {
+      hypre_ParCSRMatrixMatvecOverlap(alpha, A, x, beta, b, y);
+      return ierr;
+   }
+#endif
+
    if ( num_vectors == 1 )
    {
       x_tmp = hypre_SeqVectorCreate( num_cols_offd );
@@ -115,21 +615,13 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_Int use_persistent_comm = 0;
-
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+   /* multivectors on device keep one (non-persistent) exchange per vector */
+   HYPRE_Int use_persistent_comm = num_vectors == 1 && hypre_HandlePersistentComm(hypre_handle());
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-#endif
    }
    else
    {
@@ -152,10 +644,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(x_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(x_tmp, 0);
-#endif
    }
 #endif
 
@@ -187,11 +677,17 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          x_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
          continue;
-#endif
       }
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+      /* pack straight into the shared memory window, if any */
+      if (jv == 0 && (shm_send_buffer = hypre_ParCSRCommPkgShmSendBuffer(comm_pkg)))
+      {
+         x_buf_data[0] = shm_send_buffer;
+         continue;
+      }
+#endif
 
       x_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
                                     hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
@@ -262,9 +758,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication starts */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_buf_data[0]);
-#endif
    }
    else
    {
@@ -289,9 +783,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_tmp_data);
-#endif
    }
    else
    {
@@ -329,10 +821,14 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
             continue;
          }
 #endif
+         if (x_buf_data[jv] == shm_send_buffer)
+         {
+            continue;
+         }
          hypre_TFree(x_buf_data[jv], HYPRE_MEMORY_DEVICE);
       }
-      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleCudaComputeStreamSync(hypre_handle()) = sync_stream;
@@ -431,6 +927,14 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(x_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if ( num_vectors > 1 )
+   {
+      hypre_ParCSRMatrixMatvecTMultiVector(alpha, A, x, beta, y);
+      return ierr;
+   }
+#endif
+
    if ( num_vectors == 1 )
    {
       y_tmp = hypre_SeqVectorCreate(num_cols_offd);
@@ -459,21 +963,13 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_Int use_persistent_comm = 0;
-
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+   /* multivectors on device keep one (non-persistent) exchange per vector */
+   HYPRE_Int use_persistent_comm = num_vectors == 1 && hypre_HandlePersistentComm(hypre_handle());
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
-#endif
    }
    else
    {
@@ -496,10 +992,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(y_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(y_tmp, 0);
-#endif
    }
 #endif
 
@@ -531,10 +1025,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          y_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
          continue;
-#endif
       }
 
       y_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -565,9 +1057,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_tmp_data);
-#endif
    }
    else
    {
@@ -601,9 +1091,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_buf_data[0]);
-#endif
    }
    else
    {
@@ -693,8 +1181,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
          hypre_TFree(y_buf_data[jv], HYPRE_MEMORY_DEVICE);
       }
-      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleCudaComputeStreamSync(hypre_handle()) = sync_stream;
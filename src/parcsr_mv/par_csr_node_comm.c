@@ -0,0 +1,771 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Node-aware (two-level) halo exchange for hypre_ParCSRCommPkg
+ *
+ * The ranks of a node are those of a shared memory communicator.  The nodes
+ * are numbered in the order of their first ranks, and traffic between two
+ * nodes a and b goes through rank (b mod size(a)) of node a and rank
+ * (a mod size(b)) of node b, so that the messages of all ranks of a node to
+ * another node are aggregated into one.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#define HYPRE_NODE_COMM_TAG_LOCAL   0
+#define HYPRE_NODE_COMM_TAG_GATHER  1
+#define HYPRE_NODE_COMM_TAG_NODE    2
+#define HYPRE_NODE_COMM_TAG_SCATTER 3
+
+/*--------------------------------------------------------------------------
+ * Entries of the setup are 4 integers: three sort keys and a payload.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_NodeCommEntryLess( HYPRE_Int *a,
+                         HYPRE_Int *b )
+{
+   if (a[0] != b[0])
+   {
+      return (a[0] < b[0]);
+   }
+   if (a[1] != b[1])
+   {
+      return (a[1] < b[1]);
+   }
+   return (a[2] < b[2]);
+}
+
+static void
+hypre_NodeCommSwapEntries( HYPRE_Int *entries,
+                           HYPRE_Int  i,
+                           HYPRE_Int  j )
+{
+   HYPRE_Int k, temp;
+
+   for (k = 0; k < 4; k++)
+   {
+      temp = entries[4*i+k];
+      entries[4*i+k] = entries[4*j+k];
+      entries[4*j+k] = temp;
+   }
+}
+
+static void
+hypre_NodeCommSortEntries( HYPRE_Int *entries,
+                           HYPRE_Int  left,
+                           HYPRE_Int  right )
+{
+   HYPRE_Int i, last;
+
+   if (left >= right)
+   {
+      return;
+   }
+   hypre_NodeCommSwapEntries(entries, left, (left + right) / 2);
+   last = left;
+   for (i = left + 1; i <= right; i++)
+   {
+      if (hypre_NodeCommEntryLess(&entries[4*i], &entries[4*left]))
+      {
+         hypre_NodeCommSwapEntries(entries, ++last, i);
+      }
+   }
+   hypre_NodeCommSwapEntries(entries, left, last);
+   hypre_NodeCommSortEntries(entries, left, last - 1);
+   hypre_NodeCommSortEntries(entries, last + 1, right);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_NodeCommStageMessages
+ *
+ * Given n entries sorted by proc (first key), with payloads indexing len,
+ * returns one message per proc with the sum of the lengths of its entries.
+ * If map is not NULL, it gets the indices offset[k], ..., offset[k]+len[k]-1
+ * for the entries k in order.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_NodeCommStageMessages( HYPRE_Int   n,
+                             HYPRE_Int  *entries,
+                             HYPRE_Int  *len,
+                             HYPRE_Int  *offset,
+                             HYPRE_Int  *num_msgs_ptr,
+                             HYPRE_Int **procs_ptr,
+                             HYPRE_Int **starts_ptr,
+                             HYPRE_Int **map_ptr )
+{
+   HYPRE_Int  num_msgs = 0;
+   HYPRE_Int *procs, *starts, *map = NULL;
+   HYPRE_Int  i, k, m, size;
+
+   for (i = 0; i < n; i++)
+   {
+      if (i == 0 || entries[4*i] != entries[4*(i-1)])
+      {
+         num_msgs++;
+      }
+   }
+   procs  = hypre_TAlloc(HYPRE_Int, num_msgs, HYPRE_MEMORY_HOST);
+   starts = hypre_TAlloc(HYPRE_Int, num_msgs + 1, HYPRE_MEMORY_HOST);
+
+   num_msgs = 0;
+   size = 0;
+   for (i = 0; i < n; i++)
+   {
+      if (i == 0 || entries[4*i] != entries[4*(i-1)])
+      {
+         procs[num_msgs]  = entries[4*i];
+         starts[num_msgs] = size;
+         num_msgs++;
+      }
+      size += len[entries[4*i+3]];
+   }
+   starts[num_msgs] = size;
+
+   if (map_ptr)
+   {
+      map = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      m = 0;
+      for (i = 0; i < n; i++)
+      {
+         k = entries[4*i+3];
+         for (size = 0; size < len[k]; size++)
+         {
+            map[m++] = offset[k] + size;
+         }
+      }
+      *map_ptr = map;
+   }
+
+   *num_msgs_ptr = num_msgs;
+   *procs_ptr    = procs;
+   *starts_ptr   = starts;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNodeComm
+ *
+ * Creates the node-aware plan for the job 1 exchange of comm_pkg.  Besides
+ * the shared memory communicator and the node numbering (collective on the
+ * communicator of comm_pkg), the setup only needs communication within the
+ * nodes: each rank tells the ranks of its node that handle its off-node
+ * traffic which segments it sends and receives through them.  A handler
+ * orders the segments of a pair of nodes by (source, destination), which
+ * the handlers on both nodes can do without talking to each other.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNodeComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm                   comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                  num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                 *send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int                 *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                  num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int                 *recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int                 *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   hypre_ParCSRNodeCommPkg   *node_comm_pkg;
+   hypre_ParCSRNodeCommStage *stages;
+   MPI_Comm                   node_comm;
+   HYPRE_Int                  my_id, num_procs, local_id, local_size, leader;
+   HYPRE_Int                  info[2], *all_info;
+   HYPRE_Int                  num_nodes, my_node, *node_of, *node_starts, *node_ranks;
+   HYPRE_Int                 *send_len, *recv_len;
+   HYPRE_Int                 *gather_entries, *scatter_entries;
+   HYPRE_Int                  num_gather, num_scatter;
+   HYPRE_Int                 *out_counts, *in_counts, *out_starts, *in_starts;
+   HYPRE_Int                 *out_data, *in_data;
+   HYPRE_Int                  num_in, num_from, num_to;
+   HYPRE_Int                 *from_s, *from_p, *from_len, *from_pos;
+   HYPRE_Int                 *to_s, *to_p, *to_len, *to_pos;
+   HYPRE_Int                 *entries;
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  num_requests;
+   HYPRE_Int                  i, j, k, l, r, n, proc, node, size;
+
+   if (hypre_ParCSRCommPkgNodeCommPkg(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   if (num_procs == 1)
+   {
+      return hypre_error_flag;
+   }
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /*-----------------------------------------------------------------------
+    * Node numbering: all_info holds the first rank of the node and the rank
+    * within the node of each rank
+    *-----------------------------------------------------------------------*/
+
+   hypre_MPI_Comm_split_type(comm, hypre_MPI_COMM_TYPE_SHARED, my_id,
+                             hypre_MPI_INFO_NULL, &node_comm);
+   hypre_MPI_Comm_rank(node_comm, &local_id);
+   hypre_MPI_Comm_size(node_comm, &local_size);
+
+   leader = my_id;
+   hypre_MPI_Bcast(&leader, 1, HYPRE_MPI_INT, 0, node_comm);
+
+   info[0] = leader;
+   info[1] = local_id;
+   all_info = hypre_TAlloc(HYPRE_Int, 2*num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(info, 2, HYPRE_MPI_INT, all_info, 2, HYPRE_MPI_INT, comm);
+
+   /* the first rank of a node is the smallest one, so it comes first */
+   node_of     = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   node_starts = hypre_CTAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   num_nodes = 0;
+   for (r = 0; r < num_procs; r++)
+   {
+      node_of[r] = (all_info[2*r] == r) ? num_nodes++ : node_of[all_info[2*r]];
+      node_starts[node_of[r]+1]++;
+   }
+   for (n = 0; n < num_nodes; n++)
+   {
+      node_starts[n+1] += node_starts[n];
+   }
+   node_ranks = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (r = 0; r < num_procs; r++)
+   {
+      node_ranks[node_starts[node_of[r]] + all_info[2*r+1]] = r;
+   }
+   my_node = node_of[my_id];
+
+   /* rank of node a that handles the traffic with node b */
+#define hypre_NodeCommHandler(a, b) \
+   (node_ranks[node_starts[a] + (b) % (node_starts[(a)+1] - node_starts[a])])
+
+   node_comm_pkg = hypre_CTAlloc(hypre_ParCSRNodeCommPkg, 1, HYPRE_MEMORY_HOST);
+   stages = node_comm_pkg -> stages;
+
+   /*-----------------------------------------------------------------------
+    * Own sends and receives: on-node ones are direct, the others are
+    * gathered on (stage 1) or scattered from (stage 3) the handlers
+    *-----------------------------------------------------------------------*/
+
+   send_len = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   recv_len = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   node_comm_pkg -> local_sends = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   node_comm_pkg -> local_recvs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   gather_entries  = hypre_TAlloc(HYPRE_Int, 4*num_sends, HYPRE_MEMORY_HOST);
+   scatter_entries = hypre_TAlloc(HYPRE_Int, 4*num_recvs, HYPRE_MEMORY_HOST);
+
+   num_gather = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      proc = send_procs[i];
+      send_len[i] = send_map_starts[i+1] - send_map_starts[i];
+      if (node_of[proc] == my_node)
+      {
+         node_comm_pkg -> local_sends[node_comm_pkg -> num_local_sends++] = i;
+      }
+      else
+      {
+         gather_entries[4*num_gather]   = hypre_NodeCommHandler(my_node, node_of[proc]);
+         gather_entries[4*num_gather+1] = proc;
+         gather_entries[4*num_gather+2] = 0;
+         gather_entries[4*num_gather+3] = i;
+         num_gather++;
+      }
+   }
+   num_scatter = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      proc = recv_procs[i];
+      recv_len[i] = recv_vec_starts[i+1] - recv_vec_starts[i];
+      if (node_of[proc] == my_node)
+      {
+         node_comm_pkg -> local_recvs[node_comm_pkg -> num_local_recvs++] = i;
+      }
+      else
+      {
+         scatter_entries[4*num_scatter]   = hypre_NodeCommHandler(my_node, node_of[proc]);
+         scatter_entries[4*num_scatter+1] = proc;
+         scatter_entries[4*num_scatter+2] = 0;
+         scatter_entries[4*num_scatter+3] = i;
+         num_scatter++;
+      }
+   }
+   hypre_NodeCommSortEntries(gather_entries, 0, num_gather - 1);
+   hypre_NodeCommSortEntries(scatter_entries, 0, num_scatter - 1);
+
+   hypre_NodeCommStageMessages(num_gather, gather_entries, send_len, send_map_starts,
+                               &stages[0].num_sends, &stages[0].send_procs,
+                               &stages[0].send_starts, &stages[0].send_map);
+   hypre_NodeCommStageMessages(num_scatter, scatter_entries, recv_len, recv_vec_starts,
+                               &stages[2].num_recvs, &stages[2].recv_procs,
+                               &stages[2].recv_starts, &node_comm_pkg -> recv_map);
+
+   /*-----------------------------------------------------------------------
+    * Tell the handlers about the segments: (0, source, destination, length)
+    * for gathered ones and (1, source, destination, length) for scattered
+    * ones, in the order of the stage 1 and stage 3 messages
+    *-----------------------------------------------------------------------*/
+
+   out_counts = hypre_CTAlloc(HYPRE_Int, local_size, HYPRE_MEMORY_HOST);
+   in_counts  = hypre_CTAlloc(HYPRE_Int, local_size, HYPRE_MEMORY_HOST);
+   out_starts = hypre_CTAlloc(HYPRE_Int, local_size + 1, HYPRE_MEMORY_HOST);
+   in_starts  = hypre_CTAlloc(HYPRE_Int, local_size + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_gather; i++)
+   {
+      out_counts[all_info[2*gather_entries[4*i]+1]]++;
+   }
+   for (i = 0; i < num_scatter; i++)
+   {
+      out_counts[all_info[2*scatter_entries[4*i]+1]]++;
+   }
+   hypre_MPI_Alltoall(out_counts, 1, HYPRE_MPI_INT, in_counts, 1, HYPRE_MPI_INT, node_comm);
+   for (l = 0; l < local_size; l++)
+   {
+      out_starts[l+1] = out_starts[l] + out_counts[l];
+      in_starts[l+1]  = in_starts[l] + in_counts[l];
+      out_counts[l]   = out_starts[l];
+   }
+
+   out_data = hypre_TAlloc(HYPRE_Int, 4*out_starts[local_size], HYPRE_MEMORY_HOST);
+   in_data  = hypre_TAlloc(HYPRE_Int, 4*in_starts[local_size], HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_gather; i++)
+   {
+      k = out_counts[all_info[2*gather_entries[4*i]+1]]++;
+      out_data[4*k]   = 0;
+      out_data[4*k+1] = my_id;
+      out_data[4*k+2] = gather_entries[4*i+1];
+      out_data[4*k+3] = send_len[gather_entries[4*i+3]];
+   }
+   for (i = 0; i < num_scatter; i++)
+   {
+      k = out_counts[all_info[2*scatter_entries[4*i]+1]]++;
+      out_data[4*k]   = 1;
+      out_data[4*k+1] = scatter_entries[4*i+1];
+      out_data[4*k+2] = my_id;
+      out_data[4*k+3] = recv_len[scatter_entries[4*i+3]];
+   }
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, 2*local_size, HYPRE_MEMORY_HOST);
+   num_requests = 0;
+   for (l = 0; l < local_size; l++)
+   {
+      if (in_starts[l+1] > in_starts[l])
+      {
+         hypre_MPI_Irecv(&in_data[4*in_starts[l]], 4*(in_starts[l+1] - in_starts[l]),
+                         HYPRE_MPI_INT, l, 0, node_comm, &requests[num_requests++]);
+      }
+   }
+   for (l = 0; l < local_size; l++)
+   {
+      if (out_starts[l+1] > out_starts[l])
+      {
+         hypre_MPI_Isend(&out_data[4*out_starts[l]], 4*(out_starts[l+1] - out_starts[l]),
+                         HYPRE_MPI_INT, l, 0, node_comm, &requests[num_requests++]);
+      }
+   }
+   hypre_MPI_Waitall(num_requests, requests, hypre_MPI_STATUSES_IGNORE);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Handler side: segments from the ranks of this node (from_*), in the
+    * order they arrive in stage 1, and segments to them (to_*)
+    *-----------------------------------------------------------------------*/
+
+   num_in = in_starts[local_size];
+   from_s   = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   from_p   = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   from_len = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   from_pos = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   to_s     = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   to_p     = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   to_len   = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   to_pos   = hypre_TAlloc(HYPRE_Int, num_in, HYPRE_MEMORY_HOST);
+   entries  = hypre_TAlloc(HYPRE_Int, 4*num_in, HYPRE_MEMORY_HOST);
+
+   num_from = 0;
+   num_to   = 0;
+   size     = 0;
+   for (k = 0; k < num_in; k++)
+   {
+      if (in_data[4*k] == 0)
+      {
+         from_s[num_from]   = in_data[4*k+1];
+         from_p[num_from]   = in_data[4*k+2];
+         from_len[num_from] = in_data[4*k+3];
+         from_pos[num_from] = size;
+         size += from_len[num_from];
+         num_from++;
+      }
+      else
+      {
+         to_s[num_to]   = in_data[4*k+1];
+         to_p[num_to]   = in_data[4*k+2];
+         to_len[num_to] = in_data[4*k+3];
+         num_to++;
+      }
+   }
+
+   /* stage 1 receives: one message per rank of this node, in rank order */
+   for (k = 0; k < num_from; k++)
+   {
+      entries[4*k]   = from_s[k];
+      entries[4*k+1] = 0;
+      entries[4*k+2] = 0;
+      entries[4*k+3] = k;
+   }
+   hypre_NodeCommStageMessages(num_from, entries, from_len, NULL,
+                               &stages[0].num_recvs, &stages[0].recv_procs,
+                               &stages[0].recv_starts, NULL);
+
+   /* stage 2 sends: one message per destination node, ordered by
+      (source, destination) within it */
+   for (k = 0; k < num_from; k++)
+   {
+      node = node_of[from_p[k]];
+      entries[4*k]   = hypre_NodeCommHandler(node, my_node);
+      entries[4*k+1] = from_s[k];
+      entries[4*k+2] = from_p[k];
+      entries[4*k+3] = k;
+   }
+   hypre_NodeCommSortEntries(entries, 0, num_from - 1);
+   hypre_NodeCommStageMessages(num_from, entries, from_len, from_pos,
+                               &stages[1].num_sends, &stages[1].send_procs,
+                               &stages[1].send_starts, &stages[1].send_map);
+
+   /* stage 2 receives: one message per source node, in the same order */
+   for (k = 0; k < num_to; k++)
+   {
+      node = node_of[to_s[k]];
+      entries[4*k]   = hypre_NodeCommHandler(node, my_node);
+      entries[4*k+1] = to_s[k];
+      entries[4*k+2] = to_p[k];
+      entries[4*k+3] = k;
+   }
+   hypre_NodeCommSortEntries(entries, 0, num_to - 1);
+   hypre_NodeCommStageMessages(num_to, entries, to_len, NULL,
+                               &stages[1].num_recvs, &stages[1].recv_procs,
+                               &stages[1].recv_starts, NULL);
+   size = 0;
+   for (j = 0; j < num_to; j++)
+   {
+      k = entries[4*j+3];
+      to_pos[k] = size;
+      size += to_len[k];
+   }
+
+   /* stage 3 sends: one message per destination, ordered by source */
+   for (k = 0; k < num_to; k++)
+   {
+      entries[4*k]   = to_p[k];
+      entries[4*k+1] = to_s[k];
+      entries[4*k+2] = 0;
+      entries[4*k+3] = k;
+   }
+   hypre_NodeCommSortEntries(entries, 0, num_to - 1);
+   hypre_NodeCommStageMessages(num_to, entries, to_len, to_pos,
+                               &stages[2].num_sends, &stages[2].send_procs,
+                               &stages[2].send_starts, &stages[2].send_map);
+
+#undef hypre_NodeCommHandler
+
+   hypre_ParCSRCommPkgNodeCommPkg(comm_pkg) = node_comm_pkg;
+
+   hypre_TFree(all_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_of, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_ranks, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(gather_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(scatter_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(out_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(in_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(out_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(in_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(out_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(in_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(from_s, HYPRE_MEMORY_HOST);
+   hypre_TFree(from_p, HYPRE_MEMORY_HOST);
+   hypre_TFree(from_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(from_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(to_s, HYPRE_MEMORY_HOST);
+   hypre_TFree(to_p, HYPRE_MEMORY_HOST);
+   hypre_TFree(to_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(to_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+   hypre_MPI_Comm_free(&node_comm);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNodeComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRNodeCommPkg *node_comm_pkg = hypre_ParCSRCommPkgNodeCommPkg(comm_pkg);
+   HYPRE_Int                i;
+
+   if (!node_comm_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < 3; i++)
+   {
+      hypre_TFree(node_comm_pkg -> stages[i].send_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(node_comm_pkg -> stages[i].send_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(node_comm_pkg -> stages[i].send_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(node_comm_pkg -> stages[i].recv_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(node_comm_pkg -> stages[i].recv_starts, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(node_comm_pkg -> local_sends, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_comm_pkg -> local_recvs, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_comm_pkg -> recv_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_comm_pkg, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgNodeCommPkg(comm_pkg) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgAvgMessageSize
+ *
+ * Average number of values per message of the job 1 exchange of comm_pkg
+ * over all ranks (0 if there are no messages).  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParCSRCommPkgAvgMessageSize( hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Real local[2], global[2];
+
+   local[0] = (HYPRE_Real) num_sends;
+   local[1] = (HYPRE_Real) hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   hypre_MPI_Allreduce(local, global, 2, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParCSRCommPkgComm(comm_pkg));
+
+   return (global[0] > 0.0) ? global[1] / global[0] : 0.0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixNodeCommSetup
+ *
+ * Creates the node-aware plan for the comm_pkg of A, creating the comm_pkg
+ * if needed.  Collective on the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixNodeCommSetup( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   hypre_ParCSRCommPkgCreateNodeComm(hypre_ParCSRMatrixCommPkg(A));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommStart, hypre_ParCSRNodeCommFinish
+ *
+ * Node-aware job 1 exchange on host data, used by
+ * hypre_ParCSRCommHandleCreate_v2 and hypre_ParCSRCommHandleDestroy.  Start
+ * only posts the on-node messages, the stage 1 sends and all the receives, so
+ * that it does not wait for the other ranks of the node; Finish forwards the
+ * data of stage 1 to stage 2 and of stage 2 to stage 3 as it arrives.  The
+ * requests are ordered as
+ *
+ *    on-node recvs | stage 3 recvs | stage 2 recvs | on-node sends |
+ *    stage 1 recvs | stage 1 sends | stage 2 sends | stage 3 sends
+ *
+ * and the stage buffers are allocated in one block, owned by the handle.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRNodeCommStart( hypre_ParCSRCommPkg  *comm_pkg,
+                           HYPRE_Complex        *send_data,
+                           HYPRE_Complex        *recv_data,
+                           HYPRE_Int            *num_requests_ptr,
+                           hypre_MPI_Request   **requests_ptr,
+                           HYPRE_Complex       **buffer_ptr )
+{
+   MPI_Comm                   comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                 *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   hypre_ParCSRNodeCommPkg   *node_comm_pkg   = hypre_ParCSRCommPkgNodeCommPkg(comm_pkg);
+   hypre_ParCSRNodeCommStage *stages          = node_comm_pkg -> stages;
+   HYPRE_Int                  num_local_sends = node_comm_pkg -> num_local_sends;
+   HYPRE_Int                  num_local_recvs = node_comm_pkg -> num_local_recvs;
+   HYPRE_Complex             *buffer, *buf[6];
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  num_requests, size[6];
+   HYPRE_Int                  i, k, j, ip, vec_start, vec_len;
+
+   for (k = 0; k < 3; k++)
+   {
+      size[2*k]   = stages[k].send_starts[stages[k].num_sends];
+      size[2*k+1] = stages[k].recv_starts[stages[k].num_recvs];
+   }
+   /* never NULL, since the handle uses it to know that Finish is needed */
+   buffer = hypre_TAlloc(HYPRE_Complex, size[0] + size[1] + size[2] + size[3] + size[4] + size[5] + 1,
+                         HYPRE_MEMORY_HOST);
+   buf[0] = buffer;
+   for (k = 1; k < 6; k++)
+   {
+      buf[k] = buf[k-1] + size[k-1];
+   }
+
+   num_requests = num_local_sends + num_local_recvs;
+   for (k = 0; k < 3; k++)
+   {
+      num_requests += stages[k].num_sends + stages[k].num_recvs;
+   }
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (i = 0; i < num_local_recvs; i++)
+   {
+      k = node_comm_pkg -> local_recvs[i];
+      ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, k);
+      vec_start = recv_vec_starts[k];
+      vec_len = recv_vec_starts[k+1] - vec_start;
+      hypre_MPI_Irecv(&recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, HYPRE_NODE_COMM_TAG_LOCAL, comm, &requests[j++]);
+   }
+   for (i = 0; i < stages[2].num_recvs; i++)
+   {
+      vec_start = stages[2].recv_starts[i];
+      vec_len = stages[2].recv_starts[i+1] - vec_start;
+      hypre_MPI_Irecv(&buf[5][vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      stages[2].recv_procs[i], HYPRE_NODE_COMM_TAG_SCATTER, comm, &requests[j++]);
+   }
+   for (i = 0; i < stages[1].num_recvs; i++)
+   {
+      vec_start = stages[1].recv_starts[i];
+      vec_len = stages[1].recv_starts[i+1] - vec_start;
+      hypre_MPI_Irecv(&buf[3][vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      stages[1].recv_procs[i], HYPRE_NODE_COMM_TAG_NODE, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_local_sends; i++)
+   {
+      k = node_comm_pkg -> local_sends[i];
+      ip = hypre_ParCSRCommPkgSendProc(comm_pkg, k);
+      vec_start = send_map_starts[k];
+      vec_len = send_map_starts[k+1] - vec_start;
+      hypre_MPI_Isend(&send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, HYPRE_NODE_COMM_TAG_LOCAL, comm, &requests[j++]);
+   }
+
+   /* stage 1: gather on the handlers */
+   for (i = 0; i < stages[0].num_recvs; i++)
+   {
+      vec_start = stages[0].recv_starts[i];
+      vec_len = stages[0].recv_starts[i+1] - vec_start;
+      hypre_MPI_Irecv(&buf[1][vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      stages[0].recv_procs[i], HYPRE_NODE_COMM_TAG_GATHER, comm, &requests[j++]);
+   }
+   for (k = 0; k < size[0]; k++)
+   {
+      buf[0][k] = send_data[stages[0].send_map[k]];
+   }
+   for (i = 0; i < stages[0].num_sends; i++)
+   {
+      vec_start = stages[0].send_starts[i];
+      vec_len = stages[0].send_starts[i+1] - vec_start;
+      hypre_MPI_Isend(&buf[0][vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      stages[0].send_procs[i], HYPRE_NODE_COMM_TAG_GATHER, comm, &requests[j++]);
+   }
+
+   *num_requests_ptr = num_requests;
+   *requests_ptr     = requests;
+   *buffer_ptr       = buffer;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRNodeCommFinish( hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_ParCSRCommPkg       *comm_pkg      = hypre_ParCSRCommHandleCommPkg(comm_handle);
+   MPI_Comm                   comm          = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRNodeCommPkg   *node_comm_pkg = hypre_ParCSRCommPkgNodeCommPkg(comm_pkg);
+   hypre_ParCSRNodeCommStage *stages        = node_comm_pkg -> stages;
+   HYPRE_Complex             *recv_data     = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+   HYPRE_Complex             *buffer        = hypre_ParCSRCommHandleNodeCommBuffer(comm_handle);
+   HYPRE_Int                  num_requests  = hypre_ParCSRCommHandleNumRequests(comm_handle);
+   hypre_MPI_Request         *requests      = hypre_ParCSRCommHandleRequests(comm_handle);
+   HYPRE_Complex             *buf[6];
+   HYPRE_Int                  size[6];
+   HYPRE_Int                  i, k, j, vec_start, vec_len;
+
+   for (k = 0; k < 3; k++)
+   {
+      size[2*k]   = stages[k].send_starts[stages[k].num_sends];
+      size[2*k+1] = stages[k].recv_starts[stages[k].num_recvs];
+   }
+   buf[0] = buffer;
+   for (k = 1; k < 6; k++)
+   {
+      buf[k] = buf[k-1] + size[k-1];
+   }
+
+   /* stage 2: one message per pair of nodes, once the gather has arrived */
+   j = node_comm_pkg -> num_local_recvs + stages[2].num_recvs + stages[1].num_recvs +
+       node_comm_pkg -> num_local_sends;
+   hypre_MPI_Waitall(stages[0].num_recvs, &requests[j], hypre_MPI_STATUSES_IGNORE);
+
+   for (k = 0; k < size[2]; k++)
+   {
+      buf[2][k] = buf[1][stages[1].send_map[k]];
+   }
+   j += stages[0].num_recvs + stages[0].num_sends;
+   for (i = 0; i < stages[1].num_sends; i++)
+   {
+      vec_start = stages[1].send_starts[i];
+      vec_len = stages[1].send_starts[i+1] - vec_start;
+      hypre_MPI_Isend(&buf[2][vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      stages[1].send_procs[i], HYPRE_NODE_COMM_TAG_NODE, comm, &requests[j++]);
+   }
+
+   /* stage 2 receives */
+   j = node_comm_pkg -> num_local_recvs + stages[2].num_recvs;
+   hypre_MPI_Waitall(stages[1].num_recvs, &requests[j], hypre_MPI_STATUSES_IGNORE);
+
+   /* stage 3: scatter from the handlers */
+   for (k = 0; k < size[4]; k++)
+   {
+      buf[4][k] = buf[3][stages[2].send_map[k]];
+   }
+   j = num_requests - stages[2].num_sends;
+   for (i = 0; i < stages[2].num_sends; i++)
+   {
+      vec_start = stages[2].send_starts[i];
+      vec_len = stages[2].send_starts[i+1] - vec_start;
+      hypre_MPI_Isend(&buf[4][vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      stages[2].send_procs[i], HYPRE_NODE_COMM_TAG_SCATTER, comm, &requests[j++]);
+   }
+   hypre_MPI_Waitall(num_requests, requests, hypre_MPI_STATUSES_IGNORE);
+
+   for (k = 0; k < size[5]; k++)
+   {
+      recv_data[node_comm_pkg -> recv_map[k]] = buf[5][k];
+   }
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommHandleNodeCommBuffer(comm_handle) = NULL;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,1185 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Row-streamed Galerkin triple product C = R^T A P.
+ *
+ * hypre_ParCSRMatrixRAPKT and the two-product path of BoomerAMG form Q = A*P
+ * first, which is the largest temporary of the AMG setup on the fine levels.
+ * Here every row I of C is formed on its own: row I of R^T A is accumulated
+ * first, over the fine columns, and then multiplied with P,
+ *
+ *    C(I,:) = sum_k (R^T A)(I,k) P(k,:),
+ *
+ * with the rows k of P taken from P_diag/P_offd for the local k and from the
+ * external rows P_ext otherwise, so that A*P is never stored.  The rows are
+ * formed in two passes (count, then fill) by the threads, each with its own
+ * pair of accumulators (for the rows of R^T A and of C): a dense marker if the
+ * column space has at most HYPRE_RAP_STREAM_DENSE_COLS columns, otherwise an
+ * open addressing hash table sized for the row.  Besides C, the only memory
+ * used is P_ext, the rows of C sent to the other processes, and the
+ * accumulators.
+ *
+ * The rows of C for the off-processor columns of R (C_int) are formed first
+ * and their exchange is overlapped with the count pass over the local rows.
+ * The received rows (C_ext) are merged into the local rows in the fill pass,
+ * so no partial C is formed either.  The diagonal comes first in the rows of
+ * C_diag if C is square.
+ *
+ * The product can be split in two phases: hypre_ParCSRMatrixRAPStreamInit
+ * posts the fetch of P_ext, and hypre_ParCSRMatrixRAPStreamWait transposes R
+ * before waiting for it.  BoomerAMG posts the fetch as soon as P of a level
+ * is final, so it overlaps the rest of the level's setup.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/* the dense marker is used if the column space is at most this large */
+#define HYPRE_RAP_STREAM_DENSE_COLS  (1 << 20)
+
+/* the accumulator of the rows of R^T A starts over after this many entries */
+#define HYPRE_RAP_STREAM_MAX_COUNT   (1 << 30)
+
+/*--------------------------------------------------------------------------
+ * Operands of the product of a set of rows of R^T with A and P.  The offd
+ * column indices of the result are those of P_offd and P_ext_offd mapped by
+ * P_offd_map and Pext_offd_map (none for the identity).  The rows of C_ext
+ * to be added to row I are ext_rows[ext_ptr[I]:ext_ptr[I+1]].
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_CSRMatrix *RT;
+   hypre_CSRMatrix *A_diag;
+   hypre_CSRMatrix *A_offd;
+   hypre_CSRMatrix *P_diag;
+   hypre_CSRMatrix *P_offd;
+   hypre_CSRMatrix *Pext_diag;
+   hypre_CSRMatrix *Pext_offd;
+   hypre_CSRMatrix *Cext_diag;
+   hypre_CSRMatrix *Cext_offd;
+   HYPRE_Int       *P_offd_map;
+   HYPRE_Int       *Pext_offd_map;
+   HYPRE_Int       *ext_ptr;
+   HYPRE_Int       *ext_rows;
+   HYPRE_Int        num_cols_diag;
+   HYPRE_Int        num_cols_offd;
+   HYPRE_Int        diag_first;
+
+} hypre_RAPStreamData;
+
+/*--------------------------------------------------------------------------
+ * Accumulator of a thread.  Columns are numbered diag first, then offd.  For
+ * every column, the marker or the hash table holds the position of its entry
+ * in the diag or offd part of the output; a position before the start of the
+ * current row means that the column is not in the row yet.  Entry p is stored
+ * at p - diag_base of diag_j (p - offd_base of offd_j), if those are set.
+ *
+ * The accumulator of the rows of C writes into C itself (no entries in the
+ * count pass); the one of the rows of R^T A into its own buffers of length
+ * size, which only hold the current row.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int      num_cols_diag;
+   HYPRE_Int      num_cols;
+   HYPRE_Int     *marker;
+   HYPRE_Int     *hash;
+   HYPRE_Int      hash_size;
+   HYPRE_Int      mask;
+   HYPRE_Int      diag_start;
+   HYPRE_Int      offd_start;
+   HYPRE_Int      diag_cnt;
+   HYPRE_Int      offd_cnt;
+   HYPRE_Int      diag_base;
+   HYPRE_Int      offd_base;
+   HYPRE_Int     *diag_j;
+   HYPRE_Complex *diag_data;
+   HYPRE_Int     *offd_j;
+   HYPRE_Complex *offd_data;
+   HYPRE_Int      size;
+
+} hypre_RAPStreamAcc;
+
+static inline HYPRE_Int
+hypre_RAPStreamHash( HYPRE_Int col,
+                     HYPRE_Int mask )
+{
+   hypre_uint h = (hypre_uint) col * 2654435761u;
+
+   return (HYPRE_Int) ((h ^ (h >> 16)) & (hypre_uint) mask);
+}
+
+static void
+hypre_RAPStreamAccInit( hypre_RAPStreamAcc *acc,
+                        HYPRE_Int           num_cols_diag,
+                        HYPRE_Int           num_cols_offd )
+{
+   HYPRE_Int k;
+
+   acc->num_cols_diag = num_cols_diag;
+   acc->num_cols  = num_cols_diag + num_cols_offd;
+   acc->marker    = NULL;
+   acc->hash      = NULL;
+   acc->hash_size = 0;
+   acc->mask      = 0;
+   acc->diag_cnt  = 0;
+   acc->offd_cnt  = 0;
+   acc->diag_base = 0;
+   acc->offd_base = 0;
+   acc->diag_j    = NULL;
+   acc->diag_data = NULL;
+   acc->offd_j    = NULL;
+   acc->offd_data = NULL;
+   acc->size      = 0;
+
+   if (acc->num_cols <= HYPRE_RAP_STREAM_DENSE_COLS)
+   {
+      acc->marker = hypre_TAlloc(HYPRE_Int, acc->num_cols, HYPRE_MEMORY_HOST);
+      for (k = 0; k < acc->num_cols; k++)
+      {
+         acc->marker[k] = -1;
+      }
+   }
+}
+
+/* frees the accumulator and, if owned, its buffers */
+static void
+hypre_RAPStreamAccDestroy( hypre_RAPStreamAcc *acc )
+{
+   hypre_TFree(acc->marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(acc->hash, HYPRE_MEMORY_HOST);
+   if (acc->size)
+   {
+      hypre_TFree(acc->diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(acc->diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(acc->offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(acc->offd_data, HYPRE_MEMORY_HOST);
+   }
+}
+
+/* starts a new row with at most bound entries */
+static void
+hypre_RAPStreamAccStartRow( hypre_RAPStreamAcc *acc,
+                            HYPRE_Int           bound )
+{
+   HYPRE_Int size = 64;
+   HYPRE_Int k;
+
+   acc->diag_start = acc->diag_cnt;
+   acc->offd_start = acc->offd_cnt;
+
+   if (!acc->marker)
+   {
+      while (size < 2 * bound)
+      {
+         size *= 2;
+      }
+      if (size > acc->hash_size)
+      {
+         hypre_TFree(acc->hash, HYPRE_MEMORY_HOST);
+         acc->hash = hypre_TAlloc(HYPRE_Int, 2 * size, HYPRE_MEMORY_HOST);
+         for (k = 0; k < size; k++)
+         {
+            acc->hash[2*k]   = 0;
+            acc->hash[2*k+1] = -1;
+         }
+         acc->hash_size = size;
+      }
+      acc->mask = size - 1;
+   }
+}
+
+/* starts a new row of an accumulator with its own buffers */
+static void
+hypre_RAPStreamAccStartBufferRow( hypre_RAPStreamAcc *acc,
+                                  HYPRE_Int           bound )
+{
+   HYPRE_Int k;
+
+   /* start over before the positions overflow */
+   if (acc->diag_cnt > HYPRE_RAP_STREAM_MAX_COUNT || acc->offd_cnt > HYPRE_RAP_STREAM_MAX_COUNT)
+   {
+      for (k = 0; acc->marker && k < acc->num_cols; k++)
+      {
+         acc->marker[k] = -1;
+      }
+      for (k = 0; k < acc->hash_size; k++)
+      {
+         acc->hash[2*k+1] = -1;
+      }
+      acc->diag_cnt = 0;
+      acc->offd_cnt = 0;
+   }
+
+   if (bound > acc->size)
+   {
+      hypre_TFree(acc->diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(acc->diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(acc->offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(acc->offd_data, HYPRE_MEMORY_HOST);
+      acc->size      = hypre_max(2 * acc->size, bound);
+      acc->diag_j    = hypre_TAlloc(HYPRE_Int, acc->size, HYPRE_MEMORY_HOST);
+      acc->diag_data = hypre_TAlloc(HYPRE_Complex, acc->size, HYPRE_MEMORY_HOST);
+      acc->offd_j    = hypre_TAlloc(HYPRE_Int, acc->size, HYPRE_MEMORY_HOST);
+      acc->offd_data = hypre_TAlloc(HYPRE_Complex, acc->size, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_RAPStreamAccStartRow(acc, bound);
+   acc->diag_base = acc->diag_start;
+   acc->offd_base = acc->offd_start;
+}
+
+static inline void
+hypre_RAPStreamAccAdd( hypre_RAPStreamAcc *acc,
+                       HYPRE_Int           col,
+                       HYPRE_Complex       value )
+{
+   HYPRE_Int  num_cols_diag = acc->num_cols_diag;
+   HYPRE_Int *pos;
+   HYPRE_Int  h, key;
+
+   if (acc->marker)
+   {
+      pos = &acc->marker[col];
+   }
+   else
+   {
+      /* a slot with a stale position is free for this row */
+      h = hypre_RAPStreamHash(col, acc->mask);
+      while (1)
+      {
+         key = acc->hash[2*h];
+         if (acc->hash[2*h+1] < (key < num_cols_diag ? acc->diag_start : acc->offd_start))
+         {
+            acc->hash[2*h]   = col;
+            acc->hash[2*h+1] = -1;
+            break;
+         }
+         if (key == col)
+         {
+            break;
+         }
+         h = (h + 1) & acc->mask;
+      }
+      pos = &acc->hash[2*h+1];
+   }
+
+   if (col < num_cols_diag)
+   {
+      if (*pos < acc->diag_start)
+      {
+         *pos = acc->diag_cnt++;
+         if (acc->diag_j)
+         {
+            acc->diag_j[*pos - acc->diag_base]    = col;
+            acc->diag_data[*pos - acc->diag_base] = value;
+         }
+      }
+      else if (acc->diag_j)
+      {
+         acc->diag_data[*pos - acc->diag_base] += value;
+      }
+   }
+   else
+   {
+      if (*pos < acc->offd_start)
+      {
+         *pos = acc->offd_cnt++;
+         if (acc->offd_j)
+         {
+            acc->offd_j[*pos - acc->offd_base]    = col - num_cols_diag;
+            acc->offd_data[*pos - acc->offd_base] = value;
+         }
+      }
+      else if (acc->offd_j)
+      {
+         acc->offd_data[*pos - acc->offd_base] += value;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPStreamRow
+ *
+ * Forms row I of R^T A in ra, then row I of the product in acc, starting at
+ * its current positions.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RAPStreamRow( hypre_RAPStreamData *data,
+                    HYPRE_Int            I,
+                    hypre_RAPStreamAcc  *ra,
+                    hypre_RAPStreamAcc  *acc )
+{
+   HYPRE_Int     *RT_i           = hypre_CSRMatrixI(data->RT);
+   HYPRE_Int     *RT_j           = hypre_CSRMatrixJ(data->RT);
+   HYPRE_Complex *RT_data        = hypre_CSRMatrixData(data->RT);
+   HYPRE_Int     *A_diag_i       = hypre_CSRMatrixI(data->A_diag);
+   HYPRE_Int     *A_diag_j       = hypre_CSRMatrixJ(data->A_diag);
+   HYPRE_Complex *A_diag_data    = hypre_CSRMatrixData(data->A_diag);
+   HYPRE_Int     *A_offd_i       = hypre_CSRMatrixI(data->A_offd);
+   HYPRE_Int     *A_offd_j       = hypre_CSRMatrixJ(data->A_offd);
+   HYPRE_Complex *A_offd_data    = hypre_CSRMatrixData(data->A_offd);
+   HYPRE_Int      num_cols_A     = hypre_CSRMatrixNumCols(data->A_diag);
+   HYPRE_Int     *P_diag_i       = hypre_CSRMatrixI(data->P_diag);
+   HYPRE_Int     *P_diag_j       = hypre_CSRMatrixJ(data->P_diag);
+   HYPRE_Complex *P_diag_data    = hypre_CSRMatrixData(data->P_diag);
+   HYPRE_Int     *P_offd_i       = hypre_CSRMatrixI(data->P_offd);
+   HYPRE_Int     *P_offd_j       = hypre_CSRMatrixJ(data->P_offd);
+   HYPRE_Complex *P_offd_data    = hypre_CSRMatrixData(data->P_offd);
+   HYPRE_Int     *P_offd_map     = data->P_offd_map;
+   HYPRE_Int     *Pext_offd_map  = data->Pext_offd_map;
+   HYPRE_Int      num_cols_diag  = data->num_cols_diag;
+   HYPRE_Int      has_P_offd     = hypre_CSRMatrixNumCols(data->P_offd) > 0;
+   HYPRE_Int      has_Pext       = data->Pext_diag != NULL;
+   HYPRE_Int     *Pext_diag_i    = NULL;
+   HYPRE_Int     *Pext_diag_j    = NULL;
+   HYPRE_Complex *Pext_diag_data = NULL;
+   HYPRE_Int     *Pext_offd_i    = NULL;
+   HYPRE_Int     *Pext_offd_j    = NULL;
+   HYPRE_Complex *Pext_offd_data = NULL;
+   HYPRE_Int      ir, ia, ip, i, k, e, r, col, bound;
+   HYPRE_Int      ra_diag_len, ra_offd_len;
+   HYPRE_Complex  r_entry, ra_entry;
+
+   if (has_Pext)
+   {
+      Pext_diag_i    = hypre_CSRMatrixI(data->Pext_diag);
+      Pext_diag_j    = hypre_CSRMatrixJ(data->Pext_diag);
+      Pext_diag_data = hypre_CSRMatrixData(data->Pext_diag);
+      Pext_offd_i    = hypre_CSRMatrixI(data->Pext_offd);
+      Pext_offd_j    = hypre_CSRMatrixJ(data->Pext_offd);
+      Pext_offd_data = hypre_CSRMatrixData(data->Pext_offd);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Row I of R^T A; the columns of A_offd only matter if there is a P_ext
+    *-----------------------------------------------------------------------*/
+
+   bound = 0;
+   for (ir = RT_i[I]; ir < RT_i[I+1]; ir++)
+   {
+      i = RT_j[ir];
+      bound += A_diag_i[i+1] - A_diag_i[i];
+      if (has_Pext)
+      {
+         bound += A_offd_i[i+1] - A_offd_i[i];
+      }
+   }
+   hypre_RAPStreamAccStartBufferRow(ra, bound);
+
+   for (ir = RT_i[I]; ir < RT_i[I+1]; ir++)
+   {
+      i = RT_j[ir];
+      r_entry = RT_data[ir];
+      for (ia = A_diag_i[i]; ia < A_diag_i[i+1]; ia++)
+      {
+         hypre_RAPStreamAccAdd(ra, A_diag_j[ia], r_entry * A_diag_data[ia]);
+      }
+      if (has_Pext)
+      {
+         for (ia = A_offd_i[i]; ia < A_offd_i[i+1]; ia++)
+         {
+            hypre_RAPStreamAccAdd(ra, num_cols_A + A_offd_j[ia], r_entry * A_offd_data[ia]);
+         }
+      }
+   }
+   ra_diag_len = ra->diag_cnt - ra->diag_start;
+   ra_offd_len = ra->offd_cnt - ra->offd_start;
+
+   /*-----------------------------------------------------------------------
+    * Row I of R^T A P, plus the received rows of C
+    *-----------------------------------------------------------------------*/
+
+   if (!acc->marker)
+   {
+      bound = data->diag_first;
+      for (e = 0; e < ra_diag_len; e++)
+      {
+         k = ra->diag_j[e];
+         bound += P_diag_i[k+1] - P_diag_i[k];
+         if (has_P_offd)
+         {
+            bound += P_offd_i[k+1] - P_offd_i[k];
+         }
+      }
+      for (e = 0; e < ra_offd_len; e++)
+      {
+         k = ra->offd_j[e];
+         bound += Pext_diag_i[k+1] - Pext_diag_i[k];
+         bound += Pext_offd_i[k+1] - Pext_offd_i[k];
+      }
+      if (data->ext_ptr)
+      {
+         for (e = data->ext_ptr[I]; e < data->ext_ptr[I+1]; e++)
+         {
+            r = data->ext_rows[e];
+            bound += hypre_CSRMatrixI(data->Cext_diag)[r+1] - hypre_CSRMatrixI(data->Cext_diag)[r];
+            bound += hypre_CSRMatrixI(data->Cext_offd)[r+1] - hypre_CSRMatrixI(data->Cext_offd)[r];
+         }
+      }
+   }
+   hypre_RAPStreamAccStartRow(acc, bound);
+
+   if (data->diag_first)
+   {
+      hypre_RAPStreamAccAdd(acc, I, 0.0);
+   }
+
+   for (e = 0; e < ra_diag_len; e++)
+   {
+      k = ra->diag_j[e];
+      ra_entry = ra->diag_data[e];
+      for (ip = P_diag_i[k]; ip < P_diag_i[k+1]; ip++)
+      {
+         hypre_RAPStreamAccAdd(acc, P_diag_j[ip], ra_entry * P_diag_data[ip]);
+      }
+      if (has_P_offd)
+      {
+         for (ip = P_offd_i[k]; ip < P_offd_i[k+1]; ip++)
+         {
+            col = P_offd_map ? P_offd_map[P_offd_j[ip]] : P_offd_j[ip];
+            hypre_RAPStreamAccAdd(acc, num_cols_diag + col, ra_entry * P_offd_data[ip]);
+         }
+      }
+   }
+
+   for (e = 0; e < ra_offd_len; e++)
+   {
+      k = ra->offd_j[e];
+      ra_entry = ra->offd_data[e];
+      for (ip = Pext_diag_i[k]; ip < Pext_diag_i[k+1]; ip++)
+      {
+         hypre_RAPStreamAccAdd(acc, Pext_diag_j[ip], ra_entry * Pext_diag_data[ip]);
+      }
+      for (ip = Pext_offd_i[k]; ip < Pext_offd_i[k+1]; ip++)
+      {
+         col = Pext_offd_map ? Pext_offd_map[Pext_offd_j[ip]] : Pext_offd_j[ip];
+         hypre_RAPStreamAccAdd(acc, num_cols_diag + col, ra_entry * Pext_offd_data[ip]);
+      }
+   }
+
+   if (data->ext_ptr)
+   {
+      HYPRE_Int     *Cext_diag_i    = hypre_CSRMatrixI(data->Cext_diag);
+      HYPRE_Int     *Cext_diag_j    = hypre_CSRMatrixJ(data->Cext_diag);
+      HYPRE_Complex *Cext_diag_data = hypre_CSRMatrixData(data->Cext_diag);
+      HYPRE_Int     *Cext_offd_i    = hypre_CSRMatrixI(data->Cext_offd);
+      HYPRE_Int     *Cext_offd_j    = hypre_CSRMatrixJ(data->Cext_offd);
+      HYPRE_Complex *Cext_offd_data = hypre_CSRMatrixData(data->Cext_offd);
+
+      for (e = data->ext_ptr[I]; e < data->ext_ptr[I+1]; e++)
+      {
+         r = data->ext_rows[e];
+         for (ip = Cext_diag_i[r]; ip < Cext_diag_i[r+1]; ip++)
+         {
+            hypre_RAPStreamAccAdd(acc, Cext_diag_j[ip], Cext_diag_data[ip]);
+         }
+         for (ip = Cext_offd_i[r]; ip < Cext_offd_i[r+1]; ip++)
+         {
+            hypre_RAPStreamAccAdd(acc, num_cols_diag + Cext_offd_j[ip], Cext_offd_data[ip]);
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPStreamCount
+ *
+ * Lengths of the diag and offd parts of the rows rows[0:num_rows] (of rows
+ * 0:num_rows if rows is NULL) of the product, stored in diag_i and offd_i.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RAPStreamCount( hypre_RAPStreamData *data,
+                      HYPRE_Int            num_rows,
+                      HYPRE_Int           *rows,
+                      HYPRE_Int           *diag_i,
+                      HYPRE_Int           *offd_i )
+{
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      hypre_RAPStreamAcc ra, acc;
+      HYPRE_Int          ns, ne, n, I;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+      hypre_RAPStreamAccInit(&ra, hypre_CSRMatrixNumCols(data->A_diag),
+                             hypre_CSRMatrixNumCols(data->A_offd));
+      hypre_RAPStreamAccInit(&acc, data->num_cols_diag, data->num_cols_offd);
+
+      for (n = ns; n < ne; n++)
+      {
+         I = rows ? rows[n] : n;
+         hypre_RAPStreamRow(data, I, &ra, &acc);
+         diag_i[I] = acc.diag_cnt - acc.diag_start;
+         offd_i[I] = acc.offd_cnt - acc.offd_start;
+      }
+
+      hypre_RAPStreamAccDestroy(&ra);
+      hypre_RAPStreamAccDestroy(&acc);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RAPStreamFill
+ *
+ * Turns the row lengths in diag_i and offd_i into row pointers and forms
+ * rows 0:num_rows of the product.  The entries are first written by the
+ * threads that own the rows.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RAPStreamFill( hypre_RAPStreamData  *data,
+                     HYPRE_Int             num_rows,
+                     HYPRE_Int            *diag_i,
+                     HYPRE_Int            *offd_i,
+                     HYPRE_Int           **diag_j_ptr,
+                     HYPRE_Complex       **diag_data_ptr,
+                     HYPRE_Int           **offd_j_ptr,
+                     HYPRE_Complex       **offd_data_ptr )
+{
+   HYPRE_Int      *diag_j = NULL;
+   HYPRE_Complex  *diag_data = NULL;
+   HYPRE_Int      *offd_j = NULL;
+   HYPRE_Complex  *offd_data = NULL;
+   HYPRE_Int       diag_total, offd_total;
+   HYPRE_Int      *prefix_work;
+
+   prefix_work = hypre_TAlloc(HYPRE_Int, 2*(hypre_NumThreads()+1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      hypre_RAPStreamAcc ra, acc;
+      HYPRE_Int          ns, ne, I, len;
+      HYPRE_Int          diag_cnt = 0, offd_cnt = 0;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+      for (I = ns; I < ne; I++)
+      {
+         diag_cnt += diag_i[I];
+         offd_cnt += offd_i[I];
+      }
+      hypre_prefix_sum_pair(&diag_cnt, &diag_total, &offd_cnt, &offd_total, prefix_work);
+      for (I = ns; I < ne; I++)
+      {
+         len = diag_i[I];
+         diag_i[I] = diag_cnt;
+         diag_cnt += len;
+         len = offd_i[I];
+         offd_i[I] = offd_cnt;
+         offd_cnt += len;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+      {
+         diag_i[num_rows] = diag_total;
+         offd_i[num_rows] = offd_total;
+         diag_j    = hypre_TAlloc(HYPRE_Int, diag_total, HYPRE_MEMORY_HOST);
+         diag_data = hypre_TAlloc(HYPRE_Complex, diag_total, HYPRE_MEMORY_HOST);
+         offd_j    = hypre_TAlloc(HYPRE_Int, offd_total, HYPRE_MEMORY_HOST);
+         offd_data = hypre_TAlloc(HYPRE_Complex, offd_total, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_RAPStreamAccInit(&ra, hypre_CSRMatrixNumCols(data->A_diag),
+                             hypre_CSRMatrixNumCols(data->A_offd));
+      hypre_RAPStreamAccInit(&acc, data->num_cols_diag, data->num_cols_offd);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      acc.diag_j    = diag_j;
+      acc.diag_data = diag_data;
+      acc.offd_j    = offd_j;
+      acc.offd_data = offd_data;
+      if (ns < ne)
+      {
+         acc.diag_cnt = diag_i[ns];
+         acc.offd_cnt = offd_i[ns];
+      }
+
+      for (I = ns; I < ne; I++)
+      {
+         hypre_RAPStreamRow(data, I, &ra, &acc);
+      }
+
+      hypre_RAPStreamAccDestroy(&ra);
+      hypre_RAPStreamAccDestroy(&acc);
+   }
+
+   hypre_TFree(prefix_work, HYPRE_MEMORY_HOST);
+
+   *diag_j_ptr    = diag_j;
+   *diag_data_ptr = diag_data;
+   *offd_j_ptr    = offd_j;
+   *offd_data_ptr = offd_data;
+}
+
+/*--------------------------------------------------------------------------
+ * Request of a split-phase product: the operands and the pending fetch of
+ * the external rows of P
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix *R;
+   hypre_ParCSRMatrix *A;
+   hypre_ParCSRMatrix *P;
+   HYPRE_Int           keep_transpose;
+   void               *Pext_request;
+
+} hypre_RAPStreamRequest;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPStreamInit
+ *
+ * Starts the product C = R^T A P: posts the fetch of the rows of P for the
+ * off-processor columns of A and returns.  The caller can do other work
+ * before completing the product with hypre_ParCSRMatrixRAPStreamWait.  R, A
+ * and P must not change in between.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPStreamInit( hypre_ParCSRMatrix  *R,
+                                 hypre_ParCSRMatrix  *A,
+                                 hypre_ParCSRMatrix  *P,
+                                 HYPRE_Int            keep_transpose,
+                                 void               **request_ptr )
+{
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+   hypre_RAPStreamRequest *request;
+   HYPRE_Int               num_procs;
+
+   *request_ptr = NULL;
+
+   if (hypre_ParCSRMatrixGlobalNumRows(R) != hypre_ParCSRMatrixGlobalNumRows(A) ||
+       hypre_ParCSRMatrixNumRows(R) != hypre_ParCSRMatrixNumRows(A) ||
+       hypre_ParCSRMatrixGlobalNumCols(A) != hypre_ParCSRMatrixGlobalNumRows(P) ||
+       hypre_ParCSRMatrixNumCols(A) != hypre_ParCSRMatrixNumRows(P))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC," Error! Incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   request = hypre_CTAlloc(hypre_RAPStreamRequest, 1, HYPRE_MEMORY_HOST);
+   request->R = R;
+   request->A = A;
+   request->P = P;
+   request->keep_transpose = keep_transpose;
+
+   if (num_procs > 1)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      hypre_ParcsrGetExternalRowsInit(P, hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)),
+                                      hypre_ParCSRMatrixColMapOffd(A),
+                                      hypre_ParCSRMatrixCommPkg(A), 1,
+                                      &request->Pext_request);
+   }
+
+   *request_ptr = (void *) request;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPStreamWait
+ *
+ * Completes the product started by hypre_ParCSRMatrixRAPStreamInit.  The
+ * local transposes of R are formed before waiting for the rows of P.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatrixRAPStreamWait( void *vrequest )
+{
+   hypre_RAPStreamRequest *request = (hypre_RAPStreamRequest *) vrequest;
+
+   hypre_ParCSRMatrix  *R;
+   hypre_ParCSRMatrix  *A;
+   hypre_ParCSRMatrix  *P;
+   HYPRE_Int            keep_transpose;
+   MPI_Comm             comm;
+
+   hypre_CSRMatrix     *A_diag;
+   hypre_CSRMatrix     *A_offd;
+   HYPRE_Int            num_cols_offd_A;
+
+   hypre_CSRMatrix     *P_diag;
+   hypre_CSRMatrix     *P_offd;
+   HYPRE_BigInt        *col_map_offd_P;
+   HYPRE_BigInt         first_col_diag_P;
+   HYPRE_BigInt        *col_starts_P;
+   HYPRE_Int            num_cols_diag_P;
+   HYPRE_Int            num_cols_offd_P;
+
+   hypre_ParCSRCommPkg *comm_pkg_R;
+   hypre_CSRMatrix     *R_diag;
+   hypre_CSRMatrix     *R_offd;
+   hypre_CSRMatrix     *RT_diag = NULL;
+   hypre_CSRMatrix     *RT_offd = NULL;
+   HYPRE_Int            num_cols_diag_R;
+   HYPRE_Int            num_cols_offd_R;
+   HYPRE_BigInt        *col_starts_R;
+
+
+   hypre_CSRMatrix     *Ps_ext = NULL;
+   hypre_CSRMatrix     *Pext_diag = NULL;
+   hypre_CSRMatrix     *Pext_offd = NULL;
+   HYPRE_Int            num_cols_offd_Q = 0;
+   HYPRE_BigInt        *col_map_offd_Q = NULL;
+   HYPRE_Int           *map_P_to_Q = NULL;
+
+   hypre_ParCSRMatrix  *C;
+   hypre_CSRMatrix     *C_diag;
+   hypre_CSRMatrix     *C_offd;
+   HYPRE_Int           *C_diag_i, *C_diag_j = NULL;
+   HYPRE_Complex       *C_diag_data = NULL;
+   HYPRE_Int           *C_offd_i, *C_offd_j = NULL;
+   HYPRE_Complex       *C_offd_data = NULL;
+   HYPRE_Int            num_cols_offd_C = 0;
+   HYPRE_BigInt        *col_map_offd_C = NULL;
+
+   hypre_RAPStreamData  data;
+   HYPRE_BigInt         n_cols_R, n_cols_P;
+   HYPRE_Int            num_procs, i, j, cnt;
+
+   if (!request)
+   {
+      return NULL;
+   }
+
+   R = request->R;
+   A = request->A;
+   P = request->P;
+   keep_transpose = request->keep_transpose;
+   comm = hypre_ParCSRMatrixComm(A);
+
+   A_diag           = hypre_ParCSRMatrixDiag(A);
+   A_offd           = hypre_ParCSRMatrixOffd(A);
+   num_cols_offd_A  = hypre_CSRMatrixNumCols(A_offd);
+
+   P_diag           = hypre_ParCSRMatrixDiag(P);
+   P_offd           = hypre_ParCSRMatrixOffd(P);
+   col_map_offd_P   = hypre_ParCSRMatrixColMapOffd(P);
+   first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
+   col_starts_P     = hypre_ParCSRMatrixColStarts(P);
+   num_cols_diag_P  = hypre_CSRMatrixNumCols(P_diag);
+   num_cols_offd_P  = hypre_CSRMatrixNumCols(P_offd);
+
+   R_diag           = hypre_ParCSRMatrixDiag(R);
+   R_offd           = hypre_ParCSRMatrixOffd(R);
+   num_cols_diag_R  = hypre_CSRMatrixNumCols(R_diag);
+   num_cols_offd_R  = hypre_CSRMatrixNumCols(R_offd);
+   col_starts_R     = hypre_ParCSRMatrixColStarts(R);
+
+   n_cols_R = hypre_ParCSRMatrixGlobalNumCols(R);
+   n_cols_P = hypre_ParCSRMatrixGlobalNumCols(P);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   data.A_diag        = A_diag;
+   data.A_offd        = A_offd;
+   data.P_diag        = P_diag;
+   data.P_offd        = P_offd;
+   data.Pext_diag     = NULL;
+   data.Pext_offd     = NULL;
+   data.Cext_diag     = NULL;
+   data.Cext_offd     = NULL;
+   data.P_offd_map    = NULL;
+   data.Pext_offd_map = NULL;
+   data.ext_ptr       = NULL;
+   data.ext_rows      = NULL;
+   data.num_cols_diag = num_cols_diag_P;
+
+   C_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_R+1, HYPRE_MEMORY_HOST);
+   C_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_R+1, HYPRE_MEMORY_HOST);
+
+   if (num_procs > 1)
+   {
+      hypre_CSRMatrix *C_int;
+      hypre_CSRMatrix *C_ext = NULL;
+      hypre_CSRMatrix *C_ext_diag = NULL;
+      hypre_CSRMatrix *C_ext_offd = NULL;
+      HYPRE_Int       *map_Q_to_C = NULL;
+      HYPRE_Int       *map_P_to_C = NULL;
+      HYPRE_Int       *ext_ptr = NULL;
+      HYPRE_Int       *ext_rows = NULL;
+      HYPRE_Int       *ext_list = NULL;
+      HYPRE_Int        num_ext_rows = 0, num_ext_list = 0;
+      HYPRE_Int       *send_map_elmts_R;
+      HYPRE_Int       *offd_used;
+      void            *C_request;
+
+      /*-----------------------------------------------------------------
+       * Local transposes of R, while the external rows of P arrive
+       *-----------------------------------------------------------------*/
+
+      if (!hypre_ParCSRMatrixCommPkg(R))
+      {
+         hypre_MatvecCommPkgCreate(R);
+      }
+      comm_pkg_R = hypre_ParCSRMatrixCommPkg(R);
+
+      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      if (num_cols_offd_R)
+      {
+         hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
+      }
+
+      /*-----------------------------------------------------------------
+       * External rows of P, split into the local and the off-processor
+       * columns of C; col_map_offd_Q covers both those of P_offd and of
+       * P_ext
+       *-----------------------------------------------------------------*/
+
+      Ps_ext = hypre_ParcsrGetExternalRowsWait(request->Pext_request);
+      if (num_cols_offd_A)
+      {
+         hypre_CSRMatrixSplit(Ps_ext, first_col_diag_P, first_col_diag_P + num_cols_diag_P - 1,
+                              num_cols_offd_P, col_map_offd_P,
+                              &num_cols_offd_Q, &col_map_offd_Q, &Pext_diag, &Pext_offd);
+      }
+      else
+      {
+         num_cols_offd_Q = num_cols_offd_P;
+         col_map_offd_Q = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_Q, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_cols_offd_P; i++)
+         {
+            col_map_offd_Q[i] = col_map_offd_P[i];
+         }
+      }
+      hypre_CSRMatrixDestroy(Ps_ext);
+
+      if (num_cols_offd_P)
+      {
+         map_P_to_Q = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_Q && cnt < num_cols_offd_P; i++)
+         {
+            if (col_map_offd_Q[i] == col_map_offd_P[cnt])
+            {
+               map_P_to_Q[cnt++] = i;
+            }
+         }
+      }
+
+      data.Pext_diag     = Pext_diag;
+      data.Pext_offd     = Pext_offd;
+      data.P_offd_map    = map_P_to_Q;
+      data.num_cols_offd = num_cols_offd_Q;
+
+      /*-----------------------------------------------------------------
+       * Rows of C for the off-processor columns of R, sent to their owners
+       *-----------------------------------------------------------------*/
+
+      if (num_cols_offd_R)
+      {
+         HYPRE_Int     *int_diag_i, *int_diag_j, *int_offd_i, *int_offd_j;
+         HYPRE_Complex *int_diag_data, *int_offd_data;
+         HYPRE_Int     *C_int_i;
+         HYPRE_BigInt  *C_int_j;
+         HYPRE_Complex *C_int_data;
+
+         data.RT         = RT_offd;
+         data.diag_first = 0;
+
+         int_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_R+1, HYPRE_MEMORY_HOST);
+         int_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_R+1, HYPRE_MEMORY_HOST);
+         hypre_RAPStreamCount(&data, num_cols_offd_R, NULL, int_diag_i, int_offd_i);
+         hypre_RAPStreamFill(&data, num_cols_offd_R, int_diag_i, int_offd_i,
+                             &int_diag_j, &int_diag_data, &int_offd_j, &int_offd_data);
+
+         C_int = hypre_CSRMatrixCreate(num_cols_offd_R, n_cols_P,
+                                       int_diag_i[num_cols_offd_R] + int_offd_i[num_cols_offd_R]);
+         C_int_i    = hypre_TAlloc(HYPRE_Int, num_cols_offd_R+1, HYPRE_MEMORY_HOST);
+         C_int_j    = hypre_TAlloc(HYPRE_BigInt, hypre_CSRMatrixNumNonzeros(C_int), HYPRE_MEMORY_HOST);
+         C_int_data = hypre_TAlloc(HYPRE_Complex, hypre_CSRMatrixNumNonzeros(C_int), HYPRE_MEMORY_HOST);
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_R; i++)
+         {
+            C_int_i[i] = cnt;
+            for (j = int_diag_i[i]; j < int_diag_i[i+1]; j++)
+            {
+               C_int_j[cnt]      = first_col_diag_P + (HYPRE_BigInt) int_diag_j[j];
+               C_int_data[cnt++] = int_diag_data[j];
+            }
+            for (j = int_offd_i[i]; j < int_offd_i[i+1]; j++)
+            {
+               C_int_j[cnt]      = col_map_offd_Q[int_offd_j[j]];
+               C_int_data[cnt++] = int_offd_data[j];
+            }
+         }
+         C_int_i[num_cols_offd_R] = cnt;
+         hypre_CSRMatrixI(C_int)    = C_int_i;
+         hypre_CSRMatrixBigJ(C_int) = C_int_j;
+         hypre_CSRMatrixData(C_int) = C_int_data;
+
+         hypre_TFree(int_diag_i, HYPRE_MEMORY_HOST);
+         hypre_TFree(int_diag_j, HYPRE_MEMORY_HOST);
+         hypre_TFree(int_diag_data, HYPRE_MEMORY_HOST);
+         hypre_TFree(int_offd_i, HYPRE_MEMORY_HOST);
+         hypre_TFree(int_offd_j, HYPRE_MEMORY_HOST);
+         hypre_TFree(int_offd_data, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         C_int = hypre_CSRMatrixCreate(0, 0, 0);
+         hypre_CSRMatrixInitialize(C_int);
+      }
+
+      hypre_ExchangeExternalRowsInit(C_int, comm_pkg_R, &C_request);
+
+      /*-----------------------------------------------------------------
+       * Count the local rows while the rows of C are exchanged
+       *-----------------------------------------------------------------*/
+
+      data.RT         = RT_diag;
+      data.diag_first = (num_cols_diag_R == num_cols_diag_P);
+      hypre_RAPStreamCount(&data, num_cols_diag_R, NULL, C_diag_i, C_offd_i);
+
+      C_ext = hypre_ExchangeExternalRowsWait(C_request);
+      hypre_CSRMatrixDestroy(C_int);
+
+      /*-----------------------------------------------------------------
+       * Split the received rows and renumber the offd columns to those of
+       * C, which covers the columns of Q and of C_ext
+       *-----------------------------------------------------------------*/
+
+      if (C_ext)
+      {
+         hypre_CSRMatrixSplit(C_ext, first_col_diag_P, first_col_diag_P + num_cols_diag_P - 1,
+                              num_cols_offd_Q, col_map_offd_Q, &num_cols_offd_C, &col_map_offd_C,
+                              &C_ext_diag, &C_ext_offd);
+         num_ext_rows = hypre_CSRMatrixNumRows(C_ext);
+         hypre_CSRMatrixDestroy(C_ext);
+      }
+      else
+      {
+         num_cols_offd_C = num_cols_offd_Q;
+         col_map_offd_C = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_cols_offd_Q; i++)
+         {
+            col_map_offd_C[i] = col_map_offd_Q[i];
+         }
+      }
+
+      map_Q_to_C = hypre_TAlloc(HYPRE_Int, num_cols_offd_Q, HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (i = 0; i < num_cols_offd_C && cnt < num_cols_offd_Q; i++)
+      {
+         if (col_map_offd_C[i] == col_map_offd_Q[cnt])
+         {
+            map_Q_to_C[cnt++] = i;
+         }
+      }
+      if (num_cols_offd_P)
+      {
+         map_P_to_C = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_cols_offd_P; i++)
+         {
+            map_P_to_C[i] = map_Q_to_C[map_P_to_Q[i]];
+         }
+      }
+
+      /*-----------------------------------------------------------------
+       * Received rows by local row; the rows that receive some have to be
+       * counted again
+       *-----------------------------------------------------------------*/
+
+      if (num_ext_rows)
+      {
+         send_map_elmts_R = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_R);
+
+         ext_ptr  = hypre_CTAlloc(HYPRE_Int, num_cols_diag_R+1, HYPRE_MEMORY_HOST);
+         ext_rows = hypre_TAlloc(HYPRE_Int, num_ext_rows, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_ext_rows; i++)
+         {
+            ext_ptr[send_map_elmts_R[i]+1]++;
+         }
+         for (i = 0; i < num_cols_diag_R; i++)
+         {
+            if (ext_ptr[i+1])
+            {
+               num_ext_list++;
+            }
+            ext_ptr[i+1] += ext_ptr[i];
+         }
+         for (i = 0; i < num_ext_rows; i++)
+         {
+            ext_rows[ext_ptr[send_map_elmts_R[i]]++] = i;
+         }
+         for (i = num_cols_diag_R; i > 0; i--)
+         {
+            ext_ptr[i] = ext_ptr[i-1];
+         }
+         ext_ptr[0] = 0;
+
+         ext_list = hypre_TAlloc(HYPRE_Int, num_ext_list, HYPRE_MEMORY_HOST);
+         cnt = 0;
+         for (i = 0; i < num_cols_diag_R; i++)
+         {
+            if (ext_ptr[i+1] > ext_ptr[i])
+            {
+               ext_list[cnt++] = i;
+            }
+         }
+      }
+
+      data.Cext_diag     = C_ext_diag;
+      data.Cext_offd     = C_ext_offd;
+      data.ext_ptr       = ext_ptr;
+      data.ext_rows      = ext_rows;
+      data.P_offd_map    = map_P_to_C;
+      data.Pext_offd_map = map_Q_to_C;
+      data.num_cols_offd = num_cols_offd_C;
+
+      if (num_ext_list)
+      {
+         hypre_RAPStreamCount(&data, num_ext_list, ext_list, C_diag_i, C_offd_i);
+      }
+
+      hypre_RAPStreamFill(&data, num_cols_diag_R, C_diag_i, C_offd_i,
+                          &C_diag_j, &C_diag_data, &C_offd_j, &C_offd_data);
+
+      hypre_CSRMatrixDestroy(Pext_diag);
+      hypre_CSRMatrixDestroy(Pext_offd);
+      hypre_CSRMatrixDestroy(C_ext_diag);
+      hypre_CSRMatrixDestroy(C_ext_offd);
+      hypre_TFree(ext_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(ext_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(ext_list, HYPRE_MEMORY_HOST);
+      hypre_TFree(map_P_to_Q, HYPRE_MEMORY_HOST);
+      hypre_TFree(map_Q_to_C, HYPRE_MEMORY_HOST);
+      hypre_TFree(map_P_to_C, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------
+       * Drop the offd columns that no row of C hits
+       *-----------------------------------------------------------------*/
+
+      offd_used = hypre_CTAlloc(HYPRE_Int, num_cols_offd_C, HYPRE_MEMORY_HOST);
+      for (i = 0; i < C_offd_i[num_cols_diag_R]; i++)
+      {
+         offd_used[C_offd_j[i]] = 1;
+      }
+      cnt = 0;
+      for (i = 0; i < num_cols_offd_C; i++)
+      {
+         if (offd_used[i])
+         {
+            col_map_offd_C[cnt] = col_map_offd_C[i];
+            offd_used[i] = cnt++;
+         }
+      }
+      if (cnt < num_cols_offd_C)
+      {
+         for (i = 0; i < C_offd_i[num_cols_diag_R]; i++)
+         {
+            C_offd_j[i] = offd_used[C_offd_j[i]];
+         }
+         num_cols_offd_C = cnt;
+      }
+      hypre_TFree(offd_used, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      data.RT            = RT_diag;
+      data.diag_first    = (num_cols_diag_R == num_cols_diag_P);
+      data.num_cols_offd = 0;
+      hypre_RAPStreamCount(&data, num_cols_diag_R, NULL, C_diag_i, C_offd_i);
+      hypre_RAPStreamFill(&data, num_cols_diag_R, C_diag_i, C_offd_i,
+                          &C_diag_j, &C_diag_data, &C_offd_j, &C_offd_data);
+   }
+
+   if (keep_transpose)
+   {
+      R->diagT = RT_diag;
+      if (RT_offd)
+      {
+         R->offdT = RT_offd;
+      }
+   }
+   else
+   {
+      hypre_CSRMatrixDestroy(RT_diag);
+      hypre_CSRMatrixDestroy(RT_offd);
+   }
+
+   C = hypre_ParCSRMatrixCreate(comm, n_cols_R, n_cols_P, col_starts_R,
+                                col_starts_P, num_cols_offd_C, 0, 0);
+
+   /* Note that C does not own the partitionings */
+   hypre_ParCSRMatrixSetColStartsOwner(P,0);
+   hypre_ParCSRMatrixSetColStartsOwner(R,0);
+
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrixI(C_diag)           = C_diag_i;
+   hypre_CSRMatrixJ(C_diag)           = C_diag_j;
+   hypre_CSRMatrixData(C_diag)        = C_diag_data;
+   hypre_CSRMatrixNumNonzeros(C_diag) = C_diag_i[num_cols_diag_R];
+
+   C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrixI(C_offd)           = C_offd_i;
+   hypre_CSRMatrixNumNonzeros(C_offd) = C_offd_i[num_cols_diag_R];
+   if (num_cols_offd_C)
+   {
+      hypre_CSRMatrixJ(C_offd)    = C_offd_j;
+      hypre_CSRMatrixData(C_offd) = C_offd_data;
+      hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+   }
+   else
+   {
+      hypre_TFree(C_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(C_offd_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_map_offd_C, HYPRE_MEMORY_HOST);
+   }
+
+   if (num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(C);
+   }
+
+   hypre_TFree(request, HYPRE_MEMORY_HOST);
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPStream
+ *
+ * Same interface and result (up to the order of the summation) as
+ * hypre_ParCSRMatrixRAPKT, without forming A*P.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatrixRAPStream( hypre_ParCSRMatrix *R,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParCSRMatrix *P,
+                             HYPRE_Int           keep_transpose )
+{
+   void *request;
+
+   hypre_ParCSRMatrixRAPStreamInit(R, A, P, keep_transpose, &request);
+
+   return hypre_ParCSRMatrixRAPStreamWait(request);
+}
@@ -0,0 +1,434 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Shared memory halo exchange for hypre_ParCSRCommPkg
+ *
+ * The send buffer of the job 1 exchange lives in an MPI-3 shared memory
+ * window, and the ranks of the same node read their segments of it directly
+ * instead of receiving messages.  A second window holds, for each rank, the
+ * epoch of the data in its send buffer (flags[0]) and the last epoch read by
+ * each rank of the node (flags[1+l] for node rank l).  A sender publishes an
+ * exchange by raising flags[0]; a reader copies its segment once the flag has
+ * reached the epoch of the exchange and acknowledges it.  Finishing an
+ * exchange waits for these acknowledgements, so that the send buffer is free
+ * again afterwards, as with the completion of a send.  Ranks on other nodes
+ * keep using point-to-point messages.
+ *
+ * Epochs count the shared memory exchanges of a comm_pkg on each rank, which
+ * agree between neighbors since all ranks perform the same exchanges.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommSpin
+ *
+ * Waits until *flag >= epoch.  The probe keeps the progress of the other
+ * (point-to-point) requests of this rank going while it waits.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRShmCommSpin( hypre_ParCSRShmCommPkg *shm_comm_pkg,
+                         MPI_Comm                comm,
+                         volatile HYPRE_Int     *flag,
+                         HYPRE_Int               epoch )
+{
+   HYPRE_Int        probe_flag;
+   hypre_MPI_Status status;
+
+   hypre_MPI_Win_sync(shm_comm_pkg -> flag_win);
+   while (*flag < epoch)
+   {
+      hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, hypre_MPI_ANY_TAG, comm, &probe_flag, &status);
+      hypre_MPI_Win_sync(shm_comm_pkg -> flag_win);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateShmComm
+ *
+ * Creates the shared memory plan for the job 1 exchange of comm_pkg.
+ * Collective on the communicator of comm_pkg.  Nothing is created if the
+ * nodes have a single rank or the windows cannot be allocated (MPI-2).
+ * Creating and freeing the windows synchronize the ranks of a node, so the
+ * plan is meant for long-lived operators (see hypre_BoomerAMGSetup).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateShmComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm                comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int               num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int              *send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int              *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int               num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int              *recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+
+   hypre_ParCSRShmCommPkg *shm_comm_pkg;
+   MPI_Comm                node_comm;
+   HYPRE_Int               my_id, num_procs, local_id, local_size;
+   HYPRE_Int              *node_ranks, *local_of;
+   HYPRE_Int              *offsets;
+   hypre_MPI_Request      *requests;
+   HYPRE_Int               num_requests;
+   HYPRE_Complex          *base;
+   HYPRE_Int              *flags, *sender_flags;
+   hypre_MPI_Aint          size;
+   HYPRE_Int               disp_unit, ierr;
+   HYPRE_Int               i, k, l, proc;
+
+   if (hypre_ParCSRCommPkgShmCommPkg(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   if (num_procs == 1)
+   {
+      return hypre_error_flag;
+   }
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   hypre_MPI_Comm_split_type(comm, hypre_MPI_COMM_TYPE_SHARED, my_id,
+                             hypre_MPI_INFO_NULL, &node_comm);
+   hypre_MPI_Comm_rank(node_comm, &local_id);
+   hypre_MPI_Comm_size(node_comm, &local_size);
+   if (local_size == 1)
+   {
+      hypre_MPI_Comm_free(&node_comm);
+      return hypre_error_flag;
+   }
+
+   shm_comm_pkg = hypre_CTAlloc(hypre_ParCSRShmCommPkg, 1, HYPRE_MEMORY_HOST);
+
+   size = (hypre_MPI_Aint) send_map_starts[num_sends] * sizeof(HYPRE_Complex);
+   ierr = hypre_MPI_Win_allocate_shared(size, sizeof(HYPRE_Complex), hypre_MPI_INFO_NULL,
+                                        node_comm, &base, &shm_comm_pkg -> data_win);
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_TFree(shm_comm_pkg, HYPRE_MEMORY_HOST);
+      hypre_MPI_Comm_free(&node_comm);
+      return hypre_error_flag;
+   }
+   shm_comm_pkg -> send_buffer = base;
+
+   size = (hypre_MPI_Aint) (local_size + 1) * sizeof(HYPRE_Int);
+   ierr = hypre_MPI_Win_allocate_shared(size, sizeof(HYPRE_Int), hypre_MPI_INFO_NULL,
+                                        node_comm, &flags, &shm_comm_pkg -> flag_win);
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_MPI_Win_free(&shm_comm_pkg -> data_win);
+      hypre_TFree(shm_comm_pkg, HYPRE_MEMORY_HOST);
+      hypre_MPI_Comm_free(&node_comm);
+      return hypre_error_flag;
+   }
+   shm_comm_pkg -> flags = flags;
+   shm_comm_pkg -> my_local_id = local_id;
+
+   /*-----------------------------------------------------------------------
+    * Ranks of the node, and the node rank of each of them (-1 otherwise)
+    *-----------------------------------------------------------------------*/
+
+   node_ranks = hypre_TAlloc(HYPRE_Int, local_size, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&my_id, 1, HYPRE_MPI_INT, node_ranks, 1, HYPRE_MPI_INT, node_comm);
+   local_of = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (proc = 0; proc < num_procs; proc++)
+   {
+      local_of[proc] = -1;
+   }
+   for (l = 0; l < local_size; l++)
+   {
+      local_of[node_ranks[l]] = l;
+   }
+
+   shm_comm_pkg -> local_sends    = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   shm_comm_pkg -> local_send_ids = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   shm_comm_pkg -> remote_sends   = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      l = local_of[send_procs[i]];
+      if (l >= 0)
+      {
+         k = shm_comm_pkg -> num_local_sends++;
+         shm_comm_pkg -> local_sends[k]    = i;
+         shm_comm_pkg -> local_send_ids[k] = l;
+      }
+      else
+      {
+         shm_comm_pkg -> remote_sends[shm_comm_pkg -> num_remote_sends++] = i;
+      }
+   }
+
+   shm_comm_pkg -> local_recvs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   shm_comm_pkg -> remote_recvs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   shm_comm_pkg -> recv_segments = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+   shm_comm_pkg -> recv_flags = hypre_TAlloc(volatile HYPRE_Int *, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      if (local_of[recv_procs[i]] >= 0)
+      {
+         shm_comm_pkg -> local_recvs[shm_comm_pkg -> num_local_recvs++] = i;
+      }
+      else
+      {
+         shm_comm_pkg -> remote_recvs[shm_comm_pkg -> num_remote_recvs++] = i;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Senders tell their on-node receivers where their segments start
+    *-----------------------------------------------------------------------*/
+
+   offsets  = hypre_TAlloc(HYPRE_Int, shm_comm_pkg -> num_local_recvs, HYPRE_MEMORY_HOST);
+   requests = hypre_CTAlloc(hypre_MPI_Request,
+                            shm_comm_pkg -> num_local_sends + shm_comm_pkg -> num_local_recvs,
+                            HYPRE_MEMORY_HOST);
+   num_requests = 0;
+   for (k = 0; k < shm_comm_pkg -> num_local_recvs; k++)
+   {
+      l = local_of[recv_procs[shm_comm_pkg -> local_recvs[k]]];
+      hypre_MPI_Irecv(&offsets[k], 1, HYPRE_MPI_INT, l, 0, node_comm, &requests[num_requests++]);
+   }
+   for (k = 0; k < shm_comm_pkg -> num_local_sends; k++)
+   {
+      i = shm_comm_pkg -> local_sends[k];
+      hypre_MPI_Isend(&send_map_starts[i], 1, HYPRE_MPI_INT, shm_comm_pkg -> local_send_ids[k],
+                      0, node_comm, &requests[num_requests++]);
+   }
+   hypre_MPI_Waitall(num_requests, requests, hypre_MPI_STATUSES_IGNORE);
+
+   for (k = 0; k < shm_comm_pkg -> num_local_recvs; k++)
+   {
+      l = local_of[recv_procs[shm_comm_pkg -> local_recvs[k]]];
+      hypre_MPI_Win_shared_query(shm_comm_pkg -> data_win, l, &size, &disp_unit, &base);
+      hypre_MPI_Win_shared_query(shm_comm_pkg -> flag_win, l, &size, &disp_unit, &sender_flags);
+      shm_comm_pkg -> recv_segments[k] = base + offsets[k];
+      shm_comm_pkg -> recv_flags[k]    = sender_flags;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Passive target epochs for the whole life of the windows; the flags
+    * must be zero on all ranks of the node before anyone reads them
+    *-----------------------------------------------------------------------*/
+
+   hypre_MPI_Win_lock_all(hypre_MPI_MODE_NOCHECK, shm_comm_pkg -> data_win);
+   hypre_MPI_Win_lock_all(hypre_MPI_MODE_NOCHECK, shm_comm_pkg -> flag_win);
+   for (l = 0; l <= local_size; l++)
+   {
+      shm_comm_pkg -> flags[l] = 0;
+   }
+   hypre_MPI_Win_sync(shm_comm_pkg -> flag_win);
+   hypre_MPI_Barrier(node_comm);
+   hypre_MPI_Win_sync(shm_comm_pkg -> flag_win);
+
+   hypre_ParCSRCommPkgShmCommPkg(comm_pkg) = shm_comm_pkg;
+
+   hypre_TFree(node_ranks, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_of, HYPRE_MEMORY_HOST);
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_MPI_Comm_free(&node_comm);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyShmComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRShmCommPkg *shm_comm_pkg = hypre_ParCSRCommPkgShmCommPkg(comm_pkg);
+
+   if (!shm_comm_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Win_unlock_all(shm_comm_pkg -> data_win);
+   hypre_MPI_Win_unlock_all(shm_comm_pkg -> flag_win);
+   hypre_MPI_Win_free(&shm_comm_pkg -> data_win);
+   hypre_MPI_Win_free(&shm_comm_pkg -> flag_win);
+
+   hypre_TFree(shm_comm_pkg -> local_sends, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg -> local_send_ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg -> remote_sends, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg -> local_recvs, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg -> remote_recvs, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg -> recv_segments, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg -> recv_flags, HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_comm_pkg, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgShmCommPkg(comm_pkg) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixShmCommSetup
+ *
+ * Creates the shared memory plan for the comm_pkg of A, creating the
+ * comm_pkg if needed.  Collective on the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixShmCommSetup( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   hypre_ParCSRCommPkgCreateShmComm(hypre_ParCSRMatrixCommPkg(A));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgShmSendBuffer
+ *
+ * The send buffer in the shared memory window of comm_pkg (send_map_starts
+ * layout), or NULL if comm_pkg has no shared memory plan or an exchange of it
+ * is in progress.  Data packed into it is exchanged without a copy by the
+ * next job 1 exchange of comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Complex *
+hypre_ParCSRCommPkgShmSendBuffer( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRShmCommPkg *shm_comm_pkg;
+
+   if (!comm_pkg)
+   {
+      return NULL;
+   }
+
+   shm_comm_pkg = hypre_ParCSRCommPkgShmCommPkg(comm_pkg);
+   if (!shm_comm_pkg || shm_comm_pkg -> busy)
+   {
+      return NULL;
+   }
+
+   return shm_comm_pkg -> send_buffer;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommStart, hypre_ParCSRShmCommFinish
+ *
+ * Shared memory job 1 exchange on host data, used by
+ * hypre_ParCSRCommHandleCreate_v2 and hypre_ParCSRCommHandleDestroy.  Start
+ * publishes the on-node segments (copying them into the window unless
+ * send_data is the window buffer) and posts the messages to and from the
+ * other nodes, receives first; Finish completes them, reads the on-node
+ * segments and waits until the on-node receivers have read this rank's.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRShmCommStart( hypre_ParCSRCommPkg  *comm_pkg,
+                          HYPRE_Complex        *send_data,
+                          HYPRE_Complex        *recv_data,
+                          HYPRE_Int            *num_requests_ptr,
+                          hypre_MPI_Request   **requests_ptr )
+{
+   MPI_Comm                comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int              *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int              *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   hypre_ParCSRShmCommPkg *shm_comm_pkg    = hypre_ParCSRCommPkgShmCommPkg(comm_pkg);
+   HYPRE_Complex          *send_buffer     = shm_comm_pkg -> send_buffer;
+   hypre_MPI_Request      *requests;
+   HYPRE_Int               num_requests;
+   HYPRE_Int               i, j, k, ip, vec_start, vec_len;
+
+   shm_comm_pkg -> busy = 1;
+   shm_comm_pkg -> epoch++;
+
+   if (send_data != send_buffer)
+   {
+      for (k = 0; k < shm_comm_pkg -> num_local_sends; k++)
+      {
+         i = shm_comm_pkg -> local_sends[k];
+         hypre_TMemcpy(&send_buffer[send_map_starts[i]], &send_data[send_map_starts[i]],
+                       HYPRE_Complex, send_map_starts[i+1] - send_map_starts[i],
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_MPI_Win_sync(shm_comm_pkg -> data_win);
+   shm_comm_pkg -> flags[0] = shm_comm_pkg -> epoch;
+   hypre_MPI_Win_sync(shm_comm_pkg -> flag_win);
+
+   num_requests = shm_comm_pkg -> num_remote_sends + shm_comm_pkg -> num_remote_recvs;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (k = 0; k < shm_comm_pkg -> num_remote_recvs; k++)
+   {
+      i = shm_comm_pkg -> remote_recvs[k];
+      ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+      vec_start = recv_vec_starts[i];
+      vec_len = recv_vec_starts[i+1] - vec_start;
+      hypre_MPI_Irecv(&recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+   for (k = 0; k < shm_comm_pkg -> num_remote_sends; k++)
+   {
+      i = shm_comm_pkg -> remote_sends[k];
+      ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+      vec_start = send_map_starts[i];
+      vec_len = send_map_starts[i+1] - vec_start;
+      hypre_MPI_Isend(&send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+
+   *num_requests_ptr = num_requests;
+   *requests_ptr     = requests;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRShmCommFinish( hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_ParCSRCommPkg    *comm_pkg        = hypre_ParCSRCommHandleCommPkg(comm_handle);
+   MPI_Comm                comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int              *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   hypre_ParCSRShmCommPkg *shm_comm_pkg    = hypre_ParCSRCommPkgShmCommPkg(comm_pkg);
+   HYPRE_Complex          *recv_data       = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+   HYPRE_Int               epoch           = shm_comm_pkg -> epoch;
+   HYPRE_Int               my_local_id     = shm_comm_pkg -> my_local_id;
+   HYPRE_Int               i, k, l;
+
+   hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                     hypre_ParCSRCommHandleRequests(comm_handle), hypre_MPI_STATUSES_IGNORE);
+
+   /* read the on-node segments and acknowledge them */
+   for (k = 0; k < shm_comm_pkg -> num_local_recvs; k++)
+   {
+      i = shm_comm_pkg -> local_recvs[k];
+      hypre_ParCSRShmCommSpin(shm_comm_pkg, comm, &shm_comm_pkg -> recv_flags[k][0], epoch);
+      hypre_MPI_Win_sync(shm_comm_pkg -> data_win);
+      hypre_TMemcpy(&recv_data[recv_vec_starts[i]], shm_comm_pkg -> recv_segments[k],
+                    HYPRE_Complex, recv_vec_starts[i+1] - recv_vec_starts[i],
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      shm_comm_pkg -> recv_flags[k][1 + my_local_id] = epoch;
+   }
+   hypre_MPI_Win_sync(shm_comm_pkg -> flag_win);
+
+   /* the send buffer is free once the on-node receivers have read it */
+   for (k = 0; k < shm_comm_pkg -> num_local_sends; k++)
+   {
+      l = shm_comm_pkg -> local_send_ids[k];
+      hypre_ParCSRShmCommSpin(shm_comm_pkg, comm, &shm_comm_pkg -> flags[1 + l], epoch);
+   }
+
+   shm_comm_pkg -> busy = 0;
+   hypre_ParCSRCommHandleShmComm(comm_handle) = 0;
+
+   return hypre_error_flag;
+}
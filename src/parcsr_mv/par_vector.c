@@ -121,6 +121,40 @@ hypre_ParVectorDestroy( hypre_ParVector *vector )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMemorySize
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParVectorMemorySize( hypre_ParVector *vector )
+{
+   size_t    size;
+   HYPRE_Int num_starts;
+
+   if (!vector)
+   {
+      return 0;
+   }
+
+   size = sizeof(hypre_ParVector);
+   if ( hypre_ParVectorOwnsData(vector) )
+   {
+      size += hypre_SeqVectorMemorySize(hypre_ParVectorLocalVector(vector));
+   }
+   if ( hypre_ParVectorOwnsPartitioning(vector) )
+   {
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+      num_starts = 2;
+#else
+      hypre_MPI_Comm_size(hypre_ParVectorComm(vector), &num_starts);
+      num_starts++;
+#endif
+      size += sizeof(HYPRE_BigInt) * num_starts;
+   }
+
+   return size;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorInitialize
  *--------------------------------------------------------------------------*/
@@ -500,6 +534,74 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpyNorm
+ *
+ * y = y + alpha*x, returning <y,y> of the updated y.  Saves one pass over
+ * y compared to hypre_ParVectorAxpy followed by hypre_ParVectorInnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorAxpyNorm( HYPRE_Complex    alpha,
+                         hypre_ParVector *x,
+                         hypre_ParVector *y )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(y);
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   HYPRE_Real result = 0.0;
+   HYPRE_Real local_result = hypre_SeqVectorAxpyNorm(alpha, x_local, y_local);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_result, &result, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMultiInnerProdInit
+ *
+ * Computes the local parts of the nprod inner products <x[k],y[k]> into
+ * local_result and starts their global sum into result.  The sum completes
+ * with hypre_MPI_Wait on request; both arrays must stay valid until then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMultiInnerProdInit( HYPRE_Int           nprod,
+                                   hypre_ParVector   **x,
+                                   hypre_ParVector   **y,
+                                   HYPRE_Real         *local_result,
+                                   HYPRE_Real         *result,
+                                   hypre_MPI_Request  *request )
+{
+   MPI_Comm   comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Int  k;
+
+   for (k = 0; k < nprod; k++)
+   {
+      local_result[k] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[k]),
+                                                 hypre_ParVectorLocalVector(y[k]));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Iallreduce(local_result, result, nprod, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -489,7 +489,14 @@ hypre_CSRMatrixMultiply( hypre_CSRMatrix *A,
    else
 #endif
    {
-      C = hypre_CSRMatrixMultiplyHost(A,B);
+      if (hypre_HandleSpgemmHostAlgorithm(hypre_handle()) == 1)
+      {
+         C = hypre_CSRMatrixMultiplyHostAdaptive(A,B);
+      }
+      else
+      {
+         C = hypre_CSRMatrixMultiplyHost(A,B);
+      }
    }
 
    return C;
@@ -35,6 +35,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixJ(matrix)              = NULL;
    hypre_CSRMatrixBigJ(matrix)           = NULL;
    hypre_CSRMatrixRownnz(matrix)         = NULL;
+   hypre_CSRMatrixSell(matrix)           = NULL;
+   hypre_CSRMatrixDataFloat(matrix)      = NULL;
    hypre_CSRMatrixNumRows(matrix)        = num_rows;
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
@@ -62,6 +64,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_SELLMatrixDestroy(hypre_CSRMatrixSell(matrix));
+      hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -76,6 +80,59 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMemorySize
+ *
+ * Bytes held by the matrix, including the SELL and single precision copies.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_CSRMatrixMemorySize( hypre_CSRMatrix *matrix )
+{
+   size_t    size;
+   size_t    num_nonzeros;
+
+   if (!matrix)
+   {
+      return 0;
+   }
+
+   num_nonzeros = (size_t) hypre_CSRMatrixNumNonzeros(matrix);
+
+   size = sizeof(hypre_CSRMatrix);
+   if (hypre_CSRMatrixI(matrix))
+   {
+      size += sizeof(HYPRE_Int) * (hypre_CSRMatrixNumRows(matrix) + 1);
+   }
+   if (hypre_CSRMatrixRownnz(matrix))
+   {
+      size += sizeof(HYPRE_Int) * hypre_CSRMatrixNumRownnz(matrix);
+   }
+   if (hypre_CSRMatrixDataFloat(matrix))
+   {
+      size += sizeof(hypre_float) * num_nonzeros;
+   }
+   size += hypre_SELLMatrixMemorySize(hypre_CSRMatrixSell(matrix));
+
+   if ( hypre_CSRMatrixOwnsData(matrix) )
+   {
+      if (hypre_CSRMatrixJ(matrix))
+      {
+         size += sizeof(HYPRE_Int) * num_nonzeros;
+      }
+      if (hypre_CSRMatrixBigJ(matrix))
+      {
+         size += sizeof(HYPRE_BigInt) * num_nonzeros;
+      }
+      if (hypre_CSRMatrixData(matrix))
+      {
+         size += sizeof(HYPRE_Complex) * num_nonzeros;
+      }
+   }
+
+   return size;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixInitialize
  *--------------------------------------------------------------------------*/
@@ -285,6 +342,112 @@ hypre_CSRMatrixSetRownnz( hypre_CSRMatrix *matrix )
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSELL
+ *
+ * Builds (or rebuilds) the SELL-C-sigma copy of a host matrix that is then
+ * used by hypre_CSRMatrixMatvec and hypre_CSRMatrixMatvecT.  The copy is not
+ * updated automatically: it must be rebuilt after the values or the
+ * sparsity pattern of the matrix change.  A chunk_size < 0 removes it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSELL( hypre_CSRMatrix *matrix,
+                        HYPRE_Int        chunk_size,
+                        HYPRE_Int        sigma )
+{
+   hypre_SELLMatrixDestroy(hypre_CSRMatrixSell(matrix));
+   hypre_CSRMatrixSell(matrix) = NULL;
+
+   if (chunk_size < 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "SELL storage is only available for host matrices\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixDataFloat(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "SELL storage is not available with single precision values\n");
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSell(matrix) = hypre_SELLMatrixCreate(matrix, chunk_size, sigma);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetDataFloat
+ *
+ * Stores a single precision copy of the values of a host matrix.  The host
+ * matvecs (and the BoomerAMG relaxations that support it) then read the
+ * single precision values and accumulate in HYPRE_Complex.  If keep_data is
+ * zero, the original values are freed and `data' is set to NULL, so any
+ * other routine that needs the values can no longer be applied to it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetDataFloat( hypre_CSRMatrix *matrix,
+                             HYPRE_Int        keep_data )
+{
+   HYPRE_Complex *data         = hypre_CSRMatrixData(matrix);
+   HYPRE_Int      num_nonzeros = hypre_CSRMatrixNumNonzeros(matrix);
+   hypre_float   *data_float;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision values are not available for complex matrices\n");
+   return hypre_error_flag;
+#endif
+
+   if (hypre_CSRMatrixDataFloat(matrix))
+   {
+      /* already converted */
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision values are only available for host matrices\n");
+      return hypre_error_flag;
+   }
+
+   if (!data && num_nonzeros)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   data_float = hypre_TAlloc(hypre_float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data_float[i] = (hypre_float) data[i];
+   }
+
+   hypre_CSRMatrixDataFloat(matrix) = data_float;
+
+   /* the SELL copy holds the original values */
+   hypre_SELLMatrixDestroy(hypre_CSRMatrixSell(matrix));
+   hypre_CSRMatrixSell(matrix) = NULL;
+
+   if (!keep_data && hypre_CSRMatrixOwnsData(matrix))
+   {
+      hypre_TFree(hypre_CSRMatrixData(matrix), hypre_CSRMatrixMemoryLocation(matrix));
+      hypre_CSRMatrixData(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
 /* check if numnonzeros was properly set to be ia[nrow] */
 HYPRE_Int
 hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix )
@@ -18,6 +18,52 @@
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) companion storage for the CSR Matrix
+ *
+ * Rows are grouped into chunks of C = chunk_size rows.  Within a window of
+ * sigma consecutive rows, rows are sorted by decreasing length before being
+ * chunked, so that padding is small.  Each chunk is stored column-major with
+ * all rows padded to the longest row of the chunk: entry k of slot r of
+ * chunk c is at [chunk_ptr[c] + k*C + r].  Padding uses zero values and a
+ * valid column index, so the kernels need no masking.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_DEFAULT_CHUNK_SIZE 8
+#define HYPRE_SELL_DEFAULT_SIGMA      128
+#define HYPRE_SELL_MAX_CHUNK_SIZE     32
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_cols;
+   HYPRE_Int      chunk_size;
+   HYPRE_Int      sigma;
+   HYPRE_Int      num_chunks;
+
+   HYPRE_Int     *chunk_ptr;   /* size num_chunks+1 */
+   HYPRE_Int     *chunk_len;   /* size num_chunks */
+   HYPRE_Int     *perm;        /* slot -> row, size num_rows */
+   HYPRE_Int     *j;
+   HYPRE_Complex *data;
+
+} hypre_SELLMatrix;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the SELL Matrix structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SELLMatrixNumRows(matrix)     ((matrix) -> num_rows)
+#define hypre_SELLMatrixNumCols(matrix)     ((matrix) -> num_cols)
+#define hypre_SELLMatrixChunkSize(matrix)   ((matrix) -> chunk_size)
+#define hypre_SELLMatrixSigma(matrix)       ((matrix) -> sigma)
+#define hypre_SELLMatrixNumChunks(matrix)   ((matrix) -> num_chunks)
+#define hypre_SELLMatrixChunkPtr(matrix)    ((matrix) -> chunk_ptr)
+#define hypre_SELLMatrixChunkLen(matrix)    ((matrix) -> chunk_len)
+#define hypre_SELLMatrixPerm(matrix)        ((matrix) -> perm)
+#define hypre_SELLMatrixJ(matrix)           ((matrix) -> j)
+#define hypre_SELLMatrixData(matrix)        ((matrix) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -42,6 +88,12 @@ typedef struct
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
 
+   /* optional SELL-C-sigma copy used by the host matvec kernels */
+   hypre_SELLMatrix *sell;
+
+   /* optional single precision values; used instead of `data' when set */
+   hypre_float   *data_float;
+
 } hypre_CSRMatrix;
 
 /*--------------------------------------------------------------------------
@@ -58,6 +110,8 @@ typedef struct
 #define hypre_CSRMatrixRownnz(matrix)       ((matrix) -> rownnz)
 #define hypre_CSRMatrixNumRownnz(matrix)    ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)     ((matrix) -> owns_data)
+#define hypre_CSRMatrixSell(matrix)         ((matrix) -> sell)
+#define hypre_CSRMatrixDataFloat(matrix)    ((matrix) -> data_float)
 
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
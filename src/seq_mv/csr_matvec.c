@@ -13,6 +13,211 @@
 
 #include "seq_mv.h"
 
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+
+/* largest number of vectors handled by one pass of the multivector kernels */
+#define HYPRE_CSR_SPMM_MAX_BLOCK 8
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMBlock
+ *
+ * y = alpha*A*x + beta*b for a block of K vectors.  Every row of A is read
+ * once and the K partial sums are kept in registers.  The kernel is inlined
+ * with K = 1, 2, 4 or 8 so the loops over K are fully unrolled.  For row-wise
+ * (interleaved) multivectors, idxstride = num_vectors and vecstride = 1, the
+ * K entries of x loaded for each column are contiguous.  b must have the
+ * same layout as y.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixSpMMBlock( const HYPRE_Int  K,
+                          HYPRE_Int        num_rows,
+                          HYPRE_Int       *A_i,
+                          HYPRE_Int       *A_j,
+                          HYPRE_Complex   *A_data,
+                          HYPRE_Complex    alpha,
+                          HYPRE_Complex   *x_data,
+                          HYPRE_Int        idxstride_x,
+                          HYPRE_Int        vecstride_x,
+                          HYPRE_Complex    beta,
+                          HYPRE_Complex   *b_data,
+                          HYPRE_Complex   *y_data,
+                          HYPRE_Int        idxstride_y,
+                          HYPRE_Int        vecstride_y )
+{
+   HYPRE_Int      i, jj, k, m;
+   HYPRE_Complex *x_col;
+   HYPRE_Complex  a, sum[HYPRE_CSR_SPMM_MAX_BLOCK];
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,k,m,a,x_col,sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = 0; k < K; k++)
+      {
+         sum[k] = 0.0;
+      }
+      if (vecstride_x == 1)
+      {
+         /* row-wise storage: contiguous loads */
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            a = A_data[jj];
+            x_col = x_data + A_j[jj]*idxstride_x;
+            for (k = 0; k < K; k++)
+            {
+               sum[k] += a * x_col[k];
+            }
+         }
+      }
+      else
+      {
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            a = A_data[jj];
+            x_col = x_data + A_j[jj]*idxstride_x;
+            for (k = 0; k < K; k++)
+            {
+               sum[k] += a * x_col[k*vecstride_x];
+            }
+         }
+      }
+      for (k = 0; k < K; k++)
+      {
+         m = i*idxstride_y + k*vecstride_y;
+         y_data[m] = beta == 0.0 ? alpha*sum[k] : alpha*sum[k] + beta*b_data[m];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMTBlock
+ *
+ * y += A^T*x for a block of K vectors.  The K entries of row i of x are
+ * loaded once and scattered with every entry of row i of A.  Not threaded,
+ * like the other multivector MatvecT paths.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixSpMMTBlock( const HYPRE_Int  K,
+                           HYPRE_Int        num_rows,
+                           HYPRE_Int       *A_i,
+                           HYPRE_Int       *A_j,
+                           HYPRE_Complex   *A_data,
+                           HYPRE_Complex   *x_data,
+                           HYPRE_Int        idxstride_x,
+                           HYPRE_Int        vecstride_x,
+                           HYPRE_Complex   *y_data,
+                           HYPRE_Int        idxstride_y,
+                           HYPRE_Int        vecstride_y )
+{
+   HYPRE_Int      i, jj, k;
+   HYPRE_Complex *y_col;
+   HYPRE_Complex  a, x_row[HYPRE_CSR_SPMM_MAX_BLOCK];
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = 0; k < K; k++)
+      {
+         x_row[k] = x_data[i*idxstride_x + k*vecstride_x];
+      }
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         a = A_data[jj];
+         y_col = y_data + A_j[jj]*idxstride_y;
+         for (k = 0; k < K; k++)
+         {
+            y_col[k*vecstride_y] += a * x_row[k];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMM
+ *
+ * Multivector driver for the two kernels above: the vectors are processed
+ * in blocks of 8, 4, 2 and 1 (transpose = 0: y = alpha*A*x + beta*b,
+ * transpose = 1: y += A^T*x).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixSpMM( HYPRE_Int        transpose,
+                     HYPRE_Int        num_vectors,
+                     HYPRE_Int        num_rows,
+                     HYPRE_Int       *A_i,
+                     HYPRE_Int       *A_j,
+                     HYPRE_Complex   *A_data,
+                     HYPRE_Complex    alpha,
+                     HYPRE_Complex   *x_data,
+                     HYPRE_Int        idxstride_x,
+                     HYPRE_Int        vecstride_x,
+                     HYPRE_Complex    beta,
+                     HYPRE_Complex   *b_data,
+                     HYPRE_Complex   *y_data,
+                     HYPRE_Int        idxstride_y,
+                     HYPRE_Int        vecstride_y )
+{
+   HYPRE_Int      v, nb;
+   HYPRE_Complex *xv, *bv, *yv;
+
+   for (v = 0; v < num_vectors; v += nb)
+   {
+      nb = num_vectors - v;
+      nb = nb >= 8 ? 8 : (nb >= 4 ? 4 : (nb >= 2 ? 2 : 1));
+
+      xv = x_data + v*vecstride_x;
+      bv = b_data ? b_data + v*vecstride_y : NULL;
+      yv = y_data + v*vecstride_y;
+
+      if (transpose)
+      {
+         switch (nb)
+         {
+            case 8:
+               hypre_CSRMatrixSpMMTBlock(8, num_rows, A_i, A_j, A_data, xv, idxstride_x,
+                                         vecstride_x, yv, idxstride_y, vecstride_y);
+               break;
+            case 4:
+               hypre_CSRMatrixSpMMTBlock(4, num_rows, A_i, A_j, A_data, xv, idxstride_x,
+                                         vecstride_x, yv, idxstride_y, vecstride_y);
+               break;
+            case 2:
+               hypre_CSRMatrixSpMMTBlock(2, num_rows, A_i, A_j, A_data, xv, idxstride_x,
+                                         vecstride_x, yv, idxstride_y, vecstride_y);
+               break;
+            default:
+               hypre_CSRMatrixSpMMTBlock(1, num_rows, A_i, A_j, A_data, xv, idxstride_x,
+                                         vecstride_x, yv, idxstride_y, vecstride_y);
+         }
+      }
+      else
+      {
+         switch (nb)
+         {
+            case 8:
+               hypre_CSRMatrixSpMMBlock(8, num_rows, A_i, A_j, A_data, alpha, xv, idxstride_x,
+                                        vecstride_x, beta, bv, yv, idxstride_y, vecstride_y);
+               break;
+            case 4:
+               hypre_CSRMatrixSpMMBlock(4, num_rows, A_i, A_j, A_data, alpha, xv, idxstride_x,
+                                        vecstride_x, beta, bv, yv, idxstride_y, vecstride_y);
+               break;
+            case 2:
+               hypre_CSRMatrixSpMMBlock(2, num_rows, A_i, A_j, A_data, alpha, xv, idxstride_x,
+                                        vecstride_x, beta, bv, yv, idxstride_y, vecstride_y);
+               break;
+            default:
+               hypre_CSRMatrixSpMMBlock(1, num_rows, A_i, A_j, A_data, alpha, xv, idxstride_x,
+                                        vecstride_x, beta, bv, yv, idxstride_y, vecstride_y);
+         }
+      }
+   }
+}
+
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -122,9 +327,49 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
 
    temp = beta / alpha;
 
+   /* use the SELL-C-sigma copy of A if it has been built */
+
+   if (hypre_CSRMatrixSell(A) && offset == 0 && num_vectors == 1)
+   {
+      hypre_SELLMatrixMatvec(alpha, hypre_CSRMatrixSell(A), x_data, beta, b_data, y_data);
+   }
+
+   /* single precision values, accumulated in HYPRE_Complex */
+
+   else if (hypre_CSRMatrixDataFloat(A))
+   {
+      hypre_float *A_data_float = hypre_CSRMatrixDataFloat(A);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = 0; j < num_vectors; j++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               tempx += (HYPRE_Complex) A_data_float[jj] * x_data[ j*vecstride_x + A_j[jj]*idxstride_x ];
+            }
+            m = j*vecstride_y + i*idxstride_y;
+            y_data[m] = beta == 0.0 ? alpha*tempx : alpha*tempx + beta*b_data[m];
+         }
+      }
+   }
+
+   /* multivectors: register-blocked kernel, A is read once per block of vectors */
+
+   else if (num_vectors > 1 && num_rownnz >= xpar*(num_rows))
+   {
+      hypre_CSRMatrixSpMM(0, num_vectors, num_rows, A_i, A_j, A_data, alpha,
+                          x_data, idxstride_x, vecstride_x, beta, b_data,
+                          y_data, idxstride_y, vecstride_y);
+   }
+
    /* use rownnz pointer to do the A*x multiplication  when num_rownnz is smaller than num_rows */
 
-   if (num_rownnz < xpar*(num_rows) || num_vectors > 1)
+   else if (num_rownnz < xpar*(num_rows) || num_vectors > 1)
    {
       /*-----------------------------------------------------------------------
        * y = (beta/alpha)*y
@@ -542,7 +787,76 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
    num_threads = hypre_NumThreads();
-   if (num_threads > 1)
+   if (hypre_CSRMatrixSell(A) && num_vectors == 1)
+   {
+      /* use the SELL-C-sigma copy of A if it has been built */
+      hypre_SELLMatrixMatvecT(hypre_CSRMatrixSell(A), x_data, y_data);
+   }
+   else if (hypre_CSRMatrixDataFloat(A))
+   {
+      /* single precision values, accumulated in HYPRE_Complex */
+      hypre_float *A_data_float = hypre_CSRMatrixDataFloat(A);
+
+      if (num_threads > 1 && num_vectors == 1)
+      {
+         y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj,j,my_thread_num,offset)
+#endif
+         {
+            my_thread_num = hypre_GetThreadNum();
+            offset = y_size*my_thread_num;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < num_rows; i++)
+            {
+               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+               {
+                  y_data_expand[offset + A_j[jj]] += (HYPRE_Complex) A_data_float[jj] * x_data[i];
+               }
+            }
+
+            /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < y_size; i++)
+            {
+               for (j = 0; j < num_threads; j++)
+               {
+                  y_data[i] += y_data_expand[j*y_size + i];
+               }
+            }
+         } /* end parallel threaded region */
+
+         hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            for (jv = 0; jv < num_vectors; ++jv)
+            {
+               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+               {
+                  j = A_j[jj];
+                  y_data[ j*idxstride_y + jv*vecstride_y ] +=
+                     (HYPRE_Complex) A_data_float[jj] * x_data[ i*idxstride_x + jv*vecstride_x ];
+               }
+            }
+         }
+      }
+   }
+   else if (num_vectors > 1)
+   {
+      /* multivectors: register-blocked kernel, A is read once per block of vectors */
+      hypre_CSRMatrixSpMM(1, num_vectors, num_rows, A_i, A_j, A_data, 1.0,
+                          x_data, idxstride_x, vecstride_x, 0.0, NULL,
+                          y_data, idxstride_y, vecstride_y);
+   }
+   else if (num_threads > 1)
    {
       y_data_expand = hypre_CTAlloc(HYPRE_Complex,  num_threads*y_size, HYPRE_MEMORY_HOST);
 
@@ -0,0 +1,626 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Row-blocked host SpGEMM with size-adaptive accumulators.
+ *
+ * Each row of C = A*B gets an upper bound on its length (the sum of the
+ * lengths of the rows of B it touches) and the range of columns it can hit.
+ * The rows are split into contiguous blocks of equal total bound, one per
+ * thread, and every row is formed with the cheapest accumulator for it:
+ *
+ *    short   rows: a linear scan over the entries formed so far,
+ *    compact rows: a dense marker, which only covers the columns that the
+ *                  compact rows of the thread can hit,
+ *    other   rows: an open addressing hash table sized for the row.
+ *
+ * So no thread needs a marker over all columns of B, which does not fit in
+ * cache for large B, unless its own rows reach all of them.  C is formed in
+ * two passes (count, then fill) with the thread offsets taken from
+ * hypre_prefix_sum.  C_i, C_j and C_data are first written by the thread that
+ * owns the rows, so that their pages end up local to that thread.
+ *
+ * The entries of a row are stored in the same order as in
+ * hypre_CSRMatrixMultiplyHost (first occurrence, the diagonal first if A*B is
+ * square) and are summed in the same order, so the two kernels give
+ * identical results.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* rows whose bound is at most this use the linear scan */
+#define HYPRE_SPGEMM_SHORT_ROW     32
+
+/* the dense marker of a thread is used for all rows that are not short if
+ * it covers at most this many columns */
+#define HYPRE_SPGEMM_DENSE_WINDOW  (1 << 20)
+
+/* otherwise, it is used for the rows whose column range is at most
+ * HYPRE_SPGEMM_DENSE_SPAN, or at most HYPRE_SPGEMM_DENSE_RATIO times their
+ * bound, and the other rows use a hash table */
+#define HYPRE_SPGEMM_DENSE_SPAN    65536
+#define HYPRE_SPGEMM_DENSE_RATIO   8
+
+#define HYPRE_SPGEMM_SHORT  0
+#define HYPRE_SPGEMM_DENSE  1
+#define HYPRE_SPGEMM_HASH   2
+
+/* multiplicative hash; the high half of the product is folded into the low
+ * bits so that columns with a common stride do not collide */
+static inline HYPRE_Int
+hypre_SpGemmHash( HYPRE_Int col,
+                  HYPRE_Int mask )
+{
+   hypre_uint h = (hypre_uint) col * 2654435761u;
+
+   return (HYPRE_Int) ((h ^ (h >> 16)) & (hypre_uint) mask);
+}
+
+/* rows of the b-th of num_blocks static blocks */
+static void
+hypre_SpGemmBlock( HYPRE_Int  nrows,
+                   HYPRE_Int  num_blocks,
+                   HYPRE_Int  b,
+                   HYPRE_Int *ns_ptr,
+                   HYPRE_Int *ne_ptr )
+{
+   HYPRE_Int size = nrows / num_blocks;
+   HYPRE_Int rest = nrows - size * num_blocks;
+
+   *ns_ptr = b * size + hypre_min(b, rest);
+   *ne_ptr = (b + 1) * size + hypre_min(b + 1, rest);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SpGemmRowSplit
+ *
+ * Returns the first row r such that the bounds of the rows before r add up
+ * to at least t/num_threads of the total.  block_work[b+1] holds the sum of
+ * the bounds over the b-th static block of rows.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SpGemmRowSplit( HYPRE_Int   t,
+                      HYPRE_Int   num_threads,
+                      HYPRE_Int   nrows,
+                      HYPRE_Int  *row_bound,
+                      HYPRE_Real *block_work )
+{
+   HYPRE_Real target, work;
+   HYPRE_Int  b, r, ns, ne;
+
+   if (t == 0)
+   {
+      return 0;
+   }
+   if (t == num_threads)
+   {
+      return nrows;
+   }
+
+   target = block_work[num_threads] * t / num_threads;
+   for (b = 0; b < num_threads - 1 && block_work[b+1] < target; b++);
+
+   hypre_SpGemmBlock(nrows, num_threads, b, &ns, &ne);
+   work = block_work[b];
+   for (r = ns; r < ne && work < target; r++)
+   {
+      work += row_bound[r];
+   }
+
+   return r;
+}
+
+/* smallest power of two that is at least twice the bound */
+static HYPRE_Int
+hypre_SpGemmHashSize( HYPRE_Int bound )
+{
+   HYPRE_Int size = 2 * HYPRE_SPGEMM_SHORT_ROW;
+
+   while (size < 2 * bound)
+   {
+      size *= 2;
+   }
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostAdaptive
+ *
+ * Same interface and result as hypre_CSRMatrixMultiplyHost.  Selected by
+ * HYPRE_SetSpGemmHostAlgorithm (it is the default).
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHostAdaptive( hypre_CSRMatrix *A,
+                                     hypre_CSRMatrix *B )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         ncols_A  = hypre_CSRMatrixNumCols(A);
+   HYPRE_Complex    *B_data   = hypre_CSRMatrixData(B);
+   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
+   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
+   HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   hypre_CSRMatrix  *C;
+   HYPRE_Complex    *C_data = NULL;
+   HYPRE_Int        *C_i;
+   HYPRE_Int        *C_j = NULL;
+
+   HYPRE_Int         allsquare = 0;
+   HYPRE_Int         max_num_threads;
+   HYPRE_Int         wide;
+   HYPRE_Int        *B_first = NULL, *B_last = NULL;
+   HYPRE_Int        *row_first = NULL, *row_last = NULL;
+   HYPRE_Int        *row_bound;
+   char             *row_kind;
+   HYPRE_Int        *prefix_work;
+   HYPRE_Real       *block_work;
+
+   HYPRE_MemoryLocation memory_location_C =
+      hypre_max(hypre_CSRMatrixMemoryLocation(A), hypre_CSRMatrixMemoryLocation(B));
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if (nrows_A == ncols_B)
+   {
+      allsquare = 1;
+   }
+
+   /* with few columns, the dense marker is used for all rows that are not
+    * short, and the column ranges are not needed */
+   wide = ncols_B > HYPRE_SPGEMM_DENSE_WINDOW;
+
+   max_num_threads = hypre_NumThreads();
+
+   if (wide)
+   {
+      B_first   = hypre_TAlloc(HYPRE_Int, nrows_B, HYPRE_MEMORY_HOST);
+      B_last    = hypre_TAlloc(HYPRE_Int, nrows_B, HYPRE_MEMORY_HOST);
+      row_first = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
+      row_last  = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
+   }
+   C_i         = hypre_TAlloc(HYPRE_Int, nrows_A+1, memory_location_C);
+   row_bound   = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
+   row_kind    = hypre_TAlloc(char, nrows_A, HYPRE_MEMORY_HOST);
+   prefix_work = hypre_TAlloc(HYPRE_Int, max_num_threads+1, HYPRE_MEMORY_HOST);
+   block_work  = hypre_CTAlloc(HYPRE_Real, max_num_threads+1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Int     my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int     num_threads = hypre_NumActiveThreads();
+      HYPRE_Int     ia, ib, ic, ja, jb, k, h;
+      HYPRE_Int     ns, ne, bound, first, last, len, mask;
+      HYPRE_Int     row_start, counter, num_nonzeros, total_nonzeros;
+      HYPRE_Int     window_first, window_last, hash_size;
+      HYPRE_Int     short_col[HYPRE_SPGEMM_SHORT_ROW];
+      HYPRE_Int    *marker = NULL;
+      HYPRE_Int    *hash = NULL;
+      HYPRE_Complex a_entry, b_entry;
+      HYPRE_Real    work;
+
+      /*-----------------------------------------------------------------
+       * Column range of each row of B, if some rows may be too wide for
+       * the dense marker
+       *-----------------------------------------------------------------*/
+
+      if (wide)
+      {
+         hypre_SpGemmBlock(nrows_B, num_threads, my_thread_num, &ns, &ne);
+         for (ic = ns; ic < ne; ic++)
+         {
+            first = ncols_B;
+            last  = -1;
+            for (ib = B_i[ic]; ib < B_i[ic+1]; ib++)
+            {
+               first = hypre_min(first, B_j[ib]);
+               last  = hypre_max(last, B_j[ib]);
+            }
+            B_first[ic] = first;
+            B_last[ic]  = last;
+         }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      }
+
+      /*-----------------------------------------------------------------
+       * Bound, column range and accumulator of each row
+       *-----------------------------------------------------------------*/
+
+      hypre_SpGemmBlock(nrows_A, num_threads, my_thread_num, &ns, &ne);
+      work = 0.0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         bound = allsquare;
+         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         {
+            ja = A_j[ia];
+            bound += B_i[ja+1] - B_i[ja];
+         }
+         bound = hypre_min(bound, ncols_B);
+         row_bound[ic] = bound;
+         work += (HYPRE_Real) bound;
+
+         if (bound <= HYPRE_SPGEMM_SHORT_ROW)
+         {
+            row_kind[ic] = HYPRE_SPGEMM_SHORT;
+         }
+         else if (!wide)
+         {
+            row_kind[ic] = HYPRE_SPGEMM_DENSE;
+         }
+         else
+         {
+            first = allsquare ? ic : ncols_B;
+            last  = allsquare ? ic : -1;
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               first = hypre_min(first, B_first[ja]);
+               last  = hypre_max(last, B_last[ja]);
+            }
+            row_first[ic] = first;
+            row_last[ic]  = last;
+            if (last - first < HYPRE_SPGEMM_DENSE_SPAN ||
+                last - first < HYPRE_SPGEMM_DENSE_RATIO * bound)
+            {
+               row_kind[ic] = HYPRE_SPGEMM_DENSE;
+            }
+            else
+            {
+               row_kind[ic] = HYPRE_SPGEMM_HASH;
+            }
+         }
+      }
+      block_work[my_thread_num+1] = work;
+
+      /*-----------------------------------------------------------------
+       * Contiguous row blocks of equal total bound
+       *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#pragma omp master
+#endif
+      {
+         for (k = 0; k < num_threads; k++)
+         {
+            block_work[k+1] += block_work[k];
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      ns = hypre_SpGemmRowSplit(my_thread_num, num_threads, nrows_A,
+                                row_bound, block_work);
+      ne = hypre_SpGemmRowSplit(my_thread_num+1, num_threads, nrows_A,
+                                row_bound, block_work);
+
+      /* columns the marker must cover, and the largest hash table.  If the
+       * marker can cover all columns of the thread, it is used for all rows
+       * that are not short. */
+      window_first = ncols_B;
+      window_last  = -1;
+      first        = ncols_B;
+      last         = -1;
+      hash_size    = 0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         if (row_kind[ic] == HYPRE_SPGEMM_DENSE)
+         {
+            window_first = wide ? hypre_min(window_first, row_first[ic]) : 0;
+            window_last  = wide ? hypre_max(window_last, row_last[ic]) : ncols_B - 1;
+         }
+         else if (row_kind[ic] == HYPRE_SPGEMM_HASH)
+         {
+            first = hypre_min(first, row_first[ic]);
+            last  = hypre_max(last, row_last[ic]);
+            hash_size = hypre_max(hash_size, hypre_SpGemmHashSize(row_bound[ic]));
+         }
+      }
+      if (hash_size &&
+          hypre_max(last, window_last) - hypre_min(first, window_first) < HYPRE_SPGEMM_DENSE_WINDOW)
+      {
+         window_first = hypre_min(first, window_first);
+         window_last  = hypre_max(last, window_last);
+         hash_size    = 0;
+         for (ic = ns; ic < ne; ic++)
+         {
+            if (row_kind[ic] == HYPRE_SPGEMM_HASH)
+            {
+               row_kind[ic] = HYPRE_SPGEMM_DENSE;
+            }
+         }
+      }
+      if (window_last < window_first)
+      {
+         window_first = 0;
+         window_last  = -1;
+      }
+
+      /* marker[k] is for column window_first + k */
+      if (window_last >= window_first)
+      {
+         marker = hypre_TAlloc(HYPRE_Int, window_last - window_first + 1, HYPRE_MEMORY_HOST);
+         for (k = 0; k <= window_last - window_first; k++)
+         {
+            marker[k] = -1;
+         }
+      }
+      /* hash[2*h] is the column in slot h.  hash[2*h+1] is the row that
+       * put it there in pass 1, and its position in C_j in pass 2, so that
+       * the slots of earlier rows are seen as free without clearing them */
+      if (hash_size)
+      {
+         hash = hypre_TAlloc(HYPRE_Int, 2*hash_size, HYPRE_MEMORY_HOST);
+         for (k = 0; k < hash_size; k++)
+         {
+            hash[2*k+1] = -1;
+         }
+      }
+
+      /*-----------------------------------------------------------------
+       * Pass 1: count the entries of each row
+       *-----------------------------------------------------------------*/
+
+      num_nonzeros = 0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         C_i[ic] = num_nonzeros;
+
+         if (row_kind[ic] == HYPRE_SPGEMM_SHORT)
+         {
+            len = 0;
+            if (allsquare)
+            {
+               short_col[len++] = ic;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  for (k = 0; k < len && short_col[k] != jb; k++);
+                  if (k == len)
+                  {
+                     short_col[len++] = jb;
+                  }
+               }
+            }
+            num_nonzeros += len;
+         }
+         else if (row_kind[ic] == HYPRE_SPGEMM_DENSE)
+         {
+            if (allsquare)
+            {
+               marker[ic - window_first] = ic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  if (marker[jb - window_first] != ic)
+                  {
+                     marker[jb - window_first] = ic;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+         else
+         {
+            mask = hypre_SpGemmHashSize(row_bound[ic]) - 1;
+            if (allsquare)
+            {
+               h = hypre_SpGemmHash(ic, mask);
+               hash[2*h] = ic;
+               hash[2*h+1] = ic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  h = hypre_SpGemmHash(jb, mask);
+                  while (hash[2*h+1] == ic && hash[2*h] != jb)
+                  {
+                     h = (h + 1) & mask;
+                  }
+                  if (hash[2*h+1] != ic)
+                  {
+                     hash[2*h] = jb;
+                     hash[2*h+1] = ic;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+      }
+
+      /*-----------------------------------------------------------------
+       * Row offsets; C_j and C_data are left untouched here so that their
+       * pages are first touched by the threads that fill them
+       *-----------------------------------------------------------------*/
+
+      hypre_prefix_sum(&num_nonzeros, &total_nonzeros, prefix_work);
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         C_i[ic] += num_nonzeros;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+      {
+         C_i[nrows_A] = total_nonzeros;
+         C_j    = hypre_TAlloc(HYPRE_Int, total_nonzeros, memory_location_C);
+         C_data = hypre_TAlloc(HYPRE_Complex, total_nonzeros, memory_location_C);
+      }
+
+      for (k = 0; k <= window_last - window_first; k++)
+      {
+         marker[k] = -1;
+      }
+      for (k = 0; k < hash_size; k++)
+      {
+         hash[2*k+1] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /*-----------------------------------------------------------------
+       * Pass 2: fill
+       *-----------------------------------------------------------------*/
+
+      counter = num_nonzeros;
+      for (ic = ns; ic < ne; ic++)
+      {
+         row_start = counter;
+
+         if (allsquare)
+         {
+            C_j[counter] = ic;
+            C_data[counter] = 0;
+            counter++;
+         }
+
+         if (row_kind[ic] == HYPRE_SPGEMM_SHORT)
+         {
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  b_entry = B_data[ib];
+                  for (k = row_start; k < counter && C_j[k] != jb; k++);
+                  if (k == counter)
+                  {
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry*b_entry;
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[k] += a_entry*b_entry;
+                  }
+               }
+            }
+         }
+         else if (row_kind[ic] == HYPRE_SPGEMM_DENSE)
+         {
+            if (allsquare)
+            {
+               marker[ic - window_first] = row_start;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  b_entry = B_data[ib];
+                  if (marker[jb - window_first] < row_start)
+                  {
+                     marker[jb - window_first] = counter;
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry*b_entry;
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[marker[jb - window_first]] += a_entry*b_entry;
+                  }
+               }
+            }
+         }
+         else
+         {
+            mask = hypre_SpGemmHashSize(row_bound[ic]) - 1;
+            if (allsquare)
+            {
+               h = hypre_SpGemmHash(ic, mask);
+               hash[2*h] = ic;
+               hash[2*h+1] = row_start;
+            }
+            for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  b_entry = B_data[ib];
+                  h = hypre_SpGemmHash(jb, mask);
+                  while (hash[2*h+1] >= row_start && hash[2*h] != jb)
+                  {
+                     h = (h + 1) & mask;
+                  }
+                  if (hash[2*h+1] < row_start)
+                  {
+                     hash[2*h] = jb;
+                     hash[2*h+1] = counter;
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry*b_entry;
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[hash[2*h+1]] += a_entry*b_entry;
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_TFree(B_first, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_last, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_first, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_last, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_bound, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_kind, HYPRE_MEMORY_HOST);
+   hypre_TFree(prefix_work, HYPRE_MEMORY_HOST);
+   hypre_TFree(block_work, HYPRE_MEMORY_HOST);
+
+   C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+   hypre_CSRMatrixI(C)    = C_i;
+   hypre_CSRMatrixJ(C)    = C_j;
+   hypre_CSRMatrixData(C) = C_data;
+   hypre_CSRMatrixMemoryLocation(C) = memory_location_C;
+
+   return C;
+}
@@ -0,0 +1,440 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Member functions for hypre_SELLMatrix class (SELL-C-sigma storage).
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* The explicit SIMD kernels require real double precision values and 32-bit
+ * column indices.  Everything else goes through the portable kernels, which
+ * are written so that the compiler can vectorize the inner lane loops. */
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE) && !defined(HYPRE_BIGINT)
+#if defined(__AVX512F__)
+#define HYPRE_SELL_USING_AVX512
+#endif
+#if defined(__AVX2__) && defined(__FMA__)
+#define HYPRE_SELL_USING_AVX2
+#endif
+#endif
+
+#if defined(HYPRE_SELL_USING_AVX512) || defined(HYPRE_SELL_USING_AVX2)
+#include <immintrin.h>
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixCreate
+ *
+ * Builds the SELL-C-sigma representation of a host CSR matrix.  A
+ * chunk_size <= 0 or sigma <= 0 selects the default value.  sigma is rounded
+ * up to a multiple of chunk_size; sigma == chunk_size only sorts rows within
+ * a chunk and does not move rows across chunks.
+ *--------------------------------------------------------------------------*/
+
+hypre_SELLMatrix *
+hypre_SELLMatrixCreate( hypre_CSRMatrix *A,
+                        HYPRE_Int        chunk_size,
+                        HYPRE_Int        sigma )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   hypre_SELLMatrix *sell;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *perm, *sell_j;
+   HYPRE_Complex    *sell_data;
+   HYPRE_Int        *neg_len;
+   HYPRE_Int         num_chunks, nnz_padded;
+   HYPRE_Int         c, r, k, i, row, len, start, end, pad_col;
+
+   if (chunk_size <= 0)
+   {
+      chunk_size = HYPRE_SELL_DEFAULT_CHUNK_SIZE;
+   }
+   chunk_size = hypre_min(chunk_size, HYPRE_SELL_MAX_CHUNK_SIZE);
+   if (sigma <= 0)
+   {
+      sigma = HYPRE_SELL_DEFAULT_SIGMA;
+   }
+   sigma = ((sigma + chunk_size - 1) / chunk_size) * chunk_size;
+
+   num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+
+   sell = hypre_CTAlloc(hypre_SELLMatrix, 1, HYPRE_MEMORY_HOST);
+   chunk_ptr = hypre_CTAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   perm      = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   neg_len   = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Sort rows by decreasing length within each sigma window
+    *-----------------------------------------------------------------------*/
+
+   for (i = 0; i < num_rows; i++)
+   {
+      perm[i] = i;
+      neg_len[i] = A_i[i] - A_i[i+1];
+   }
+
+   if (sigma > 1)
+   {
+      for (start = 0; start < num_rows; start += sigma)
+      {
+         end = hypre_min(start + sigma, num_rows);
+         hypre_qsort2i(neg_len, perm, start, end - 1);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Chunk lengths and offsets
+    *-----------------------------------------------------------------------*/
+
+   for (c = 0; c < num_chunks; c++)
+   {
+      len = 0;
+      for (r = 0; r < chunk_size; r++)
+      {
+         i = c*chunk_size + r;
+         if (i < num_rows)
+         {
+            len = hypre_max(len, -neg_len[i]);
+         }
+      }
+      chunk_len[c] = len;
+      chunk_ptr[c+1] = chunk_ptr[c] + len*chunk_size;
+   }
+   nnz_padded = chunk_ptr[num_chunks];
+
+   hypre_TFree(neg_len, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Fill values and column indices (column-major within each chunk)
+    *-----------------------------------------------------------------------*/
+
+   sell_j    = hypre_CTAlloc(HYPRE_Int, nnz_padded, HYPRE_MEMORY_HOST);
+   sell_data = hypre_CTAlloc(HYPRE_Complex, nnz_padded, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,r,k,i,row,len,pad_col) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (r = 0; r < chunk_size; r++)
+      {
+         i = c*chunk_size + r;
+         row = i < num_rows ? perm[i] : -1;
+         len = row < 0 ? 0 : A_i[row+1] - A_i[row];
+
+         for (k = 0; k < len; k++)
+         {
+            sell_j[chunk_ptr[c] + k*chunk_size + r]    = A_j[A_i[row] + k];
+            sell_data[chunk_ptr[c] + k*chunk_size + r] = A_data[A_i[row] + k];
+         }
+
+         /* pad with a column index that is already being read by this row */
+         pad_col = len ? A_j[A_i[row] + len - 1] : 0;
+         for (k = len; k < chunk_len[c]; k++)
+         {
+            sell_j[chunk_ptr[c] + k*chunk_size + r]    = pad_col;
+            sell_data[chunk_ptr[c] + k*chunk_size + r] = 0.0;
+         }
+      }
+   }
+
+   hypre_SELLMatrixNumRows(sell)   = num_rows;
+   hypre_SELLMatrixNumCols(sell)   = num_cols;
+   hypre_SELLMatrixChunkSize(sell) = chunk_size;
+   hypre_SELLMatrixSigma(sell)     = sigma;
+   hypre_SELLMatrixNumChunks(sell) = num_chunks;
+   hypre_SELLMatrixChunkPtr(sell)  = chunk_ptr;
+   hypre_SELLMatrixChunkLen(sell)  = chunk_len;
+   hypre_SELLMatrixPerm(sell)      = perm;
+   hypre_SELLMatrixJ(sell)         = sell_j;
+   hypre_SELLMatrixData(sell)      = sell_data;
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SELLMatrixDestroy( hypre_SELLMatrix *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_SELLMatrixChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixPerm(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixMemorySize
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_SELLMatrixMemorySize( hypre_SELLMatrix *sell )
+{
+   size_t    size;
+   HYPRE_Int num_chunks;
+
+   if (!sell)
+   {
+      return 0;
+   }
+
+   num_chunks = hypre_SELLMatrixNumChunks(sell);
+   size  = sizeof(hypre_SELLMatrix);
+   size += sizeof(HYPRE_Int) * (2 * num_chunks + 1 + hypre_SELLMatrixNumRows(sell));
+   size += (sizeof(HYPRE_Int) + sizeof(HYPRE_Complex)) *
+           (size_t) hypre_SELLMatrixChunkPtr(sell)[num_chunks];
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixChunkProduct
+ *
+ * tmp[0:C] = (rows of one chunk) * x, with C = chunk_size.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_SELLMatrixChunkProduct( HYPRE_Int      chunk_size,
+                              HYPRE_Int      len,
+                              HYPRE_Complex *data,
+                              HYPRE_Int     *j,
+                              HYPRE_Complex *x,
+                              HYPRE_Complex *tmp )
+{
+   HYPRE_Int k, r;
+
+#if defined(HYPRE_SELL_USING_AVX512)
+   if (chunk_size == 8)
+   {
+      __m512d acc = _mm512_setzero_pd();
+      for (k = 0; k < len; k++)
+      {
+         __m256i idx = _mm256_loadu_si256((const __m256i *) (j + k*8));
+         __m512d xv  = _mm512_i32gather_pd(idx, x, 8);
+         acc = _mm512_fmadd_pd(_mm512_loadu_pd(data + k*8), xv, acc);
+      }
+      _mm512_storeu_pd(tmp, acc);
+      return;
+   }
+#endif
+
+#if defined(HYPRE_SELL_USING_AVX2)
+   if (chunk_size == 4 || chunk_size == 8)
+   {
+      /* one or two 4-wide accumulators */
+      __m256d acc0 = _mm256_setzero_pd();
+      __m256d acc1 = _mm256_setzero_pd();
+      for (k = 0; k < len; k++)
+      {
+         __m128i idx0 = _mm_loadu_si128((const __m128i *) (j + k*chunk_size));
+         acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(data + k*chunk_size),
+                                _mm256_i32gather_pd(x, idx0, 8), acc0);
+         if (chunk_size == 8)
+         {
+            __m128i idx1 = _mm_loadu_si128((const __m128i *) (j + k*8 + 4));
+            acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(data + k*8 + 4),
+                                   _mm256_i32gather_pd(x, idx1, 8), acc1);
+         }
+      }
+      _mm256_storeu_pd(tmp, acc0);
+      if (chunk_size == 8)
+      {
+         _mm256_storeu_pd(tmp + 4, acc1);
+      }
+      return;
+   }
+#endif
+
+   for (r = 0; r < chunk_size; r++)
+   {
+      tmp[r] = 0.0;
+   }
+   for (k = 0; k < len; k++)
+   {
+      for (r = 0; r < chunk_size; r++)
+      {
+         tmp[r] += data[k*chunk_size + r] * x[j[k*chunk_size + r]];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixMatvec
+ *
+ * y = alpha*A*x + beta*b, where b may be equal to y but x may not.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SELLMatrixMatvec( HYPRE_Complex     alpha,
+                        hypre_SELLMatrix *sell,
+                        HYPRE_Complex    *x,
+                        HYPRE_Complex     beta,
+                        HYPRE_Complex    *b,
+                        HYPRE_Complex    *y )
+{
+   HYPRE_Int      num_rows   = hypre_SELLMatrixNumRows(sell);
+   HYPRE_Int      chunk_size = hypre_SELLMatrixChunkSize(sell);
+   HYPRE_Int      num_chunks = hypre_SELLMatrixNumChunks(sell);
+   HYPRE_Int     *chunk_ptr  = hypre_SELLMatrixChunkPtr(sell);
+   HYPRE_Int     *chunk_len  = hypre_SELLMatrixChunkLen(sell);
+   HYPRE_Int     *perm       = hypre_SELLMatrixPerm(sell);
+   HYPRE_Int     *sell_j     = hypre_SELLMatrixJ(sell);
+   HYPRE_Complex *sell_data  = hypre_SELLMatrixData(sell);
+
+   HYPRE_Complex  tmp[HYPRE_SELL_MAX_CHUNK_SIZE];
+   HYPRE_Int      c, r, i, row, nr;
+
+   hypre_assert(chunk_size <= HYPRE_SELL_MAX_CHUNK_SIZE);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,r,i,row,nr,tmp) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      hypre_SELLMatrixChunkProduct(chunk_size, chunk_len[c],
+                                   sell_data + chunk_ptr[c], sell_j + chunk_ptr[c],
+                                   x, tmp);
+
+      nr = hypre_min(chunk_size, num_rows - c*chunk_size);
+      if (beta == 0.0)
+      {
+         for (r = 0; r < nr; r++)
+         {
+            i = c*chunk_size + r;
+            y[perm[i]] = alpha*tmp[r];
+         }
+      }
+      else
+      {
+         for (r = 0; r < nr; r++)
+         {
+            i = c*chunk_size + r;
+            row = perm[i];
+            y[row] = alpha*tmp[r] + beta*b[row];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixMatvecT
+ *
+ * y += A^T*x.  The products of one chunk column are formed with SIMD; the
+ * scatter into y is scalar since lanes of a chunk may hit the same column.
+ * With threads, each thread accumulates into its own copy of y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SELLMatrixMatvecT( hypre_SELLMatrix *sell,
+                         HYPRE_Complex    *x,
+                         HYPRE_Complex    *y )
+{
+   HYPRE_Int      num_rows   = hypre_SELLMatrixNumRows(sell);
+   HYPRE_Int      num_cols   = hypre_SELLMatrixNumCols(sell);
+   HYPRE_Int      chunk_size = hypre_SELLMatrixChunkSize(sell);
+   HYPRE_Int      num_chunks = hypre_SELLMatrixNumChunks(sell);
+   HYPRE_Int     *chunk_ptr  = hypre_SELLMatrixChunkPtr(sell);
+   HYPRE_Int     *chunk_len  = hypre_SELLMatrixChunkLen(sell);
+   HYPRE_Int     *perm       = hypre_SELLMatrixPerm(sell);
+   HYPRE_Int     *sell_j     = hypre_SELLMatrixJ(sell);
+   HYPRE_Complex *sell_data  = hypre_SELLMatrixData(sell);
+
+   HYPRE_Int      num_threads = hypre_NumThreads();
+   HYPRE_Complex *y_expand = NULL;
+
+   hypre_assert(chunk_size <= HYPRE_SELL_MAX_CHUNK_SIZE);
+
+   if (num_threads > 1)
+   {
+      y_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*num_cols, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_Complex  xr[HYPRE_SELL_MAX_CHUNK_SIZE], prod[HYPRE_SELL_MAX_CHUNK_SIZE];
+      HYPRE_Complex *y_loc = num_threads > 1 ? y_expand + hypre_GetThreadNum()*num_cols : y;
+      HYPRE_Int      c, k, r, i, nr;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         HYPRE_Complex *data = sell_data + chunk_ptr[c];
+         HYPRE_Int     *j    = sell_j + chunk_ptr[c];
+
+         nr = hypre_min(chunk_size, num_rows - c*chunk_size);
+         for (r = 0; r < chunk_size; r++)
+         {
+            i = c*chunk_size + r;
+            xr[r] = r < nr ? x[perm[i]] : 0.0;
+         }
+
+         for (k = 0; k < chunk_len[c]; k++)
+         {
+#if defined(HYPRE_SELL_USING_AVX512)
+            if (chunk_size == 8)
+            {
+               _mm512_storeu_pd(prod, _mm512_mul_pd(_mm512_loadu_pd(data + k*8),
+                                                    _mm512_loadu_pd(xr)));
+            }
+            else
+#endif
+            {
+               for (r = 0; r < chunk_size; r++)
+               {
+                  prod[r] = data[k*chunk_size + r] * xr[r];
+               }
+            }
+            for (r = 0; r < chunk_size; r++)
+            {
+               y_loc[j[k*chunk_size + r]] += prod[r];
+            }
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_cols; i++)
+         {
+            for (k = 0; k < num_threads; k++)
+            {
+               y[i] += y_expand[k*num_cols + i];
+            }
+         }
+      }
+   } /* end parallel region */
+
+   hypre_TFree(y_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
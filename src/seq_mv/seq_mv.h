@@ -34,6 +34,52 @@ extern "C" {
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) companion storage for the CSR Matrix
+ *
+ * Rows are grouped into chunks of C = chunk_size rows.  Within a window of
+ * sigma consecutive rows, rows are sorted by decreasing length before being
+ * chunked, so that padding is small.  Each chunk is stored column-major with
+ * all rows padded to the longest row of the chunk: entry k of slot r of
+ * chunk c is at [chunk_ptr[c] + k*C + r].  Padding uses zero values and a
+ * valid column index, so the kernels need no masking.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_DEFAULT_CHUNK_SIZE 8
+#define HYPRE_SELL_DEFAULT_SIGMA      128
+#define HYPRE_SELL_MAX_CHUNK_SIZE     32
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_cols;
+   HYPRE_Int      chunk_size;
+   HYPRE_Int      sigma;
+   HYPRE_Int      num_chunks;
+
+   HYPRE_Int     *chunk_ptr;   /* size num_chunks+1 */
+   HYPRE_Int     *chunk_len;   /* size num_chunks */
+   HYPRE_Int     *perm;        /* slot -> row, size num_rows */
+   HYPRE_Int     *j;
+   HYPRE_Complex *data;
+
+} hypre_SELLMatrix;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the SELL Matrix structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SELLMatrixNumRows(matrix)     ((matrix) -> num_rows)
+#define hypre_SELLMatrixNumCols(matrix)     ((matrix) -> num_cols)
+#define hypre_SELLMatrixChunkSize(matrix)   ((matrix) -> chunk_size)
+#define hypre_SELLMatrixSigma(matrix)       ((matrix) -> sigma)
+#define hypre_SELLMatrixNumChunks(matrix)   ((matrix) -> num_chunks)
+#define hypre_SELLMatrixChunkPtr(matrix)    ((matrix) -> chunk_ptr)
+#define hypre_SELLMatrixChunkLen(matrix)    ((matrix) -> chunk_len)
+#define hypre_SELLMatrixPerm(matrix)        ((matrix) -> perm)
+#define hypre_SELLMatrixJ(matrix)           ((matrix) -> j)
+#define hypre_SELLMatrixData(matrix)        ((matrix) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -58,6 +104,12 @@ typedef struct
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
 
+   /* optional SELL-C-sigma copy used by the host matvec kernels */
+   hypre_SELLMatrix *sell;
+
+   /* optional single precision values; used instead of `data' when set */
+   hypre_float   *data_float;
+
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
@@ -78,6 +130,8 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
+#define hypre_CSRMatrixSell(matrix)           ((matrix) -> sell)
+#define hypre_CSRMatrixDataFloat(matrix)      ((matrix) -> data_float)
 
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
@@ -253,6 +307,9 @@ void hypre_CSRMatrixComputeRowSum( hypre_CSRMatrix *A, HYPRE_Int *CF_i, HYPRE_In
 void hypre_CSRMatrixExtractDiagonal( hypre_CSRMatrix *A, HYPRE_Complex *d, HYPRE_Int type);
 void hypre_CSRMatrixExtractDiagonalHost( hypre_CSRMatrix *A, HYPRE_Complex *d, HYPRE_Int type);
 
+/* csr_spgemm_host.c */
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostAdaptive ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+
 /* csr_matop_device.c */
 #if defined(HYPRE_USING_CUDA)
 hypre_CSRMatrix *hypre_CSRMatrixAddDevice ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
@@ -270,6 +327,7 @@ void hypre_CSRMatrixExtractDiagonalDevice( hypre_CSRMatrix *A, HYPRE_Complex *d,
 /* csr_matrix.c */
 hypre_CSRMatrix *hypre_CSRMatrixCreate ( HYPRE_Int num_rows , HYPRE_Int num_cols , HYPRE_Int num_nonzeros );
 HYPRE_Int hypre_CSRMatrixDestroy ( hypre_CSRMatrix *matrix );
+size_t hypre_CSRMatrixMemorySize ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_CSRMatrixInitialize ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixBigInitialize ( hypre_CSRMatrix *matrix );
@@ -277,6 +335,8 @@ HYPRE_Int hypre_CSRMatrixBigJtoJ ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixJtoBigJ ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixSetDataOwner ( hypre_CSRMatrix *matrix , HYPRE_Int owns_data );
 HYPRE_Int hypre_CSRMatrixSetRownnz ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixSetSELL ( hypre_CSRMatrix *matrix , HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSetDataFloat ( hypre_CSRMatrix *matrix , HYPRE_Int keep_data );
 hypre_CSRMatrix *hypre_CSRMatrixRead ( char *file_name );
 HYPRE_Int hypre_CSRMatrixPrint ( hypre_CSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_CSRMatrixPrint2( hypre_CSRMatrix *matrix, const char *file_name );
@@ -367,10 +427,18 @@ HYPRE_Int hypre_MultiblockMatrixSetNumSubmatrices ( hypre_MultiblockMatrix *matr
 HYPRE_Int hypre_MultiblockMatrixSetSubmatrixType ( hypre_MultiblockMatrix *matrix , HYPRE_Int j , HYPRE_Int type );
 HYPRE_Int hypre_MultiblockMatrixSetSubmatrix ( hypre_MultiblockMatrix *matrix , HYPRE_Int j , void *submatrix );
 
+/* sell_matrix.c */
+hypre_SELLMatrix *hypre_SELLMatrixCreate ( hypre_CSRMatrix *A , HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int hypre_SELLMatrixDestroy ( hypre_SELLMatrix *sell );
+size_t hypre_SELLMatrixMemorySize ( hypre_SELLMatrix *sell );
+HYPRE_Int hypre_SELLMatrixMatvec ( HYPRE_Complex alpha , hypre_SELLMatrix *sell , HYPRE_Complex *x , HYPRE_Complex beta , HYPRE_Complex *b , HYPRE_Complex *y );
+HYPRE_Int hypre_SELLMatrixMatvecT ( hypre_SELLMatrix *sell , HYPRE_Complex *x , HYPRE_Complex *y );
+
 /* vector.c */
 hypre_Vector *hypre_SeqVectorCreate ( HYPRE_Int size );
 hypre_Vector *hypre_SeqMultiVectorCreate ( HYPRE_Int size , HYPRE_Int num_vectors );
 HYPRE_Int hypre_SeqVectorDestroy ( hypre_Vector *vector );
+size_t hypre_SeqVectorMemorySize ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorInitialize_v2( hypre_Vector *vector, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_SeqVectorInitialize ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorSetDataOwner ( hypre_Vector *vector , HYPRE_Int owns_data );
@@ -386,6 +454,7 @@ HYPRE_Int hypre_SeqVectorScale( HYPRE_Complex alpha, hypre_Vector *y );
 
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
+HYPRE_Real hypre_SeqVectorAxpyNorm ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd8(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
@@ -75,6 +75,30 @@ hypre_SeqVectorDestroy( hypre_Vector *vector )
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMemorySize
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_SeqVectorMemorySize( hypre_Vector *vector )
+{
+   size_t size;
+
+   if (!vector)
+   {
+      return 0;
+   }
+
+   size = sizeof(hypre_Vector);
+   if ( hypre_VectorOwnsData(vector) && hypre_VectorData(vector) )
+   {
+      size += sizeof(HYPRE_Complex) * (size_t) hypre_VectorSize(vector) *
+              hypre_VectorNumVectors(vector);
+   }
+
+   return size;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SeqVectorInitialize
  *--------------------------------------------------------------------------*/
@@ -584,6 +608,51 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpyNorm
+ *
+ * y = y + alpha*x, returning <y,y> of the updated y from the same pass.
+ *--------------------------------------------------------------------------*/
+HYPRE_Real
+hypre_SeqVectorAxpyNorm( HYPRE_Complex alpha,
+                         hypre_Vector *x,
+                         hypre_Vector *y     )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_SeqVectorAxpy(alpha, x, y);
+
+   return hypre_SeqVectorInnerProd(y, y);
+#else
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Real     result = 0.0;
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] += alpha * x_data[i];
+      result += hypre_conj(y_data[i]) * y_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+#endif
+}
+
 //TODO
 
 /*--------------------------------------------------------------------------
@@ -789,6 +789,10 @@ HYPRE_Int
 HYPRE_SStructPCGSetTwoNorm(HYPRE_SStructSolver solver,
                            HYPRE_Int           two_norm);
 
+HYPRE_Int
+HYPRE_SStructPCGSetPipelined(HYPRE_SStructSolver solver,
+                             HYPRE_Int           pipelined);
+
 HYPRE_Int
 HYPRE_SStructPCGSetRelChange(HYPRE_SStructSolver solver,
                              HYPRE_Int           rel_change);
@@ -24,6 +24,7 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   hypre_PCGFunctionsSetMultiInnerProd(pcg_functions, hypre_SStructKrylovMultiInnerProdInit);
 
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -108,6 +109,16 @@ HYPRE_SStructPCGSetTwoNorm( HYPRE_SStructSolver solver,
    return( HYPRE_PCGSetTwoNorm( (HYPRE_Solver) solver, two_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPCGSetPipelined( HYPRE_SStructSolver solver,
+                              HYPRE_Int           pipelined )
+{
+   return( HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
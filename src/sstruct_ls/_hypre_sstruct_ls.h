@@ -443,6 +443,7 @@ HYPRE_Int HYPRE_SStructPCGSetTol ( HYPRE_SStructSolver solver , HYPRE_Real tol )
 HYPRE_Int HYPRE_SStructPCGSetAbsoluteTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_SStructPCGSetMaxIter ( HYPRE_SStructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_SStructPCGSetTwoNorm ( HYPRE_SStructSolver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_SStructPCGSetPipelined ( HYPRE_SStructSolver solver , HYPRE_Int pipelined );
 HYPRE_Int HYPRE_SStructPCGSetRelChange ( HYPRE_SStructSolver solver , HYPRE_Int rel_change );
 HYPRE_Int HYPRE_SStructPCGSetPrecond ( HYPRE_SStructSolver solver , HYPRE_PtrToSStructSolverFcn precond , HYPRE_PtrToSStructSolverFcn precond_setup , void *precond_data );
 HYPRE_Int HYPRE_SStructPCGSetLogging ( HYPRE_SStructSolver solver , HYPRE_Int logging );
@@ -501,6 +502,7 @@ void *hypre_SStructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_SStructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_SStructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_SStructKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_SStructKrylovMultiInnerProdInit ( HYPRE_Int nprod , void **x , void **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_SStructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -214,6 +214,22 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovMultiInnerProdInit( HYPRE_Int           nprod,
+                                       void              **x,
+                                       void              **y,
+                                       HYPRE_Real         *local_result,
+                                       HYPRE_Real         *result,
+                                       hypre_MPI_Request  *request )
+{
+   return ( hypre_SStructMultiInnerProdInit( nprod, (hypre_SStructVector **) x,
+                                             (hypre_SStructVector **) y,
+                                             local_result, result, request ) );
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -132,6 +132,7 @@ HYPRE_Int hypre_SStructGridIntersect ( hypre_SStructGrid *grid , HYPRE_Int part
 /* sstruct_innerprod.c */
 HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px , hypre_SStructPVector *py , HYPRE_Real *presult_ptr );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x , hypre_SStructVector *y , HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructMultiInnerProdInit ( HYPRE_Int nprod , hypre_SStructVector **x , hypre_SStructVector **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix , hypre_SStructPMatrix **matrix_ref );
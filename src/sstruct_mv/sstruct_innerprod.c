@@ -91,3 +91,67 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructMultiInnerProdInit
+ *
+ * Computes the local parts of the nprod inner products <x[k],y[k]> into
+ * local_result and starts their global sum into result.  The sum completes
+ * with hypre_MPI_Wait on request; both arrays must stay valid until then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMultiInnerProdInit( HYPRE_Int             nprod,
+                                 hypre_SStructVector **x,
+                                 hypre_SStructVector **y,
+                                 HYPRE_Real           *local_result,
+                                 HYPRE_Real           *result,
+                                 hypre_MPI_Request    *request )
+{
+   HYPRE_Int    object_type = hypre_SStructVectorObjectType(x[0]);
+   HYPRE_Int    k, part, var;
+
+   for (k = 0; k < nprod; k++)
+   {
+      if (hypre_SStructVectorObjectType(x[k]) != object_type ||
+          hypre_SStructVectorObjectType(y[k]) != object_type)
+      {
+         hypre_error_in_arg(2);
+         hypre_error_in_arg(3);
+         return hypre_error_flag;
+      }
+
+      local_result[k] = 0.0;
+      if ( (object_type == HYPRE_SSTRUCT) || (object_type == HYPRE_STRUCT) )
+      {
+         for (part = 0; part < hypre_SStructVectorNParts(x[k]); part++)
+         {
+            hypre_SStructPVector *px = hypre_SStructVectorPVector(x[k], part);
+            hypre_SStructPVector *py = hypre_SStructVectorPVector(y[k], part);
+
+            for (var = 0; var < hypre_SStructPVectorNVars(px); var++)
+            {
+               local_result[k] +=
+                  hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                             hypre_SStructPVectorSVector(py, var));
+            }
+         }
+      }
+      else if (object_type == HYPRE_PARCSR)
+      {
+         hypre_ParVector  *x_par;
+         hypre_ParVector  *y_par;
+
+         hypre_SStructVectorConvert(x[k], &x_par);
+         hypre_SStructVectorConvert(y[k], &y_par);
+
+         local_result[k] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x_par),
+                                                    hypre_ParVectorLocalVector(y_par));
+      }
+   }
+
+   hypre_MPI_Iallreduce(local_result, result, nprod, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, hypre_SStructVectorComm(x[0]), request);
+
+   return hypre_error_flag;
+}
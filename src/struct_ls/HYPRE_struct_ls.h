@@ -554,6 +554,9 @@ HYPRE_Int HYPRE_StructPCGSetMaxIter(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPCGSetTwoNorm(HYPRE_StructSolver solver,
                               HYPRE_Int          two_norm);
 
+HYPRE_Int HYPRE_StructPCGSetPipelined(HYPRE_StructSolver solver,
+                                HYPRE_Int          pipelined);
+
 HYPRE_Int HYPRE_StructPCGSetRelChange(HYPRE_StructSolver solver,
                                 HYPRE_Int          rel_change);
 
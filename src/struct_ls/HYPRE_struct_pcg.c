@@ -28,6 +28,7 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetMultiInnerProd(pcg_functions, hypre_StructKrylovMultiInnerProdInit);
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -108,6 +109,15 @@ HYPRE_StructPCGSetTwoNorm( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructPCGSetPipelined( HYPRE_StructSolver solver,
+                             HYPRE_Int          pipelined )
+{
+   return( HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructPCGSetRelChange( HYPRE_StructSolver solver,
                              HYPRE_Int          rel_change )
@@ -188,6 +188,7 @@ HYPRE_Int HYPRE_StructPCGSetTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructPCGSetAbsoluteTol ( HYPRE_StructSolver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_StructPCGSetMaxIter ( HYPRE_StructSolver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_StructPCGSetTwoNorm ( HYPRE_StructSolver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_StructPCGSetPipelined ( HYPRE_StructSolver solver , HYPRE_Int pipelined );
 HYPRE_Int HYPRE_StructPCGSetRelChange ( HYPRE_StructSolver solver , HYPRE_Int rel_change );
 HYPRE_Int HYPRE_StructPCGSetPrecond ( HYPRE_StructSolver solver , HYPRE_PtrToStructSolverFcn precond , HYPRE_PtrToStructSolverFcn precond_setup , HYPRE_StructSolver precond_solver );
 HYPRE_Int HYPRE_StructPCGSetLogging ( HYPRE_StructSolver solver , HYPRE_Int logging );
@@ -308,6 +309,7 @@ void *hypre_StructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_StructKrylovMultiInnerProdInit ( HYPRE_Int nprod , void **x , void **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -137,6 +137,22 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMultiInnerProdInit( HYPRE_Int           nprod,
+                                      void              **x,
+                                      void              **y,
+                                      HYPRE_Real         *local_result,
+                                      HYPRE_Real         *result,
+                                      hypre_MPI_Request  *request )
+{
+   return ( hypre_StructMultiInnerProdInit( nprod, (hypre_StructVector **) x,
+                                            (hypre_StructVector **) y,
+                                            local_result, result, request ) );
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
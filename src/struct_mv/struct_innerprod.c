@@ -14,16 +14,15 @@
 #include "_hypre_struct_mv.h"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * The contribution of this process to <x,y>, without the global sum.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -95,7 +94,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -104,3 +117,33 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMultiInnerProdInit
+ *
+ * Computes the local parts of the nprod inner products <x[k],y[k]> into
+ * local_result and starts their global sum into result.  The sum completes
+ * with hypre_MPI_Wait on request; both arrays must stay valid until then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMultiInnerProdInit( HYPRE_Int            nprod,
+                                hypre_StructVector **x,
+                                hypre_StructVector **y,
+                                HYPRE_Real          *local_result,
+                                HYPRE_Real          *result,
+                                hypre_MPI_Request   *request )
+{
+   HYPRE_Int  k;
+
+   for (k = 0; k < nprod; k++)
+   {
+      local_result[k] = hypre_StructInnerProdLocal(x[k], y[k]);
+      hypre_IncFLOPCount(2*hypre_StructVectorGlobalSize(x[k]));
+   }
+
+   hypre_MPI_Iallreduce(local_result, result, nprod, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, hypre_StructVectorComm(x[0]), request);
+
+   return hypre_error_flag;
+}
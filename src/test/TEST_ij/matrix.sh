@@ -24,6 +24,21 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+
+tail -17 ${TNAME}.out.13 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# node-aware exchange on two emulated nodes vs. the default exchange
+#=============================================================================
+
+sed -n '/AMG SOLUTION INFO/,/Average Convergence/p' ${TNAME}.out.23 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.23 >> ${TNAME}.testdata
+sed -n '/AMG SOLUTION INFO/,/Average Convergence/p' ${TNAME}.out.24 > ${TNAME}.testdata.temp
+tail -3 ${TNAME}.out.24 >> ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -42,12 +57,30 @@ FILES="\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
+ ${TNAME}.out.17\
+ ${TNAME}.out.18\
+ ${TNAME}.out.19\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
+ ${TNAME}.out.23\
+ ${TNAME}.out.24\
 "
 
 for i in $FILES
 do
   echo "# Output file: $i"
   tail -21 $i | head -6
+  grep "^Multivector " $i
+  grep "^SELL-C-sigma " $i
+  grep "^Overlapped " $i
+  grep "^Halo exchange " $i
+  grep "^Host arena " $i
+  grep "^BoomerAMG re-setup " $i
 done > ${TNAME}.out
 
 # Make sure that the output files are reasonable
@@ -106,6 +106,13 @@ FILES="\
  ${TNAME}.out.118\
  ${TNAME}.out.119\
  ${TNAME}.out.120\
+ ${TNAME}.out.121\
+ ${TNAME}.out.122\
+ ${TNAME}.out.123\
+ ${TNAME}.out.124\
+ ${TNAME}.out.125\
+ ${TNAME}.out.126\
+ ${TNAME}.out.127\
 "
 
 for i in $FILES
@@ -163,6 +170,11 @@ FILES="\
  ${TNAME}.out.322\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
+ ${TNAME}.out.325\
+ ${TNAME}.out.326\
+ ${TNAME}.out.327\
+ ${TNAME}.out.328\
+ ${TNAME}.out.329\
 "
 
 for i in $FILES
@@ -188,4 +200,5 @@ fi
 #=============================================================================
 
 rm -f ${TNAME}.testdata*
+rm -f ij.regions.json ij.trace.json
 rm -r ${TNAME}.mgr_testdata*
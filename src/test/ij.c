@@ -73,6 +73,16 @@ HYPRE_ParCSRMatrix GenerateSysLaplacianVCoef (MPI_Comm comm, HYPRE_BigInt nx, HY
 HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_BigInt nx, HYPRE_BigInt ny, HYPRE_BigInt nz, HYPRE_Real vcx, HYPRE_Real vcy, HYPRE_Real vcz, HYPRE_Int mtx_entry, HYPRE_Real *values);
 
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc , char *argv [], HYPRE_Int arg_index , HYPRE_Int *coorddim_ptr , float **coord_ptr );
+hypre_ParVector *RandomMatvec (hypre_ParCSRMatrix *A , HYPRE_Int transpose );
+HYPRE_Int ParVectorsDiffer (hypre_ParVector *y , hypre_ParVector *z );
+HYPRE_Int CheckHaloExchange (hypre_ParCSRMatrix *A , HYPRE_Int persistent , HYPRE_Int *backends );
+
+/* halo exchange backends reported by CheckHaloExchange */
+#define HALO_PERSISTENT    0
+#define HALO_NEIGHBOR      1
+#define HALO_NODE          2
+#define HALO_SHM           3
+#define HALO_NUM_BACKENDS  4
 
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations,
                                                    HYPRE_Real rel_residual_norm);
@@ -97,6 +107,15 @@ main( hypre_int argc,
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           sell_chunk = 0;
+   HYPRE_Int           mv_overlap = 0;
+   HYPRE_Int           persistent_comm = -1;
+   HYPRE_Int           neighbor_comm = 0;
+   HYPRE_Int           shm_comm = 0;
+   HYPRE_Int           host_arena = 0;
+   HYPRE_Int           spgemm_host = 1;
+   HYPRE_Int           print_mem = 0;
+   HYPRE_Int           test_multivec = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_rhs_type;
@@ -237,6 +256,13 @@ main( hypre_int argc,
 #else
    HYPRE_Int    keepTranspose = 0;
 #endif
+   HYPRE_Int    stream_rap = 0;
+   HYPRE_Int    mixed_precision = 0;
+   HYPRE_Int    node_comm_threshold = 0;
+   HYPRE_Int    node_size = 0;
+   HYPRE_Int    reuse_setup = 0;
+   HYPRE_Int    amg_level_stats = 0;
+   HYPRE_Int    region_timing = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -255,6 +281,7 @@ main( hypre_int argc,
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
+   HYPRE_Int  gs_jacobi_sweeps = 0;
 
    /* for CGC BM Aug 25, 2006 */
    HYPRE_Int      cgcits = 1;
@@ -283,6 +310,7 @@ main( hypre_int argc,
 
    /* parameters for GMRES */
    HYPRE_Int    k_dim;
+   HYPRE_Int    gmres_cgs = 0;
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
@@ -304,6 +332,7 @@ main( hypre_int argc,
 
    HYPRE_Int    print_system = 0;
    HYPRE_Int    rel_change = 0;
+   HYPRE_Int    pcg_pipelined = 0;
 
    /* begin lobpcg */
    HYPRE_Int    hybrid = 1;
@@ -379,6 +408,12 @@ main( hypre_int argc,
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
+   HYPRE_Int ilu_tri_solve = 1;
+   HYPRE_Int ilu_ljac_iters = 5;
+   HYPRE_Int ilu_ujac_iters = 5;
+   HYPRE_Int ilu_factor_sweeps = 3;
+   HYPRE_Int ilu_reordering = 1;
+   HYPRE_Int ilu_block_size = 1;
    /* end hypre ILU options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -562,6 +597,51 @@ main( hypre_int argc,
          arg_index++;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-sell") == 0 )
+      {
+         arg_index++;
+         sell_chunk = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mv_overlap") == 0 )
+      {
+         arg_index++;
+         mv_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-persistent_comm") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_comm") == 0 )
+      {
+         arg_index++;
+         neighbor_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-shm_comm") == 0 )
+      {
+         arg_index++;
+         shm_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-host_arena") == 0 )
+      {
+         arg_index++;
+         host_arena = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-spgemm_host") == 0 )
+      {
+         arg_index++;
+         spgemm_host = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-print_mem") == 0 )
+      {
+         arg_index++;
+         print_mem = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-test_multivec") == 0 )
+      {
+         arg_index++;
+         test_multivec = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-solver") == 0 )
       {
          arg_index++;
@@ -1081,6 +1161,36 @@ main( hypre_int argc,
          arg_index++;
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_tri_solve") == 0 )
+      {                /* exact (1) or iterative (0) triangular solves */
+         arg_index++;
+         ilu_tri_solve = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ljac_iters") == 0 )
+      {                /* Jacobi sweeps for the L solve */
+         arg_index++;
+         ilu_ljac_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ujac_iters") == 0 )
+      {                /* Jacobi sweeps for the U solve */
+         arg_index++;
+         ilu_ujac_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_factor_sweeps") == 0 )
+      {                /* sweeps of the iterative ILU(k) factorization */
+         arg_index++;
+         ilu_factor_sweeps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_reordering") == 0 )
+      {                /* local reordering */
+         arg_index++;
+         ilu_reordering = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_block_size") == 0 )
+      {                /* block size of block ILU(k) */
+         arg_index++;
+         ilu_block_size = atoi(argv[arg_index++]);
+      }
       /* end ilu options */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
@@ -1217,6 +1327,11 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-gmres_cgs") == 0 )
+      {
+         arg_index++;
+         gmres_cgs = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1527,6 +1642,11 @@ main( hypre_int argc,
          arg_index++;
          rel_change = 1;
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-nodal_diag") == 0 )
       {
          arg_index++;
@@ -1547,6 +1667,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_variant = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-gs_jac_sweeps") == 0 )
+      {
+         arg_index++;
+         gs_jacobi_sweeps = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cheby_scale") == 0 )
       {
          arg_index++;
@@ -1612,6 +1737,41 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-stream_rap") == 0 )
+      {
+         arg_index++;
+         stream_rap  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mixedprec") == 0 )
+      {
+         arg_index++;
+         mixed_precision  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-node_comm_th") == 0 )
+      {
+         arg_index++;
+         node_comm_threshold  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-node_size") == 0 )
+      {
+         arg_index++;
+         node_size  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reuse_setup") == 0 )
+      {
+         arg_index++;
+         reuse_setup  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_level_stats") == 0 )
+      {
+         arg_index++;
+         amg_level_stats  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-region_timing") == 0 )
+      {
+         arg_index++;
+         region_timing  = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1733,6 +1893,15 @@ main( hypre_int argc,
          hypre_printf("  -exact_size            : inserts immediately into ParCSR structure\n");
          hypre_printf("  -storage_low           : allocates not enough storage for aux struct\n");
          hypre_printf("  -concrete_parcsr       : use parcsr matrix type as concrete type\n");
+         hypre_printf("  -sell <C>              : use SELL-C-sigma storage for matvecs with A\n");
+         hypre_printf("  -mv_overlap <val>      : overlap halo exchange with interior rows in matvecs\n");
+         hypre_printf("  -persistent_comm <val> : use persistent MPI requests for halo exchanges\n");
+         hypre_printf("  -neighbor_comm <val>   : use MPI-3 neighborhood collectives for halo exchanges\n");
+         hypre_printf("  -shm_comm <val>        : use MPI-3 shared memory windows for on-node halos (AMG)\n");
+         hypre_printf("  -host_arena <val>      : use a host arena for AMG setup work arrays\n");
+         hypre_printf("  -spgemm_host <val>     : host SpGEMM, 0=dense marker 1=adaptive (default)\n");
+         hypre_printf("  -print_mem             : print the memory of A and the AMG hierarchy (AMG)\n");
+         hypre_printf("  -test_multivec <val>   : check Matvec(T) with <val> vectors against single vectors\n");
          hypre_printf("\n");
          hypre_printf("  -rhsfromfile           : ");
          hypre_printf("rhs read from multiple files (IJ format)\n");
@@ -1787,6 +1956,7 @@ main( hypre_int argc,
          hypre_printf("       74=MGR-COGMRES  \n");
          hypre_printf("       80=ILU      81=ILU-GMRES  \n");
          hypre_printf("       82=ILU-FlexGMRES  \n");
+         hypre_printf("       -1=MatVec test     -2=SpGEMM test (A*A and A^T*A)\n");
          hypre_printf("\n");
          hypre_printf("  -cljp                 : CLJP coarsening \n");
          hypre_printf("  -cljp1                : CLJP coarsening, fixed random \n");
@@ -1862,6 +2032,7 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -gs_jac_sweeps <val> : Jacobi sweeps for the triangular solve of l1 GS (relax 8, 13, 14) (default is 0, exact)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -1902,14 +2073,24 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -gmres_cgs <val>       : classical Gram-Schmidt passes for (F/L)GMRES (0: modified)\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -pipelined <val>       : pipelined PCG, one reduction per iteration\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
+         hypre_printf("  -stream_rap <val>      : form coarse grid operators without storing A*P\n");
+         hypre_printf("  -mixedprec <val>       : store A, P, R of intermediate AMG levels in single precision\n");
+         hypre_printf("  -node_comm_th <val>    : node-aware halo exchanges on AMG levels with smaller avg messages\n");
+         hypre_printf("  -node_size <val>       : test node-aware exchanges with nodes of <val> ranks\n");
+         hypre_printf("  -reuse_setup <val>     : AMG: re-setup on the coarse grids of a setup with doubled diag(A)\n");
+         hypre_printf("  -amg_level_stats <val> : AMG (solver 0): print the solve profile per level and phase\n");
+         hypre_printf("  -region_timing <val>   : write the region times to ij.regions.json,\n");
+         hypre_printf("                           and with val > 1 the calls to ij.trace.json\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
@@ -2030,6 +2211,7 @@ main( hypre_int argc,
          hypre_printf("  -ilu_type   <val>                : set ILU factorization type = val\n");
          hypre_printf("  -ilu_type   0                    : Block Jacobi with ILU(k) variants \n");
          hypre_printf("  -ilu_type   1                    : Block Jacobi with ILUT \n");
+         hypre_printf("  -ilu_type   2                    : Block Jacobi with iterative ILU(k) \n");
          hypre_printf("  -ilu_type   10                   : GMRES with ILU(k) variants \n");
          hypre_printf("  -ilu_type   11                   : GMRES with ILUT \n");
          hypre_printf("  -ilu_type   20                   : NSH with ILU(k) variants \n");
@@ -2043,6 +2225,12 @@ main( hypre_int argc,
          hypre_printf("  -ilu_max_row_nnz   <val>         : set max. num of nonzeros to keep per row = val \n");
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
+         hypre_printf("  -ilu_tri_solve   <val>           : exact (1) or Jacobi sweep (0) triangular solves \n");
+         hypre_printf("  -ilu_ljac_iters   <val>          : set num of Jacobi sweeps for the L solve = val \n");
+         hypre_printf("  -ilu_ujac_iters   <val>          : set num of Jacobi sweeps for the U solve = val \n");
+         hypre_printf("  -ilu_factor_sweeps   <val>       : set num of sweeps of iterative ILU(k) = val \n");
+         hypre_printf("  -ilu_reordering   <val>          : local reordering: none (0), RCM (1), AMD (2), ND (3) \n");
+         hypre_printf("  -ilu_block_size   <val>          : block ILU(k) with blocks of size val (ilu_type 0) \n");
          /* end ILU options */
       }
 
@@ -2077,6 +2265,17 @@ main( hypre_int argc,
                             mempool_max_bin, mempool_max_cached_bytes );
 
    hypre_HandleMemoryLocation(hypre_handle())    = memory_location;
+   HYPRE_SetMatvecOverlap(mv_overlap);
+   if (persistent_comm > -1)
+   {
+      HYPRE_SetPersistentComm(persistent_comm);
+   }
+   HYPRE_SetNeighborComm(neighbor_comm);
+   HYPRE_SetShmComm(shm_comm);
+   HYPRE_SetHostArena(host_arena);
+   HYPRE_SetSpGemmHostAlgorithm(spgemm_host);
+   HYPRE_SetRegionTiming(region_timing);
+   hypre_MPINodeSize = node_size;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
    hypre_HandleSpgemmUseCusparse(hypre_handle()) = spgemm_use_cusparse;
@@ -3088,6 +3287,174 @@ main( hypre_int argc,
    hypre_ParVectorMigrate(b, hypre_HandleMemoryLocation(hypre_handle()));
    hypre_ParVectorMigrate(x, hypre_HandleMemoryLocation(hypre_handle()));
 
+   if (sell_chunk > 0)
+   {
+      hypre_ParVector *y_sell[2], *y_csr[2];
+      HYPRE_Int        num_sell, total_sell, num_differ, transpose;
+
+      hypre_ParCSRMatrixSetSELL(parcsr_A, sell_chunk, 0);
+
+      /* check that the SELL-C-sigma copies exist and that Matvec and
+         MatvecT with them agree with the CSR kernels */
+      num_sell = (hypre_CSRMatrixSell(hypre_ParCSRMatrixDiag(parcsr_A)) != NULL) +
+                 (hypre_CSRMatrixSell(hypre_ParCSRMatrixOffd(parcsr_A)) != NULL);
+      for (transpose = 0; transpose < 2; transpose++)
+      {
+         y_sell[transpose] = RandomMatvec(parcsr_A, transpose);
+      }
+      hypre_ParCSRMatrixSetSELL(parcsr_A, -1, 0);
+      for (transpose = 0; transpose < 2; transpose++)
+      {
+         y_csr[transpose] = RandomMatvec(parcsr_A, transpose);
+      }
+      hypre_ParCSRMatrixSetSELL(parcsr_A, sell_chunk, 0);
+
+      num_differ = 0;
+      for (transpose = 0; transpose < 2; transpose++)
+      {
+         num_differ += ParVectorsDiffer(y_sell[transpose], y_csr[transpose]);
+         hypre_ParVectorDestroy(y_sell[transpose]);
+         hypre_ParVectorDestroy(y_csr[transpose]);
+      }
+      hypre_MPI_Allreduce(&num_sell, &total_sell, 1, HYPRE_MPI_INT, hypre_MPI_SUM,
+                          hypre_MPI_COMM_WORLD);
+      if (myid == 0)
+      {
+         hypre_printf("SELL-C-sigma copies of the blocks of A = %d\n", total_sell);
+         hypre_printf("SELL-C-sigma products differing from CSR = %d\n", num_differ);
+      }
+   }
+
+   if (mv_overlap)
+   {
+      hypre_ParVector *y_overlap, *y_plain;
+      HYPRE_Int        num_overlapped, total_overlapped, num_differ;
+
+      /* check that the Matvecs with A are overlapped and that they agree
+         with the ones without overlap */
+      num_overlapped = hypre_ParCSRMatrixMatvecOverlapped(parcsr_A);
+      y_overlap = RandomMatvec(parcsr_A, 0);
+      HYPRE_SetMatvecOverlap(0);
+      y_plain = RandomMatvec(parcsr_A, 0);
+      HYPRE_SetMatvecOverlap(mv_overlap);
+
+      num_differ = ParVectorsDiffer(y_overlap, y_plain);
+      hypre_ParVectorDestroy(y_overlap);
+      hypre_ParVectorDestroy(y_plain);
+      hypre_MPI_Allreduce(&num_overlapped, &total_overlapped, 1, HYPRE_MPI_INT, hypre_MPI_SUM,
+                          hypre_MPI_COMM_WORLD);
+      if (myid == 0)
+      {
+         hypre_printf("Overlapped Matvec with A on processes = %d\n", total_overlapped);
+         hypre_printf("Overlapped Matvec differing from plain = %d\n", num_differ);
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Compare the host multivector Matvec and MatvecT, for both
+    * storage methods, with one single vector product per vector
+    *-----------------------------------------------------------*/
+
+   if (test_multivec > 0)
+   {
+      HYPRE_BigInt     global_size = hypre_ParCSRMatrixGlobalNumRows(parcsr_A);
+      HYPRE_BigInt    *row_starts  = hypre_ParCSRMatrixRowStarts(parcsr_A);
+      hypre_ParVector *X, *Y, *x_v, *y_v;
+      HYPRE_Complex   *X_data, *Y_data, *x_v_data, *y_v_data;
+      HYPRE_Int        local_size, vecstride, idxstride;
+      HYPRE_Int        storage, transpose, num_mismatch, v;
+      HYPRE_Real       err[2], max_err[2];
+
+      x_v = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_size, row_starts);
+      y_v = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_size, row_starts);
+      hypre_ParVectorSetPartitioningOwner(x_v, 0);
+      hypre_ParVectorSetPartitioningOwner(y_v, 0);
+      hypre_ParVectorInitialize_v2(x_v, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(y_v, HYPRE_MEMORY_HOST);
+      x_v_data   = hypre_VectorData(hypre_ParVectorLocalVector(x_v));
+      y_v_data   = hypre_VectorData(hypre_ParVectorLocalVector(y_v));
+      local_size = hypre_VectorSize(hypre_ParVectorLocalVector(x_v));
+
+      for (storage = 0; storage < 2; storage++)
+      {
+         X = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, global_size, row_starts,
+                                        test_multivec);
+         Y = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, global_size, row_starts,
+                                        test_multivec);
+         hypre_ParVectorSetPartitioningOwner(X, 0);
+         hypre_ParVectorSetPartitioningOwner(Y, 0);
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(X)) = storage;
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(Y)) = storage;
+         hypre_ParVectorInitialize_v2(X, HYPRE_MEMORY_HOST);
+         hypre_ParVectorInitialize_v2(Y, HYPRE_MEMORY_HOST);
+         X_data    = hypre_VectorData(hypre_ParVectorLocalVector(X));
+         Y_data    = hypre_VectorData(hypre_ParVectorLocalVector(Y));
+         vecstride = hypre_VectorVectorStride(hypre_ParVectorLocalVector(X));
+         idxstride = hypre_VectorIndexStride(hypre_ParVectorLocalVector(X));
+
+         for (v = 0; v < test_multivec; v++)
+         {
+            hypre_ParVectorSetRandomValues(x_v, v + 1);
+            for (i = 0; i < local_size; i++)
+            {
+               X_data[v*vecstride + i*idxstride] = x_v_data[i];
+            }
+         }
+
+         for (transpose = 0; transpose < 2; transpose++)
+         {
+            if (transpose)
+            {
+               hypre_ParCSRMatrixMatvecT(1.0, parcsr_A, X, 0.0, Y);
+            }
+            else
+            {
+               hypre_ParCSRMatrixMatvec(1.0, parcsr_A, X, 0.0, Y);
+            }
+
+            num_mismatch = 0;
+            for (v = 0; v < test_multivec; v++)
+            {
+               hypre_ParVectorSetRandomValues(x_v, v + 1);
+               if (transpose)
+               {
+                  hypre_ParCSRMatrixMatvecT(1.0, parcsr_A, x_v, 0.0, y_v);
+               }
+               else
+               {
+                  hypre_ParCSRMatrixMatvec(1.0, parcsr_A, x_v, 0.0, y_v);
+               }
+
+               err[0] = 0.0;
+               err[1] = 0.0;
+               for (i = 0; i < local_size; i++)
+               {
+                  err[0] = hypre_max(err[0], hypre_abs(Y_data[v*vecstride + i*idxstride] - y_v_data[i]));
+                  err[1] = hypre_max(err[1], hypre_abs(y_v_data[i]));
+               }
+               hypre_MPI_Allreduce(err, max_err, 2, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                                   hypre_MPI_COMM_WORLD);
+               if (max_err[0] > 1.0e-12 * max_err[1])
+               {
+                  num_mismatch++;
+               }
+            }
+
+            if (myid == 0)
+            {
+               hypre_printf("Multivector %s (storage %d) vectors differing from single = %d\n",
+                            transpose ? "MatvecT" : "Matvec", storage, num_mismatch);
+            }
+         }
+
+         hypre_ParVectorDestroy(X);
+         hypre_ParVectorDestroy(Y);
+      }
+
+      hypre_ParVectorDestroy(x_v);
+      hypre_ParVectorDestroy(y_v);
+   }
+
    /* save the initial guess for the 2nd time */
 #if SECOND_TIME
    x0_save = hypre_ParVectorCloneDeep_v2(x, hypre_ParVectorMemoryLocation(x));
@@ -3138,6 +3505,89 @@ main( hypre_int argc,
       goto final;
    }
 
+   /*-----------------------------------------------------------
+    * SpGEMM test: times A*A and A^T*A with the two host kernels
+    * and checks that they give the same matrices
+    *-----------------------------------------------------------*/
+
+   if (solver_id == -2)
+   {
+      hypre_ParCSRMatrix *C[2][2];
+      HYPRE_Real          tmm[2][2];
+      HYPRE_Int           nmm = 10;
+      HYPRE_Int           alg, prod, k, diff, diff_all;
+      HYPRE_Int           num_threads = hypre_NumThreads();
+
+      if (myid == 0)
+      {
+         hypre_printf("Running %d SpGEMMs A*A and A^T*A with each host kernel\n", nmm);
+         hypre_printf("\n\n Num MPI tasks = %d\n\n",num_procs);
+         hypre_printf(" Num OpenMP threads = %d\n\n",num_threads);
+      }
+
+      for (alg = 0; alg < 2; alg++)
+      {
+         HYPRE_SetSpGemmHostAlgorithm(alg);
+         for (prod = 0; prod < 2; prod++)
+         {
+            hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+            tmm[alg][prod] = hypre_MPI_Wtime();
+            for (i = 0; i < nmm; i++)
+            {
+               C[alg][prod] = prod ? hypre_ParCSRTMatMat(parcsr_A, parcsr_A) :
+                                     hypre_ParCSRMatMat(parcsr_A, parcsr_A);
+               if (i < nmm - 1)
+               {
+                  hypre_ParCSRMatrixDestroy(C[alg][prod]);
+               }
+            }
+            hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+            tmm[alg][prod] = (hypre_MPI_Wtime() - tmm[alg][prod]) / nmm;
+         }
+      }
+      HYPRE_SetSpGemmHostAlgorithm(spgemm_host);
+
+      for (prod = 0; prod < 2; prod++)
+      {
+         hypre_CSRMatrix *X[2], *Y[2];
+
+         X[0] = hypre_ParCSRMatrixDiag(C[0][prod]);
+         X[1] = hypre_ParCSRMatrixOffd(C[0][prod]);
+         Y[0] = hypre_ParCSRMatrixDiag(C[1][prod]);
+         Y[1] = hypre_ParCSRMatrixOffd(C[1][prod]);
+         diff = hypre_ParCSRMatrixNumCols(C[0][prod]) != hypre_ParCSRMatrixNumCols(C[1][prod]);
+         for (j = 0; j < 2 && !diff; j++)
+         {
+            diff = hypre_CSRMatrixNumNonzeros(X[j]) != hypre_CSRMatrixNumNonzeros(Y[j]);
+            for (k = 0; k <= hypre_CSRMatrixNumRows(X[j]) && !diff; k++)
+            {
+               diff = hypre_CSRMatrixI(X[j])[k] != hypre_CSRMatrixI(Y[j])[k];
+            }
+            for (k = 0; k < hypre_CSRMatrixNumNonzeros(X[j]) && !diff; k++)
+            {
+               diff = hypre_CSRMatrixJ(X[j])[k] != hypre_CSRMatrixJ(Y[j])[k] ||
+                      hypre_CSRMatrixData(X[j])[k] != hypre_CSRMatrixData(Y[j])[k];
+            }
+         }
+         hypre_MPI_Allreduce(&diff, &diff_all, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                             hypre_MPI_COMM_WORLD);
+         hypre_ParCSRMatrixSetNumNonzeros(C[1][prod]);
+
+         if (myid == 0)
+         {
+            hypre_printf("%s: nnz %b, dense marker %.2f (ms), adaptive %.2f (ms), %s\n",
+                         prod ? "A^T*A" : "A*A  ",
+                         hypre_ParCSRMatrixNumNonzeros(C[1][prod]),
+                         tmm[0][prod]*1000.0, tmm[1][prod]*1000.0,
+                         diff_all ? "results differ" : "same results");
+         }
+         hypre_ParCSRMatrixDestroy(C[0][prod]);
+         hypre_ParCSRMatrixDestroy(C[1][prod]);
+      }
+
+      goto final;
+   }
+
    if (solver_id == 20)
    {
       if (myid == 0) hypre_printf("Solver:  AMG\n");
@@ -3324,6 +3774,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyFraction(amg_solver, cheby_fraction);
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
+      HYPRE_BoomerAMGSetGSJacobiSweeps(amg_solver, gs_jacobi_sweeps);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
@@ -3380,6 +3831,11 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetStreamRAP(amg_solver, stream_rap);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetNodeCommThreshold(amg_solver, node_comm_threshold);
+      HYPRE_BoomerAMGSetReuseSetup(amg_solver, reuse_setup);
+      HYPRE_BoomerAMGSetLevelStats(amg_solver, amg_level_stats);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3408,6 +3864,32 @@ main( hypre_int argc,
 
       //cudaProfilerStart();
 
+      if (reuse_setup)
+      {
+         /* a first setup with the diagonal of A doubled; the setup below,
+            with the original values, reuses its coarse grids */
+         hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(parcsr_A);
+         HYPRE_Int        i_row;
+
+         for (i_row = 0; i_row < hypre_CSRMatrixNumRows(A_diag); i_row++)
+         {
+            hypre_CSRMatrixData(A_diag)[hypre_CSRMatrixI(A_diag)[i_row]] *= 2.0;
+         }
+         HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+         for (i_row = 0; i_row < hypre_CSRMatrixNumRows(A_diag); i_row++)
+         {
+            hypre_CSRMatrixData(A_diag)[hypre_CSRMatrixI(A_diag)[i_row]] *= 0.5;
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         time_index = hypre_InitializeTiming("BoomerAMG Re-setup");
+         hypre_BeginTiming(time_index);
+      }
+
 #if defined(HYPRE_USING_NVTX)
       hypre_NvtxPushRange("AMG-Setup-1");
 #endif
@@ -3426,6 +3908,87 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (persistent_comm > 0 || neighbor_comm || node_comm_threshold > 0 || shm_comm)
+      {
+         HYPRE_Int halo[HALO_NUM_BACKENDS+1], total_halo[HALO_NUM_BACKENDS+1];
+
+         /* exchange the global column indices of A with the comm_pkg that
+            the setup has prepared, and check the backend and the halo */
+         halo[HALO_NUM_BACKENDS] = CheckHaloExchange(parcsr_A, persistent_comm > 0, halo);
+         hypre_MPI_Allreduce(halo, total_halo, HALO_NUM_BACKENDS+1, HYPRE_MPI_INT, hypre_MPI_SUM,
+                             hypre_MPI_COMM_WORLD);
+         if (myid == 0)
+         {
+            if (persistent_comm > 0)
+            {
+               hypre_printf("Halo exchange of A with persistent requests on processes = %d\n",
+                            total_halo[HALO_PERSISTENT]);
+            }
+            if (neighbor_comm)
+            {
+               hypre_printf("Halo exchange of A with neighborhood collectives on processes = %d\n",
+                            total_halo[HALO_NEIGHBOR]);
+            }
+            if (node_comm_threshold > 0)
+            {
+               hypre_printf("Halo exchange of A node-aware on processes = %d\n",
+                            total_halo[HALO_NODE]);
+            }
+            if (shm_comm)
+            {
+               hypre_printf("Halo exchange of A through shared memory on processes = %d\n",
+                            total_halo[HALO_SHM]);
+            }
+            hypre_printf("Halo exchange of A entries differing from col_map_offd = %d\n",
+                         total_halo[HALO_NUM_BACKENDS]);
+         }
+      }
+
+      if (host_arena)
+      {
+         HYPRE_Int num_chunks, total_chunks;
+         size_t    arena_size;
+
+         /* the setup leaves its work arrays merged in one chunk for reuse */
+         hypre_HostArenaGetSize(&num_chunks, &arena_size);
+         hypre_MPI_Allreduce(&num_chunks, &total_chunks, 1, HYPRE_MPI_INT, hypre_MPI_SUM,
+                             hypre_MPI_COMM_WORLD);
+         if (myid == 0)
+         {
+            hypre_printf("Host arena chunks kept after the AMG setup = %d\n", total_chunks);
+         }
+      }
+
+      if (reuse_setup)
+      {
+         HYPRE_Int reuse_levels;
+
+         HYPRE_BoomerAMGGetReuseLevels(amg_solver, &reuse_levels);
+         if (myid == 0)
+         {
+            hypre_printf("BoomerAMG re-setup reused levels = %d\n", reuse_levels);
+         }
+      }
+
+      if (print_mem)
+      {
+         size_t     A_size, amg_size, peak_bytes;
+         HYPRE_Real mem[3], max_mem[3];
+
+         HYPRE_ParCSRMatrixGetMemorySize(parcsr_A, &A_size);
+         HYPRE_BoomerAMGGetMemorySize(amg_solver, &amg_size);
+         HYPRE_GetMemoryUsage(HYPRE_MEMORY_HOST, NULL, &peak_bytes, NULL);
+         mem[0] = (HYPRE_Real) A_size / 1048576.0;
+         mem[1] = (HYPRE_Real) amg_size / 1048576.0;
+         mem[2] = (HYPRE_Real) peak_bytes / 1048576.0;
+         hypre_MPI_Allreduce(mem, max_mem, 3, HYPRE_MPI_REAL, hypre_MPI_MAX, hypre_MPI_COMM_WORLD);
+         if (myid == 0)
+         {
+            hypre_printf("Memory per process (max, MB): A %.2f, AMG hierarchy %.2f, host peak %.2f\n",
+                         max_mem[0], max_mem[1], max_mem[2]);
+         }
+      }
+
       time_index = hypre_InitializeTiming("BoomerAMG Solve");
       hypre_BeginTiming(time_index);
 
@@ -3452,6 +4015,50 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (amg_level_stats)
+      {
+         /* times are the maximum over the processes, the rates use the
+            flops and bytes summed over the processes */
+         HYPRE_Int  lev, phase, amg_num_levels;
+         HYPRE_Real stats[4], times[7], max_times[7], work[2], sum_work[2], lev_time;
+
+         HYPRE_BoomerAMGGetNumLevels(amg_solver, &amg_num_levels);
+         if (myid == 0)
+         {
+            hypre_printf("\nSolve profile per level (max seconds over processes)\n");
+            hypre_printf("lev  pre-smooth    residual    restrict      interp post-smooth"
+                         "      coarse    MPI wait   GFlop/s      GB/s\n");
+         }
+         for (lev = 0; lev < amg_num_levels; lev++)
+         {
+            times[6] = work[0] = work[1] = 0.0;
+            for (phase = 0; phase < 6; phase++)
+            {
+               HYPRE_BoomerAMGGetLevelStats(amg_solver, lev, phase, stats);
+               times[phase] = stats[0];
+               work[0]     += stats[1];
+               work[1]     += stats[2];
+               times[6]    += stats[3];
+            }
+            hypre_MPI_Allreduce(times, max_times, 7, HYPRE_MPI_REAL, hypre_MPI_MAX, hypre_MPI_COMM_WORLD);
+            hypre_MPI_Allreduce(work, sum_work, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_MPI_COMM_WORLD);
+
+            lev_time = 0.0;
+            for (phase = 0; phase < 6; phase++)
+            {
+               lev_time += max_times[phase];
+            }
+            if (myid == 0)
+            {
+               hypre_printf("%3d %11.3e %11.3e %11.3e %11.3e %11.3e %11.3e %11.3e %9.3f %9.3f\n",
+                            lev, max_times[0], max_times[1], max_times[2], max_times[3],
+                            max_times[4], max_times[5], max_times[6],
+                            lev_time > 0.0 ? sum_work[0] / lev_time * 1.0e-9 : 0.0,
+                            lev_time > 0.0 ? sum_work[1] / lev_time * 1.0e-9 : 0.0);
+            }
+         }
+      }
+
       HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
       HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
 
@@ -3584,6 +4191,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyFraction(amg_solver, cheby_fraction);
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
+      HYPRE_BoomerAMGSetGSJacobiSweeps(amg_solver, gs_jacobi_sweeps);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
@@ -3628,6 +4236,9 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetStreamRAP(amg_solver, stream_rap);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetNodeCommThreshold(amg_solver, node_comm_threshold);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol-1]);
@@ -3708,6 +4319,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetPipelined(pcg_solver, pcg_pipelined);
 
       if (solver_id == 1)
       {
@@ -3759,6 +4371,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -3804,6 +4417,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -3927,6 +4543,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -3970,6 +4587,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5115,6 +5735,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_GMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_GMRESSetCGS(pcg_solver, gmres_cgs);
       HYPRE_GMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_GMRESSetTol(pcg_solver, tol);
       HYPRE_GMRESSetAbsoluteTol(pcg_solver, atol);
@@ -5183,6 +5804,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -5236,6 +5858,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5347,6 +5972,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -5392,6 +6018,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5453,6 +6082,12 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_ljac_iters);
+         HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_ujac_iters);
+         HYPRE_ILUSetFactorSweeps(pcg_precond, ilu_factor_sweeps);
+         HYPRE_ILUSetBlockSize(pcg_precond, ilu_block_size);
+         HYPRE_ILUSetLocalReordering(pcg_precond, ilu_reordering);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -5581,6 +6216,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRLGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_LGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_LGMRESSetCGS(pcg_solver, gmres_cgs);
       HYPRE_LGMRESSetAugDim(pcg_solver, aug_dim);
       HYPRE_LGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_LGMRESSetTol(pcg_solver, tol);
@@ -5638,6 +6274,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -5683,6 +6320,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5768,6 +6408,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRFlexGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_FlexGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_FlexGMRESSetCGS(pcg_solver, gmres_cgs);
       HYPRE_FlexGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_FlexGMRESSetTol(pcg_solver, tol);
       HYPRE_FlexGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -5824,6 +6465,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -5869,6 +6511,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6005,6 +6650,12 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_ljac_iters);
+         HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_ujac_iters);
+         HYPRE_ILUSetFactorSweeps(pcg_precond, ilu_factor_sweeps);
+         HYPRE_ILUSetBlockSize(pcg_precond, ilu_block_size);
+         HYPRE_ILUSetLocalReordering(pcg_precond, ilu_reordering);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -6191,6 +6842,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -6237,6 +6889,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6540,6 +7195,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -6586,6 +7242,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6850,6 +7509,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetGSJacobiSweeps(pcg_precond, gs_jacobi_sweeps);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -6888,6 +7548,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetStreamRAP(pcg_precond, stream_rap);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetNodeCommThreshold(pcg_precond, node_comm_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7147,6 +7810,13 @@ main( hypre_int argc,
       HYPRE_ILUSetType(ilu_solver, ilu_type);
       /* set level of fill */
       HYPRE_ILUSetLevelOfFill(ilu_solver, ilu_lfil);
+      /* set triangular solves */
+      HYPRE_ILUSetTriSolve(ilu_solver, ilu_tri_solve);
+      HYPRE_ILUSetLowerJacobiIters(ilu_solver, ilu_ljac_iters);
+      HYPRE_ILUSetUpperJacobiIters(ilu_solver, ilu_ujac_iters);
+      HYPRE_ILUSetFactorSweeps(ilu_solver, ilu_factor_sweeps);
+      HYPRE_ILUSetBlockSize(ilu_solver, ilu_block_size);
+      HYPRE_ILUSetLocalReordering(ilu_solver, ilu_reordering);
       /* set print level */
       HYPRE_ILUSetPrintLevel(ilu_solver, 2);
       /* set max iterations */
@@ -7283,6 +7953,15 @@ main( hypre_int argc,
 
    //hypre_PrintMemoryTracker();
 
+   if (region_timing)
+   {
+      HYPRE_PrintRegionTiming(hypre_MPI_COMM_WORLD, "ij.regions.json", 0);
+      if (region_timing > 1)
+      {
+         HYPRE_PrintRegionTiming(hypre_MPI_COMM_WORLD, "ij.trace.json", 1);
+      }
+   }
+
    /* Finalize Hypre */
    HYPRE_Finalize();
 
@@ -9237,6 +9916,165 @@ BuildParCoordinates( HYPRE_Int            argc,
    return (0);
 }
 
+/*----------------------------------------------------------------------
+ * Host product of A (or of A^T) with a random vector, for the checks
+ * that compare a matvec path with the plain CSR one
+ *----------------------------------------------------------------------*/
+
+hypre_ParVector *
+RandomMatvec( hypre_ParCSRMatrix *A,
+              HYPRE_Int           transpose )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParVector *x, *y;
+
+   if (transpose)
+   {
+      x = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      y = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(A),
+                                hypre_ParCSRMatrixColStarts(A));
+   }
+   else
+   {
+      x = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(A),
+                                hypre_ParCSRMatrixColStarts(A));
+      y = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+   }
+   hypre_ParVectorSetPartitioningOwner(x, 0);
+   hypre_ParVectorSetPartitioningOwner(y, 0);
+   hypre_ParVectorInitialize_v2(x, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(y, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetRandomValues(x, 1);
+
+   if (transpose)
+   {
+      hypre_ParCSRMatrixMatvecT(1.0, A, x, 0.0, y);
+   }
+   else
+   {
+      hypre_ParCSRMatrixMatvec(1.0, A, x, 0.0, y);
+   }
+
+   hypre_ParVectorDestroy(x);
+
+   return y;
+}
+
+/*----------------------------------------------------------------------
+ * Returns 1 if max|y - z| exceeds 1e-12 max|z| on any process
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+ParVectorsDiffer( hypre_ParVector *y,
+                  hypre_ParVector *z )
+{
+   HYPRE_Complex *y_data = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Complex *z_data = hypre_VectorData(hypre_ParVectorLocalVector(z));
+   HYPRE_Int      size   = hypre_VectorSize(hypre_ParVectorLocalVector(z));
+   HYPRE_Real     err[2], max_err[2];
+   HYPRE_Int      i;
+
+   err[0] = 0.0;
+   err[1] = 0.0;
+   for (i = 0; i < size; i++)
+   {
+      err[0] = hypre_max(err[0], hypre_abs(y_data[i] - z_data[i]));
+      err[1] = hypre_max(err[1], hypre_abs(z_data[i]));
+   }
+   hypre_MPI_Allreduce(err, max_err, 2, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                       hypre_ParVectorComm(z));
+
+   return (max_err[0] > 1.0e-12 * max_err[1]);
+}
+
+/*----------------------------------------------------------------------
+ * Exchanges the global column indices of A through its comm_pkg, with
+ * the persistent handle of job 1 if persistent is nonzero and the handle
+ * exists, and sets backends[k] to 1 for the HALO_* backends used.
+ * Returns the number of halo entries that differ from col_map_offd.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+CheckHaloExchange( hypre_ParCSRMatrix *A,
+                   HYPRE_Int           persistent,
+                   HYPRE_Int          *backends )
+{
+   hypre_ParCSRCommPkg              *comm_pkg;
+   hypre_ParCSRCommHandle           *comm_handle;
+   hypre_ParCSRPersistentCommHandle *persistent_handle = NULL;
+   HYPRE_BigInt                     *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt                      first_col     = hypre_ParCSRMatrixFirstColDiag(A);
+   HYPRE_Int                         num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Complex                    *send_data, *recv_data;
+   HYPRE_Int                         num_send_elmts, num_wrong, i;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   num_send_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, hypre_ParCSRCommPkgNumSends(comm_pkg));
+
+   for (i = 0; i < HALO_NUM_BACKENDS; i++)
+   {
+      backends[i] = 0;
+   }
+
+   if (persistent)
+   {
+      persistent_handle = comm_pkg -> persistent_comm_handles[HYPRE_COMM_PKG_JOB_COMPLEX];
+   }
+   if (persistent_handle)
+   {
+      backends[HALO_PERSISTENT] = 1;
+      send_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_handle);
+      recv_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_handle);
+   }
+   else
+   {
+      send_data = hypre_CTAlloc(HYPRE_Complex, num_send_elmts, HYPRE_MEMORY_HOST);
+      recv_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+   }
+
+   for (i = 0; i < num_send_elmts; i++)
+   {
+      send_data[i] = (HYPRE_Complex) (first_col + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i));
+   }
+
+   if (persistent_handle)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_handle, HYPRE_MEMORY_HOST, send_data);
+      hypre_ParCSRPersistentCommHandleWait(persistent_handle, HYPRE_MEMORY_HOST, recv_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_data, recv_data);
+      backends[HALO_NEIGHBOR] = hypre_ParCSRCommHandleNeighborComm(comm_handle);
+      backends[HALO_NODE]     = (hypre_ParCSRCommHandleNodeCommBuffer(comm_handle) != NULL);
+      backends[HALO_SHM]      = hypre_ParCSRCommHandleShmComm(comm_handle);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   num_wrong = 0;
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      if (recv_data[i] != (HYPRE_Complex) col_map_offd[i])
+      {
+         num_wrong++;
+      }
+   }
+
+   if (!persistent_handle)
+   {
+      hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+   }
+
+   return num_wrong;
+}
+
 
 /* begin lobpcg */
 
@@ -56,6 +56,7 @@ typedef int HYPRE_Int;
  *--------------------------------------------------------------------------*/
 
 #include <float.h>
+#include <stddef.h>
 
 #if defined(HYPRE_SINGLE)
 typedef float HYPRE_Real;
@@ -163,6 +164,69 @@ HYPRE_VersionNumber( HYPRE_Int  *major_ptr,
 /*Checks whether the AP is on */
 HYPRE_Int HYPRE_AssumedPartitionCheck();
 
+/*--------------------------------------------------------------------------
+ * HYPRE runtime options
+ *--------------------------------------------------------------------------*/
+
+/**
+ * (Optional) If overlap is nonzero, the host ParCSR matvec computes the rows
+ * without off-processor entries while the halo exchange is in progress (with
+ * OpenMP, the master thread waits for the exchange while the other threads
+ * compute), and the remaining rows once it has completed.  The default is 0.
+ **/
+HYPRE_Int HYPRE_SetMatvecOverlap(HYPRE_Int overlap);
+
+/**
+ * (Optional) If persistent is nonzero, the ParCSR matvecs, transpose matvecs
+ * and relaxation sweeps exchange their halos through persistent MPI requests
+ * and buffers that are set up once per communication package and reused.
+ * The default is 1 if hypre was configured with persistent communication
+ * enabled, and 0 otherwise.
+ **/
+HYPRE_Int HYPRE_SetPersistentComm(HYPRE_Int persistent);
+
+/**
+ * (Optional) If neighbor is nonzero, the ParCSR communication packages
+ * created from then on (matvec packages and the AMG hierarchy) get MPI-3
+ * distributed graph communicators, and their halo exchanges are done with a
+ * single MPI_Ineighbor_alltoallv instead of one send and receive per
+ * neighbor.  Exchanges with persistent requests are not affected.  It is
+ * ignored if the MPI library does not support MPI-3.  The default is 0.
+ **/
+HYPRE_Int HYPRE_SetNeighborComm(HYPRE_Int neighbor);
+
+/**
+ * (Optional) If shm is nonzero, BoomerAMG sets up MPI-3 shared memory windows
+ * for the halo exchanges of the operators of its hierarchy: ranks on the same
+ * node read the values they need directly from the send buffers of their
+ * neighbors, and only values for other nodes are sent as messages.  Exchanges
+ * with persistent requests and node-aware exchanges are not affected.  It is
+ * ignored if the MPI library does not support MPI-3.  The default is 0.
+ **/
+HYPRE_Int HYPRE_SetShmComm(HYPRE_Int shm);
+
+/**
+ * (Optional) If arena is nonzero, the short-lived host work arrays of the
+ * BoomerAMG setup (strength matrices, interpolation) are taken from a bump
+ * allocator that is reset after each level, instead of malloc and free.  Its
+ * memory is kept for the next setup, which helps when setups are repeated
+ * (e.g. once per nonlinear iteration).  Setting arena to 0 releases it.  The
+ * default is 0.
+ **/
+HYPRE_Int HYPRE_SetHostArena(HYPRE_Int arena);
+
+/**
+ * (Optional) Selects the kernel for sparse matrix-matrix products on the
+ * host, which are used by the ParCSR products and the BoomerAMG setup:
+ *
+ *    - 0 : one dense marker array per thread over all columns of the result
+ *    - 1 : rows split into blocks of equal work, with an accumulator chosen
+ *          per row (linear scan, hash table or dense marker) by its length
+ *
+ * Both give the same result.  The default is 1.
+ **/
+HYPRE_Int HYPRE_SetSpGemmHostAlgorithm(HYPRE_Int algorithm);
+
 typedef enum _HYPRE_MemoryLocation
 {
    HYPRE_MEMORY_UNDEFINED = -1,
@@ -177,6 +241,50 @@ typedef enum _HYPRE_ExecutionPolicy
    HYPRE_EXEC_DEVICE
 } HYPRE_ExecutionPolicy;
 
+/**
+ * Memory used by hypre on this process in the given location: bytes
+ * currently allocated, the high-water mark and the number of allocations
+ * made.  Host sizes include the padding of the C library when it can be
+ * queried.  Any of the outputs may be NULL.
+ **/
+HYPRE_Int HYPRE_GetMemoryUsage(HYPRE_MemoryLocation location, size_t *current_bytes,
+                               size_t *peak_bytes, size_t *num_allocs);
+
+/**
+ * Resets the high-water mark reported by HYPRE_GetMemoryUsage to the bytes
+ * currently allocated, e.g. to measure the peak of a single setup.
+ **/
+HYPRE_Int HYPRE_ResetMemoryPeak(HYPRE_MemoryLocation location);
+
+/**
+ * Turns the region timing on or off.  When on, the setup and solve phases of
+ * the solvers (and the regions opened by \e HYPRE\_RegionBegin) are timed as
+ * a tree per thread: a region opened inside another one is its child.
+ * Turning it on again discards the times recorded so far.
+ *
+ *    - 0 : off (default)
+ *    - 1 : calls and times of every region
+ *    - 2 : also records every call for the trace output
+ **/
+HYPRE_Int HYPRE_SetRegionTiming(HYPRE_Int region_timing);
+
+/**
+ * Opens and closes a region of the region timing in user code.  Regions must
+ * be closed in the reverse order in which they were opened.
+ **/
+HYPRE_Int HYPRE_RegionBegin(const char *name);
+HYPRE_Int HYPRE_RegionEnd(const char *name);
+
+/**
+ * Writes the region timing of all processes in comm to filename (to the
+ * standard output if NULL).  Collective; only the first process writes.
+ *
+ *    - 0 : the region tree of each thread in JSON, with the number of calls
+ *          and the min/max/avg time over the processes that entered a region
+ *    - 1 : every call in the Chrome trace event format (region timing 2)
+ **/
+HYPRE_Int HYPRE_PrintRegionTiming(MPI_Comm comm, const char *filename, HYPRE_Int format);
+
 #ifdef __cplusplus
 }
 #endif
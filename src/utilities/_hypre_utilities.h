@@ -40,6 +40,9 @@ typedef unsigned long int hypre_ulongint;
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double            hypre_double;
 
+/* Fixed single precision, e.g. for low-precision copies of matrix values */
+typedef float             hypre_float;
+
 /*--------------------------------------------------------------------------
  * Define various functions
  *--------------------------------------------------------------------------*/
@@ -256,6 +259,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -267,6 +271,16 @@ extern "C" {
 #define MPI_Type_free       hypre_MPI_Type_free
 #define MPI_Op_free         hypre_MPI_Op_free
 #define MPI_Op_create       hypre_MPI_Op_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
+#define MPI_Win             hypre_MPI_Win
+#define MPI_Win_allocate_shared hypre_MPI_Win_allocate_shared
+#define MPI_Win_shared_query hypre_MPI_Win_shared_query
+#define MPI_Win_free        hypre_MPI_Win_free
+#define MPI_Win_lock_all    hypre_MPI_Win_lock_all
+#define MPI_Win_unlock_all  hypre_MPI_Win_unlock_all
+#define MPI_Win_sync        hypre_MPI_Win_sync
+#define MPI_MODE_NOCHECK    hypre_MPI_MODE_NOCHECK
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
 
@@ -290,12 +304,14 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef HYPRE_Int  hypre_MPI_Win;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
 
 #define  hypre_MPI_COMM_TYPE_SHARED 0
+#define  hypre_MPI_MODE_NOCHECK 0
 
 #define  hypre_MPI_BOTTOM  0x0
 
@@ -337,6 +353,7 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_Win      hypre_MPI_Win;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
@@ -344,6 +361,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
+#define  hypre_MPI_MODE_NOCHECK       MPI_MODE_NOCHECK
 
 #define  hypre_MPI_FLOAT   MPI_FLOAT
 #define  hypre_MPI_DOUBLE  MPI_DOUBLE
@@ -380,6 +398,25 @@ typedef MPI_User_function    hypre_MPI_User_function;
  * Everything below this applies to both ifdef cases above
  *****************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * Time spent in blocking MPI completion calls (waits and blocking
+ * reductions), accumulated while hypre_MPIWaitTiming is nonzero
+ *--------------------------------------------------------------------------*/
+
+extern HYPRE_Int  hypre__mpi_wait_timing;
+extern HYPRE_Real hypre__mpi_wait_time;
+#define hypre_MPIWaitTiming hypre__mpi_wait_timing
+#define hypre_MPIWaitTime   hypre__mpi_wait_time
+
+/*--------------------------------------------------------------------------
+ * For testing: if nonzero, hypre_MPI_Comm_split_type with
+ * hypre_MPI_COMM_TYPE_SHARED treats each block of hypre_MPINodeSize
+ * consecutive ranks of MPI_COMM_WORLD as a separate node
+ *--------------------------------------------------------------------------*/
+
+extern HYPRE_Int  hypre__mpi_node_size;
+#define hypre_MPINodeSize   hypre__mpi_node_size
+
 /*--------------------------------------------------------------------------
  * Prototypes
  *--------------------------------------------------------------------------*/
@@ -427,6 +464,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -438,11 +476,17 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , HYPRE_Int reorder , hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size , HYPRE_Int disp_unit , hypre_MPI_Info info , hypre_MPI_Comm comm , void *baseptr , hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_shared_query( hypre_MPI_Win win , HYPRE_Int rank , hypre_MPI_Aint *size , HYPRE_Int *disp_unit , void *baseptr );
+HYPRE_Int hypre_MPI_Win_free( hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_lock_all( HYPRE_Int assert , hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_unlock_all( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_sync( hypre_MPI_Win win );
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
-#endif
 
 #ifdef __cplusplus
 }
@@ -743,6 +787,15 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/* host work arrays from the host arena, released with it (see hypre_memory.c);
+   they are freed with hypre_TFree(ptr, HYPRE_MEMORY_HOST) and must not be
+   reallocated */
+#define hypre_TAllocArena(type, count) \
+( (type *) hypre_HostArenaMAlloc((size_t)(sizeof(type) * (count)), 0) )
+
+#define hypre_CTAllocArena(type, count) \
+( (type *) hypre_HostArenaMAlloc((size_t)(sizeof(type) * (count)), 1) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -766,6 +819,14 @@ HYPRE_ExecutionPolicy hypre_GetExecPolicy2(HYPRE_MemoryLocation location1, HYPRE
 
 HYPRE_Int hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory_location);
 HYPRE_Int hypre_PrintMemoryTracker();
+void * hypre_HostArenaMAlloc(size_t size, HYPRE_Int zeroinit);
+HYPRE_Int hypre_HostArenaBegin();
+HYPRE_Int hypre_HostArenaEnd();
+HYPRE_Int hypre_HostArenaReset();
+HYPRE_Int hypre_HostArenaFinalize();
+HYPRE_Int hypre_HostArenaGetSize(HYPRE_Int *num_chunks, size_t *size);
+HYPRE_Int hypre_GetMemoryUsage(hypre_MemoryLocation location, size_t *current_bytes, size_t *peak_bytes, size_t *num_allocs);
+HYPRE_Int hypre_ResetMemoryPeak(hypre_MemoryLocation location);
 HYPRE_Int hypre_SetCubMemPoolSize( hypre_uint bin_growth, hypre_uint min_bin, hypre_uint max_bin, size_t max_cached_bytes );
 
 /* memory_dmalloc.c */
@@ -964,6 +1025,10 @@ HYPRE_Real time_getCPUSeconds( void );
 HYPRE_Real time_get_wallclock_seconds_( void );
 HYPRE_Real time_get_cpu_seconds_( void );
 
+/* timing_regions.c */
+HYPRE_Int hypre_RegionBegin( const char *name );
+HYPRE_Int hypre_RegionEnd( const char *name );
+
 /*--------------------------------------------------------------------------
  * With timing off
  *--------------------------------------------------------------------------*/
@@ -1167,13 +1232,15 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts,
 
 #include <caliper/cali.h>
 
-#define HYPRE_ANNOTATION_BEGIN( str ) cali_begin_string_byname("hypre.kernel", str)
-#define HYPRE_ANNOTATION_END( str ) cali_end_byname("hypre.kernel")
+#define HYPRE_ANNOTATION_BEGIN( str ) \
+do { cali_begin_string_byname("hypre.kernel", str); hypre_RegionBegin(str); } while (0)
+#define HYPRE_ANNOTATION_END( str ) \
+do { hypre_RegionEnd(str); cali_end_byname("hypre.kernel"); } while (0)
 
 #else
 
-#define HYPRE_ANNOTATION_BEGIN( str ) 
-#define HYPRE_ANNOTATION_END( str ) 
+#define HYPRE_ANNOTATION_BEGIN( str ) hypre_RegionBegin(str)
+#define HYPRE_ANNOTATION_END( str ) hypre_RegionEnd(str)
 
 #endif
 
@@ -2639,6 +2706,18 @@ typedef struct
    HYPRE_Complex*                    struct_comm_send_buffer;
    HYPRE_Int                         struct_comm_recv_buffer_size;
    HYPRE_Int                         struct_comm_send_buffer_size;
+   /* host ParCSR matvec: overlap the halo exchange with the interior rows */
+   HYPRE_Int                         matvec_overlap;
+   /* use persistent MPI requests for the ParCSR halo exchanges */
+   HYPRE_Int                         persistent_comm;
+   /* use MPI-3 neighborhood collectives for the ParCSR halo exchanges */
+   HYPRE_Int                         neighbor_comm;
+   /* exchange on-node halos through MPI-3 shared memory windows */
+   HYPRE_Int                         shm_comm;
+   /* host arena for the work arrays of the AMG setup */
+   HYPRE_Int                         host_arena;
+   /* host spgemm algorithm: 0 dense marker, 1 size-adaptive accumulators */
+   HYPRE_Int                         spgemm_host_algorithm;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_ExecutionPolicy             default_exec_policy;
    HYPRE_Int                         cuda_device;
@@ -2679,6 +2758,12 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_send_buffer_size)
 #define hypre_HandleCudaReduceBuffer(hypre_handle_)         ((hypre_handle_) -> cuda_reduce_buffer)
+#define hypre_HandleMatvecOverlap(hypre_handle_)            ((hypre_handle_) -> matvec_overlap)
+#define hypre_HandlePersistentComm(hypre_handle_)           ((hypre_handle_) -> persistent_comm)
+#define hypre_HandleNeighborComm(hypre_handle_)             ((hypre_handle_) -> neighbor_comm)
+#define hypre_HandleShmComm(hypre_handle_)                  ((hypre_handle_) -> shm_comm)
+#define hypre_HandleHostArena(hypre_handle_)                ((hypre_handle_) -> host_arena)
+#define hypre_HandleSpgemmHostAlgorithm(hypre_handle_)      ((hypre_handle_) -> spgemm_host_algorithm)
 
 /* accessor inline functions to hypre_Handle */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -2922,6 +3007,12 @@ HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
+HYPRE_Int HYPRE_SetMatvecOverlap(HYPRE_Int overlap);
+HYPRE_Int HYPRE_SetPersistentComm(HYPRE_Int persistent);
+HYPRE_Int HYPRE_SetNeighborComm(HYPRE_Int neighbor);
+HYPRE_Int HYPRE_SetShmComm(HYPRE_Int shm);
+HYPRE_Int HYPRE_SetHostArena(HYPRE_Int arena);
+HYPRE_Int HYPRE_SetSpGemmHostAlgorithm(HYPRE_Int algorithm);
 
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );
@@ -2965,6 +3056,8 @@ HYPRE_Int hypre_DoubleQuickSplit ( HYPRE_Real *values , HYPRE_Int *indices , HYP
 /* HYPRE_CUDA_GLOBAL */ void hypre_SeedRand ( HYPRE_Int seed );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Int hypre_RandI ( void );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Real hypre_Rand ( void );
+HYPRE_Int hypre_RandIAt ( HYPRE_Int seed , HYPRE_BigInt k );
+HYPRE_Real hypre_RandAt ( HYPRE_Int seed , HYPRE_BigInt k );
 
 /* hypre_prefix_sum.c */
 /**
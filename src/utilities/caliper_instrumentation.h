@@ -9,6 +9,9 @@
  *
  * Header file for Caliper instrumentation macros
  *
+ * The annotations also open and close the regions of the region timing
+ * (see HYPRE_SetRegionTiming).
+ *
  *****************************************************************************/
 
 #ifndef CALIPER_INSTRUMENTATION_HEADER
@@ -20,13 +23,15 @@
 
 #include <caliper/cali.h>
 
-#define HYPRE_ANNOTATION_BEGIN( str ) cali_begin_string_byname("hypre.kernel", str)
-#define HYPRE_ANNOTATION_END( str ) cali_end_byname("hypre.kernel")
+#define HYPRE_ANNOTATION_BEGIN( str ) \
+do { cali_begin_string_byname("hypre.kernel", str); hypre_RegionBegin(str); } while (0)
+#define HYPRE_ANNOTATION_END( str ) \
+do { hypre_RegionEnd(str); cali_end_byname("hypre.kernel"); } while (0)
 
 #else
 
-#define HYPRE_ANNOTATION_BEGIN( str ) 
-#define HYPRE_ANNOTATION_END( str ) 
+#define HYPRE_ANNOTATION_BEGIN( str ) hypre_RegionBegin(str)
+#define HYPRE_ANNOTATION_END( str ) hypre_RegionEnd(str)
 
 #endif
 
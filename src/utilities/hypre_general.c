@@ -36,6 +36,16 @@ hypre_HandleCreate()
    hypre_Handle *hypre_handle_ = hypre_CTAlloc(hypre_Handle, 1, HYPRE_MEMORY_HOST);
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
+   hypre_HandleMatvecOverlap(hypre_handle_)  = 0;
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_HandlePersistentComm(hypre_handle_) = 1;
+#else
+   hypre_HandlePersistentComm(hypre_handle_) = 0;
+#endif
+   hypre_HandleNeighborComm(hypre_handle_)   = 0;
+   hypre_HandleShmComm(hypre_handle_)        = 0;
+   hypre_HandleHostArena(hypre_handle_)      = 0;
+   hypre_HandleSpgemmHostAlgorithm(hypre_handle_) = 1;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 
@@ -85,6 +95,8 @@ hypre_HandleDestroy(hypre_Handle *hypre_handle_)
       return hypre_error_flag;
    }
 
+   hypre_HostArenaFinalize();
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Int i;
 
@@ -270,6 +282,8 @@ HYPRE_Init()
 HYPRE_Int
 HYPRE_Finalize()
 {
+   HYPRE_SetRegionTiming(0);
+
    hypre_HandleDestroy(_hypre_handle);
 
    /*
@@ -287,3 +301,84 @@ HYPRE_Finalize()
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetMatvecOverlap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetMatvecOverlap(HYPRE_Int overlap)
+{
+   hypre_HandleMatvecOverlap(hypre_handle()) = overlap;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetPersistentComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetPersistentComm(HYPRE_Int persistent)
+{
+   hypre_HandlePersistentComm(hypre_handle()) = persistent;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetNeighborComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetNeighborComm(HYPRE_Int neighbor)
+{
+   hypre_HandleNeighborComm(hypre_handle()) = neighbor;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetShmComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetShmComm(HYPRE_Int shm)
+{
+   hypre_HandleShmComm(hypre_handle()) = shm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetHostArena
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetHostArena(HYPRE_Int arena)
+{
+   hypre_HandleHostArena(hypre_handle()) = arena;
+   if (!arena)
+   {
+      hypre_HostArenaFinalize();
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpGemmHostAlgorithm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetSpGemmHostAlgorithm(HYPRE_Int algorithm)
+{
+   if (algorithm < 0 || algorithm > 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_HandleSpgemmHostAlgorithm(hypre_handle()) = algorithm;
+
+   return hypre_error_flag;
+}
@@ -23,6 +23,9 @@ typedef unsigned long int hypre_ulongint;
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double            hypre_double;
 
+/* Fixed single precision, e.g. for low-precision copies of matrix values */
+typedef float             hypre_float;
+
 /*--------------------------------------------------------------------------
  * Define various functions
  *--------------------------------------------------------------------------*/
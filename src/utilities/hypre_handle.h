@@ -27,6 +27,18 @@ typedef struct
    HYPRE_Complex*                    struct_comm_send_buffer;
    HYPRE_Int                         struct_comm_recv_buffer_size;
    HYPRE_Int                         struct_comm_send_buffer_size;
+   /* host ParCSR matvec: overlap the halo exchange with the interior rows */
+   HYPRE_Int                         matvec_overlap;
+   /* use persistent MPI requests for the ParCSR halo exchanges */
+   HYPRE_Int                         persistent_comm;
+   /* use MPI-3 neighborhood collectives for the ParCSR halo exchanges */
+   HYPRE_Int                         neighbor_comm;
+   /* exchange on-node halos through MPI-3 shared memory windows */
+   HYPRE_Int                         shm_comm;
+   /* host arena for the work arrays of the AMG setup */
+   HYPRE_Int                         host_arena;
+   /* host spgemm algorithm: 0 dense marker, 1 size-adaptive accumulators */
+   HYPRE_Int                         spgemm_host_algorithm;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_ExecutionPolicy             default_exec_policy;
    HYPRE_Int                         cuda_device;
@@ -67,6 +79,12 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_send_buffer_size)
 #define hypre_HandleCudaReduceBuffer(hypre_handle_)         ((hypre_handle_) -> cuda_reduce_buffer)
+#define hypre_HandleMatvecOverlap(hypre_handle_)            ((hypre_handle_) -> matvec_overlap)
+#define hypre_HandlePersistentComm(hypre_handle_)           ((hypre_handle_) -> persistent_comm)
+#define hypre_HandleNeighborComm(hypre_handle_)             ((hypre_handle_) -> neighbor_comm)
+#define hypre_HandleShmComm(hypre_handle_)                  ((hypre_handle_) -> shm_comm)
+#define hypre_HandleHostArena(hypre_handle_)                ((hypre_handle_) -> host_arena)
+#define hypre_HandleSpgemmHostAlgorithm(hypre_handle_)      ((hypre_handle_) -> spgemm_host_algorithm)
 
 /* accessor inline functions to hypre_Handle */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -18,6 +18,14 @@
 #undef HYPRE_USE_UMALLOC
 #endif
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#define hypre_HostUsableSize(ptr) malloc_usable_size(ptr)
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define hypre_HostUsableSize(ptr) malloc_size(ptr)
+#endif
+
 /******************************************************************************
  *
  * Helper routines
@@ -43,6 +51,344 @@ hypre_WrongMemoryLocation()
    fflush(stdout);
 }
 
+/*--------------------------------------------------------------------------
+ * Memory counters
+ *
+ * Bytes in use, high-water mark and number of allocations for each physical
+ * memory location.  They are always on, so the cost is kept to a few atomic
+ * updates per allocation: the size of a host block is taken from the C
+ * library at free time (for host memory these are usable sizes, i.e., they
+ * include the padding of malloc), and only blocks whose size cannot be
+ * queried are recorded in a small pointer table, which is the only part
+ * behind a lock.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_NUM_MEMORY_LOCATIONS 4
+
+typedef struct
+{
+   size_t  current_bytes;
+   size_t  peak_bytes;
+   size_t  num_allocs;
+} hypre_MemoryCounter;
+
+static hypre_MemoryCounter hypre_memory_counters[HYPRE_NUM_MEMORY_LOCATIONS];
+
+/* open addressing table: pointer -> size */
+typedef struct
+{
+   size_t   capacity;   /* power of 2 */
+   size_t   num_items;
+   void   **keys;
+   size_t  *sizes;
+} hypre_MemorySizeTable;
+
+static hypre_MemorySizeTable hypre_memory_size_table;
+
+static inline size_t
+hypre_MemorySizeTableHash(void *ptr, size_t capacity)
+{
+   size_t key = (size_t) ptr;
+
+   return ((key >> 4) ^ (key >> 16)) & (capacity - 1);
+}
+
+static void
+hypre_MemorySizeTableInsert(void *ptr, size_t size)
+{
+   hypre_MemorySizeTable *table = &hypre_memory_size_table;
+   size_t                 h, i;
+
+   if (2 * (table -> num_items + 1) > table -> capacity)
+   {
+      size_t   old_capacity = table -> capacity;
+      void   **old_keys     = table -> keys;
+      size_t  *old_sizes    = table -> sizes;
+      size_t   capacity     = old_capacity ? 2 * old_capacity : 1024;
+
+      /* not through hypre_MAlloc, which would count this table */
+      table -> keys  = (void **) calloc(capacity, sizeof(void *));
+      table -> sizes = (size_t *) malloc(capacity * sizeof(size_t));
+      if (!table -> keys || !table -> sizes)
+      {
+         free(table -> keys);
+         free(table -> sizes);
+         table -> keys  = old_keys;
+         table -> sizes = old_sizes;
+         return;
+      }
+      table -> capacity = capacity;
+
+      for (i = 0; i < old_capacity; i++)
+      {
+         if (old_keys[i])
+         {
+            h = hypre_MemorySizeTableHash(old_keys[i], capacity);
+            while (table -> keys[h])
+            {
+               h = (h + 1) & (capacity - 1);
+            }
+            table -> keys[h]  = old_keys[i];
+            table -> sizes[h] = old_sizes[i];
+         }
+      }
+      free(old_keys);
+      free(old_sizes);
+   }
+
+   h = hypre_MemorySizeTableHash(ptr, table -> capacity);
+   while (table -> keys[h] && table -> keys[h] != ptr)
+   {
+      h = (h + 1) & (table -> capacity - 1);
+   }
+   if (!table -> keys[h])
+   {
+      table -> num_items++;
+   }
+   table -> keys[h]  = ptr;
+   table -> sizes[h] = size;
+}
+
+static size_t
+hypre_MemorySizeTableRemove(void *ptr)
+{
+   hypre_MemorySizeTable *table = &hypre_memory_size_table;
+   size_t                 capacity = table -> capacity;
+   size_t                 size, h, i, k;
+
+   if (!capacity)
+   {
+      return 0;
+   }
+
+   h = hypre_MemorySizeTableHash(ptr, capacity);
+   while (table -> keys[h] != ptr)
+   {
+      if (!table -> keys[h])
+      {
+         return 0;
+      }
+      h = (h + 1) & (capacity - 1);
+   }
+   size = table -> sizes[h];
+
+   /* backward shift deletion */
+   i = h;
+   for (;;)
+   {
+      table -> keys[i] = NULL;
+      for (;;)
+      {
+         h = (h + 1) & (capacity - 1);
+         if (!table -> keys[h])
+         {
+            table -> num_items--;
+            return size;
+         }
+         k = hypre_MemorySizeTableHash(table -> keys[h], capacity);
+         /* move the item at h to i unless its home k lies cyclically in (i, h] */
+         if ( (i <= h) ? (i >= k || k > h) : (i >= k && k > h) )
+         {
+            break;
+         }
+      }
+      table -> keys[i]  = table -> keys[h];
+      table -> sizes[i] = table -> sizes[h];
+      i = h;
+   }
+}
+
+/* atomic load and store of a counter field; gcc does not count the operand
+   of an omp atomic write as used, so the builtins are preferred there */
+static inline size_t
+hypre_MemoryCounterRead(size_t *bytes)
+{
+#if defined(__GNUC__)
+   return __atomic_load_n(bytes, __ATOMIC_RELAXED);
+#else
+   size_t value;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic read
+#endif
+   value = *bytes;
+
+   return value;
+#endif
+}
+
+static inline void
+hypre_MemoryCounterWrite(size_t *bytes, size_t value)
+{
+#if defined(__GNUC__)
+   __atomic_store_n(bytes, value, __ATOMIC_RELAXED);
+#else
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic write
+#endif
+   *bytes = value;
+#endif
+}
+
+/* raises *peak to at least bytes */
+static inline void
+hypre_MemoryCounterMax(size_t *peak, size_t bytes)
+{
+   size_t old_peak = hypre_MemoryCounterRead(peak);
+
+#if defined(__GNUC__)
+   while (bytes > old_peak)
+   {
+      size_t prev = __sync_val_compare_and_swap(peak, old_peak, bytes);
+      if (prev == old_peak)
+      {
+         break;
+      }
+      old_peak = prev;
+   }
+#else
+   if (bytes > old_peak)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp critical (hypre_memory_peak)
+#endif
+      if (bytes > *peak)
+      {
+         *peak = bytes;
+      }
+   }
+#endif
+}
+
+static inline void
+hypre_MemoryCounterAlloc(void *ptr, size_t size, hypre_MemoryLocation location)
+{
+   hypre_MemoryCounter *counter = &hypre_memory_counters[location];
+   size_t               current_bytes;
+
+#if defined(hypre_HostUsableSize)
+   if (location == hypre_MEMORY_HOST)
+   {
+      size = hypre_HostUsableSize(ptr);
+   }
+   else
+#endif
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp critical (hypre_memory_size_table)
+#endif
+      hypre_MemorySizeTableInsert(ptr, size);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic capture
+#endif
+   current_bytes = counter -> current_bytes += size;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic
+#endif
+   counter -> num_allocs++;
+
+   hypre_MemoryCounterMax(&counter -> peak_bytes, current_bytes);
+}
+
+static inline void
+hypre_MemoryCounterFree(void *ptr, hypre_MemoryLocation location)
+{
+   hypre_MemoryCounter *counter = &hypre_memory_counters[location];
+   size_t               size, old_bytes;
+
+#if defined(hypre_HostUsableSize)
+   if (location == hypre_MEMORY_HOST)
+   {
+      size = hypre_HostUsableSize(ptr);
+   }
+   else
+#endif
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp critical (hypre_memory_size_table)
+#endif
+      size = hypre_MemorySizeTableRemove(ptr);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic capture
+#endif
+   { old_bytes = counter -> current_bytes; counter -> current_bytes -= size; }
+
+   /* a block that was not counted (e.g. allocated outside of hypre) */
+   if (size > old_bytes)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp atomic
+#endif
+      counter -> current_bytes += size - old_bytes;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Host arena
+ *
+ * Bump allocator for short-lived host work arrays (hypre_TAllocArena,
+ * hypre_CTAllocArena).  It is active between hypre_HostArenaBegin and
+ * hypre_HostArenaEnd if it has been enabled with HYPRE_SetHostArena;
+ * otherwise arena allocations are regular host allocations.  Freeing an arena
+ * block is a no-op, and all blocks are released at once by
+ * hypre_HostArenaReset and the outermost hypre_HostArenaEnd.  The chunks are
+ * then merged into one and kept, so that the next scope (the next level, or
+ * the next setup) reuses memory that has already been touched.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_HOST_ARENA_MAX_CHUNKS 32
+#define HYPRE_HOST_ARENA_MIN_CHUNK  ((size_t) 1 << 20)
+#define HYPRE_HOST_ARENA_ALIGN      ((size_t) 64)
+
+typedef struct
+{
+   HYPRE_Int  depth;
+   HYPRE_Int  num_chunks;
+   HYPRE_Int  cur;        /* chunk being filled */
+   size_t     offset;     /* first free byte of chunk cur */
+   char      *chunks[HYPRE_HOST_ARENA_MAX_CHUNKS];
+   size_t     sizes[HYPRE_HOST_ARENA_MAX_CHUNKS];
+} hypre_HostArena;
+
+static hypre_HostArena hypre_host_arena;
+
+/* Outside of a scope no arena block is alive, so the chunk table is only
+   read (under the lock of hypre_HostArenaMAlloc, which appends to it) while
+   the arena is in use */
+static inline HYPRE_Int
+hypre_HostArenaOwns(void *ptr)
+{
+   hypre_HostArena *arena = &hypre_host_arena;
+   HYPRE_Int        i, owns = 0;
+
+   if (arena -> depth == 0)
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_host_arena)
+#endif
+   {
+      for (i = 0; i < arena -> num_chunks; i++)
+      {
+         if ((char *) ptr >= arena -> chunks[i] &&
+             (char *) ptr <  arena -> chunks[i] + arena -> sizes[i])
+         {
+            owns = 1;
+            break;
+         }
+      }
+   }
+
+   return owns;
+}
+
 /*==========================================================================
  * Physical memory location (hypre_MemoryLocation) interface
  *==========================================================================*/
@@ -244,6 +590,8 @@ hypre_MAlloc_core(size_t size, HYPRE_Int zeroinit, hypre_MemoryLocation location
       hypre_MPI_Abort(hypre_MPI_COMM_WORLD, -1);
    }
 
+   hypre_MemoryCounterAlloc(ptr, size, location);
+
    return ptr;
 }
 
@@ -314,6 +662,17 @@ hypre_Free_core(void *ptr, hypre_MemoryLocation location)
    assert(location == tmp);
 #endif
 
+   if (location == hypre_MEMORY_HOST && hypre_HostArenaOwns(ptr))
+   {
+      /* arena blocks are released with the arena */
+      return;
+   }
+
+   if (location > hypre_MEMORY_UNDEFINED && location < HYPRE_NUM_MEMORY_LOCATIONS)
+   {
+      hypre_MemoryCounterFree(ptr, location);
+   }
+
    switch (location)
    {
       case hypre_MEMORY_HOST :
@@ -656,12 +1015,18 @@ hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location)
       return NULL;
    }
 
+   hypre_MemoryCounterFree(ptr, hypre_MEMORY_HOST);
+
    ptr = realloc(ptr, size);
 
    if (!ptr)
    {
       hypre_OutOfMemory(size);
    }
+   else
+   {
+      hypre_MemoryCounterAlloc(ptr, size, hypre_MEMORY_HOST);
+   }
 
    return ptr;
 }
@@ -789,6 +1154,285 @@ hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory_location)
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaMAlloc
+ *
+ * Allocation from the host arena (see above).  Thread safe.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostArenaMAlloc(size_t size, HYPRE_Int zeroinit)
+{
+   hypre_HostArena *arena = &hypre_host_arena;
+   void            *ptr   = NULL;
+   size_t           aligned_size, chunk_size;
+
+   if (size == 0)
+   {
+      return NULL;
+   }
+
+   if (arena -> depth == 0)
+   {
+      return hypre_MAlloc_core(size, zeroinit, hypre_MEMORY_HOST);
+   }
+
+   aligned_size = (size + HYPRE_HOST_ARENA_ALIGN - 1) & ~(HYPRE_HOST_ARENA_ALIGN - 1);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_host_arena)
+#endif
+   {
+      while (arena -> cur < arena -> num_chunks &&
+             arena -> offset + aligned_size > arena -> sizes[arena -> cur])
+      {
+         arena -> cur++;
+         arena -> offset = 0;
+      }
+
+      if (arena -> cur == arena -> num_chunks &&
+          arena -> num_chunks < HYPRE_HOST_ARENA_MAX_CHUNKS)
+      {
+         /* grow geometrically */
+         chunk_size = hypre_max(aligned_size, HYPRE_HOST_ARENA_MIN_CHUNK);
+         if (arena -> num_chunks > 0)
+         {
+            chunk_size = hypre_max(chunk_size, 2 * arena -> sizes[arena -> num_chunks - 1]);
+         }
+         arena -> chunks[arena -> num_chunks] = (char *) hypre_HostMalloc(chunk_size, 0);
+         if (arena -> chunks[arena -> num_chunks])
+         {
+            hypre_MemoryCounterAlloc(arena -> chunks[arena -> num_chunks], chunk_size,
+                                     hypre_MEMORY_HOST);
+            arena -> sizes[arena -> num_chunks] = chunk_size;
+            arena -> num_chunks++;
+         }
+         arena -> offset = 0;
+      }
+
+      if (arena -> cur < arena -> num_chunks)
+      {
+         ptr = arena -> chunks[arena -> cur] + arena -> offset;
+         arena -> offset += aligned_size;
+      }
+   }
+
+   /* out of chunks */
+   if (!ptr)
+   {
+      return hypre_MAlloc_core(size, zeroinit, hypre_MEMORY_HOST);
+   }
+
+   if (zeroinit)
+   {
+      hypre_HostMemset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaBegin, hypre_HostArenaEnd, hypre_HostArenaReset
+ *
+ * Scopes of the host arena can be nested; only the outermost one resets it.
+ * All arena blocks must be dead when the arena is reset.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_HostArenaRelease( HYPRE_Int keep )
+{
+   hypre_HostArena *arena = &hypre_host_arena;
+   size_t           total = 0;
+   HYPRE_Int        i;
+
+   if (arena -> num_chunks > 1 || !keep)
+   {
+      for (i = 0; i < arena -> num_chunks; i++)
+      {
+         total += arena -> sizes[i];
+         hypre_MemoryCounterFree(arena -> chunks[i], hypre_MEMORY_HOST);
+         hypre_HostFree(arena -> chunks[i]);
+      }
+      arena -> num_chunks = 0;
+
+      if (keep)
+      {
+         arena -> chunks[0] = (char *) hypre_HostMalloc(total, 0);
+         if (arena -> chunks[0])
+         {
+            hypre_MemoryCounterAlloc(arena -> chunks[0], total, hypre_MEMORY_HOST);
+            arena -> sizes[0] = total;
+            arena -> num_chunks = 1;
+         }
+      }
+   }
+   arena -> cur    = 0;
+   arena -> offset = 0;
+}
+
+HYPRE_Int
+hypre_HostArenaBegin()
+{
+   if (hypre_host_arena.depth > 0 || hypre_HandleHostArena(hypre_handle()))
+   {
+      hypre_host_arena.depth++;
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_HostArenaEnd()
+{
+   if (hypre_host_arena.depth > 0)
+   {
+      hypre_host_arena.depth--;
+      if (hypre_host_arena.depth == 0)
+      {
+         hypre_HostArenaRelease(hypre_HandleHostArena(hypre_handle()));
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_HostArenaReset()
+{
+   if (hypre_host_arena.depth == 1)
+   {
+      hypre_HostArenaRelease(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaFinalize
+ *
+ * Frees the chunks kept by the host arena (outside of any scope).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaFinalize()
+{
+   if (hypre_host_arena.depth == 0)
+   {
+      hypre_HostArenaRelease(0);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaGetSize
+ *
+ * Number of chunks held by the host arena and their total size in bytes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaGetSize( HYPRE_Int *num_chunks,
+                        size_t    *size )
+{
+   hypre_HostArena *arena = &hypre_host_arena;
+   HYPRE_Int        i;
+
+   *num_chunks = arena -> num_chunks;
+   *size = 0;
+   for (i = 0; i < arena -> num_chunks; i++)
+   {
+      *size += arena -> sizes[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GetMemoryUsage
+ *
+ * Current bytes, high-water mark (since start or the last
+ * hypre_ResetMemoryPeak) and number of allocations in a physical memory
+ * location.  Any of the outputs may be NULL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GetMemoryUsage(hypre_MemoryLocation location,
+                     size_t              *current_bytes,
+                     size_t              *peak_bytes,
+                     size_t              *num_allocs)
+{
+   hypre_MemoryCounter *counter;
+
+   if (location <= hypre_MEMORY_UNDEFINED || location >= HYPRE_NUM_MEMORY_LOCATIONS)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   counter = &hypre_memory_counters[location];
+
+   if (current_bytes)
+   {
+      *current_bytes = hypre_MemoryCounterRead(&counter -> current_bytes);
+   }
+   if (peak_bytes)
+   {
+      *peak_bytes = hypre_MemoryCounterRead(&counter -> peak_bytes);
+   }
+   if (num_allocs)
+   {
+      *num_allocs = hypre_MemoryCounterRead(&counter -> num_allocs);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ResetMemoryPeak
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ResetMemoryPeak(hypre_MemoryLocation location)
+{
+   hypre_MemoryCounter *counter;
+
+   if (location <= hypre_MEMORY_UNDEFINED || location >= HYPRE_NUM_MEMORY_LOCATIONS)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   counter = &hypre_memory_counters[location];
+   hypre_MemoryCounterWrite(&counter -> peak_bytes,
+                            hypre_MemoryCounterRead(&counter -> current_bytes));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GetMemoryUsage
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GetMemoryUsage(HYPRE_MemoryLocation  location,
+                     size_t               *current_bytes,
+                     size_t               *peak_bytes,
+                     size_t               *num_allocs)
+{
+   return hypre_GetMemoryUsage(hypre_GetActualMemLocation(location),
+                               current_bytes, peak_bytes, num_allocs);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ResetMemoryPeak
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ResetMemoryPeak(HYPRE_MemoryLocation location)
+{
+   return hypre_ResetMemoryPeak(hypre_GetActualMemLocation(location));
+}
+
 /*--------------------------------------------------------------------------
  * Memory tracker
  *--------------------------------------------------------------------------*/
@@ -278,6 +278,15 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/* host work arrays from the host arena, released with it (see hypre_memory.c);
+   they are freed with hypre_TFree(ptr, HYPRE_MEMORY_HOST) and must not be
+   reallocated */
+#define hypre_TAllocArena(type, count) \
+( (type *) hypre_HostArenaMAlloc((size_t)(sizeof(type) * (count)), 0) )
+
+#define hypre_CTAllocArena(type, count) \
+( (type *) hypre_HostArenaMAlloc((size_t)(sizeof(type) * (count)), 1) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -301,6 +310,14 @@ HYPRE_ExecutionPolicy hypre_GetExecPolicy2(HYPRE_MemoryLocation location1, HYPRE
 
 HYPRE_Int hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory_location);
 HYPRE_Int hypre_PrintMemoryTracker();
+void * hypre_HostArenaMAlloc(size_t size, HYPRE_Int zeroinit);
+HYPRE_Int hypre_HostArenaBegin();
+HYPRE_Int hypre_HostArenaEnd();
+HYPRE_Int hypre_HostArenaReset();
+HYPRE_Int hypre_HostArenaFinalize();
+HYPRE_Int hypre_HostArenaGetSize(HYPRE_Int *num_chunks, size_t *size);
+HYPRE_Int hypre_GetMemoryUsage(hypre_MemoryLocation location, size_t *current_bytes, size_t *peak_bytes, size_t *num_allocs);
+HYPRE_Int hypre_ResetMemoryPeak(hypre_MemoryLocation location);
 HYPRE_Int hypre_SetCubMemPoolSize( hypre_uint bin_growth, hypre_uint min_bin, hypre_uint max_bin, size_t max_cached_bytes );
 
 /* memory_dmalloc.c */
@@ -24,6 +24,10 @@ hypre_MPI_Comm_f2c( hypre_int comm )
 #endif
 }
 
+HYPRE_Int  hypre__mpi_wait_timing = 0;
+HYPRE_Real hypre__mpi_wait_time   = 0.0;
+HYPRE_Int  hypre__mpi_node_size   = 0;
+
 /******************************************************************************
  * MPI stubs to generate serial codes without mpi
  *****************************************************************************/
@@ -553,6 +557,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -646,7 +663,62 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return(0);
 }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old, HYPRE_Int indegree, HYPRE_Int *sources,
+                                      HYPRE_Int outdegree, HYPRE_Int *destinations,
+                                      HYPRE_Int reorder, hypre_MPI_Comm *comm_dist_graph )
+{
+   *comm_dist_graph = comm_old;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void *sendbuf, hypre_int *sendcounts, hypre_int *sdispls,
+                               hypre_MPI_Datatype sendtype, void *recvbuf, hypre_int *recvcounts,
+                               hypre_int *rdispls, hypre_MPI_Datatype recvtype,
+                               hypre_MPI_Comm comm, hypre_MPI_Request *request )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size, HYPRE_Int disp_unit, hypre_MPI_Info info,
+                               hypre_MPI_Comm comm, void *baseptr, hypre_MPI_Win *win )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_shared_query( hypre_MPI_Win win, HYPRE_Int rank, hypre_MPI_Aint *size,
+                            HYPRE_Int *disp_unit, void *baseptr )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_free( hypre_MPI_Win *win )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_lock_all( HYPRE_Int assert, hypre_MPI_Win win )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_unlock_all( hypre_MPI_Win win )
+{
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_sync( hypre_MPI_Win win )
+{
+   return(0);
+}
+
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
    return (0);
@@ -661,7 +733,6 @@ HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info )
 {
    return (0);
 }
-#endif
 
 /******************************************************************************
  * MPI stubs to do casting of HYPRE_Int and hypre_int correctly
@@ -1143,7 +1214,19 @@ HYPRE_Int
 hypre_MPI_Wait( hypre_MPI_Request *request,
                 hypre_MPI_Status  *status )
 {
-   return (HYPRE_Int) MPI_Wait(request, status);
+   HYPRE_Int  ierr;
+   HYPRE_Real t0;
+
+   if (!hypre_MPIWaitTiming)
+   {
+      return (HYPRE_Int) MPI_Wait(request, status);
+   }
+
+   t0 = MPI_Wtime();
+   ierr = (HYPRE_Int) MPI_Wait(request, status);
+   hypre_MPIWaitTime += MPI_Wtime() - t0;
+
+   return ierr;
 }
 
 HYPRE_Int
@@ -1151,8 +1234,21 @@ hypre_MPI_Waitall( HYPRE_Int          count,
                    hypre_MPI_Request *array_of_requests,
                    hypre_MPI_Status  *array_of_statuses )
 {
-   return (HYPRE_Int) MPI_Waitall((hypre_int)count,
+   HYPRE_Int  ierr;
+   HYPRE_Real t0;
+
+   if (!hypre_MPIWaitTiming)
+   {
+      return (HYPRE_Int) MPI_Waitall((hypre_int)count,
+                                     array_of_requests, array_of_statuses);
+   }
+
+   t0 = MPI_Wtime();
+   ierr = (HYPRE_Int) MPI_Waitall((hypre_int)count,
                                   array_of_requests, array_of_statuses);
+   hypre_MPIWaitTime += MPI_Wtime() - t0;
+
+   return ierr;
 }
 
 HYPRE_Int
@@ -1177,8 +1273,42 @@ hypre_MPI_Allreduce( void              *sendbuf,
                      hypre_MPI_Op       op,
                      hypre_MPI_Comm     comm )
 {
+   HYPRE_Int  ierr;
+   HYPRE_Real t0;
+
+   if (!hypre_MPIWaitTiming)
+   {
+      return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                       datatype, op, comm);
+   }
+
+   t0 = MPI_Wtime();
+   ierr = (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+   hypre_MPIWaitTime += MPI_Wtime() - t0;
+
+   return ierr;
+}
+
+/* Non-blocking reductions need MPI-3; with older libraries the reduction is
+ * done right away and the request is set to MPI_REQUEST_NULL */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
    return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
                                     datatype, op, comm);
+#endif
 }
 
 HYPRE_Int
@@ -1303,11 +1433,148 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+/* The neighborhood collectives need MPI-3; with older libraries these return
+ * MPI_ERR_OTHER so that callers can fall back to point-to-point messages */
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old, HYPRE_Int indegree, HYPRE_Int *sources,
+                                      HYPRE_Int outdegree, HYPRE_Int *destinations,
+                                      HYPRE_Int reorder, hypre_MPI_Comm *comm_dist_graph )
+{
+#if MPI_VERSION >= 3
+   hypre_int *mpi_sources, *mpi_destinations, *mpi_weights;
+   HYPRE_Int  i, ierr;
+
+   /* unit weights rather than MPI_UNWEIGHTED, and at least one entry per
+      array, so that no zero-length or sentinel pointers reach MPI */
+   mpi_sources      = hypre_TAlloc(hypre_int, indegree + 1, HYPRE_MEMORY_HOST);
+   mpi_destinations = hypre_TAlloc(hypre_int, outdegree + 1, HYPRE_MEMORY_HOST);
+   mpi_weights      = hypre_TAlloc(hypre_int, hypre_max(indegree, outdegree) + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   for (i = 0; i <= hypre_max(indegree, outdegree); i++)
+   {
+      mpi_weights[i] = 1;
+   }
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm_old,
+                                                     (hypre_int) indegree, mpi_sources, mpi_weights,
+                                                     (hypre_int) outdegree, mpi_destinations, mpi_weights,
+                                                     MPI_INFO_NULL, (hypre_int) reorder, comm_dist_graph);
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void *sendbuf, hypre_int *sendcounts, hypre_int *sdispls,
+                               hypre_MPI_Datatype sendtype, void *recvbuf, hypre_int *recvcounts,
+                               hypre_int *rdispls, hypre_MPI_Datatype recvtype,
+                               hypre_MPI_Comm comm, hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+/* Shared memory windows (MPI-3); as above, MPI_ERR_OTHER with older
+ * libraries */
+HYPRE_Int
+hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size, HYPRE_Int disp_unit, hypre_MPI_Info info,
+                               hypre_MPI_Comm comm, void *baseptr, hypre_MPI_Win *win )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Win_allocate_shared(size, (hypre_int) disp_unit, info, comm, baseptr, win);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Win_shared_query( hypre_MPI_Win win, HYPRE_Int rank, hypre_MPI_Aint *size,
+                            HYPRE_Int *disp_unit, void *baseptr )
+{
+#if MPI_VERSION >= 3
+   hypre_int mpi_disp_unit;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Win_shared_query(win, (hypre_int) rank, size, &mpi_disp_unit, baseptr);
+   *disp_unit = (HYPRE_Int) mpi_disp_unit;
+
+   return ierr;
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Win_free( hypre_MPI_Win *win )
+{
+   return (HYPRE_Int) MPI_Win_free(win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_lock_all( HYPRE_Int assert, hypre_MPI_Win win )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Win_lock_all((hypre_int) assert, win);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Win_unlock_all( hypre_MPI_Win win )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Win_unlock_all(win);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+HYPRE_Int
+hypre_MPI_Win_sync( hypre_MPI_Win win )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Win_sync(win);
+#else
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
-   return (HYPRE_Int) MPI_Comm_split_type(comm, split_type, key, info, newcomm );
+   HYPRE_Int      ierr;
+   hypre_int      world_id;
+   hypre_MPI_Comm node_comm;
+
+   ierr = (HYPRE_Int) MPI_Comm_split_type(comm, split_type, key, info, newcomm );
+
+   /* emulate nodes of hypre_MPINodeSize consecutive ranks of MPI_COMM_WORLD */
+   if (!ierr && hypre_MPINodeSize > 0 && split_type == hypre_MPI_COMM_TYPE_SHARED)
+   {
+      node_comm = *newcomm;
+      MPI_Comm_rank(MPI_COMM_WORLD, &world_id);
+      ierr = (HYPRE_Int) MPI_Comm_split(node_comm, world_id / hypre_MPINodeSize, key, newcomm);
+      MPI_Comm_free(&node_comm);
+   }
+
+   return ierr;
 }
 
 HYPRE_Int
@@ -1321,6 +1588,5 @@ hypre_MPI_Info_free( hypre_MPI_Info *info )
 {
    return (HYPRE_Int) MPI_Info_free(info);
 }
-#endif
 
 #endif
@@ -116,6 +116,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -127,6 +128,16 @@ extern "C" {
 #define MPI_Type_free       hypre_MPI_Type_free
 #define MPI_Op_free         hypre_MPI_Op_free
 #define MPI_Op_create       hypre_MPI_Op_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
+#define MPI_Win             hypre_MPI_Win
+#define MPI_Win_allocate_shared hypre_MPI_Win_allocate_shared
+#define MPI_Win_shared_query hypre_MPI_Win_shared_query
+#define MPI_Win_free        hypre_MPI_Win_free
+#define MPI_Win_lock_all    hypre_MPI_Win_lock_all
+#define MPI_Win_unlock_all  hypre_MPI_Win_unlock_all
+#define MPI_Win_sync        hypre_MPI_Win_sync
+#define MPI_MODE_NOCHECK    hypre_MPI_MODE_NOCHECK
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
 
@@ -150,12 +161,14 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef HYPRE_Int  hypre_MPI_Win;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
 
 #define  hypre_MPI_COMM_TYPE_SHARED 0
+#define  hypre_MPI_MODE_NOCHECK 0
 
 #define  hypre_MPI_BOTTOM  0x0
 
@@ -197,6 +210,7 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_Win      hypre_MPI_Win;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
@@ -204,6 +218,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
+#define  hypre_MPI_MODE_NOCHECK       MPI_MODE_NOCHECK
 
 #define  hypre_MPI_FLOAT   MPI_FLOAT
 #define  hypre_MPI_DOUBLE  MPI_DOUBLE
@@ -240,6 +255,25 @@ typedef MPI_User_function    hypre_MPI_User_function;
  * Everything below this applies to both ifdef cases above
  *****************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * Time spent in blocking MPI completion calls (waits and blocking
+ * reductions), accumulated while hypre_MPIWaitTiming is nonzero
+ *--------------------------------------------------------------------------*/
+
+extern HYPRE_Int  hypre__mpi_wait_timing;
+extern HYPRE_Real hypre__mpi_wait_time;
+#define hypre_MPIWaitTiming hypre__mpi_wait_timing
+#define hypre_MPIWaitTime   hypre__mpi_wait_time
+
+/*--------------------------------------------------------------------------
+ * For testing: if nonzero, hypre_MPI_Comm_split_type with
+ * hypre_MPI_COMM_TYPE_SHARED treats each block of hypre_MPINodeSize
+ * consecutive ranks of MPI_COMM_WORLD as a separate node
+ *--------------------------------------------------------------------------*/
+
+extern HYPRE_Int  hypre__mpi_node_size;
+#define hypre_MPINodeSize   hypre__mpi_node_size
+
 /*--------------------------------------------------------------------------
  * Prototypes
  *--------------------------------------------------------------------------*/
@@ -287,6 +321,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -298,11 +333,17 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , HYPRE_Int reorder , hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size , HYPRE_Int disp_unit , hypre_MPI_Info info , hypre_MPI_Comm comm , void *baseptr , hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_shared_query( hypre_MPI_Win win , HYPRE_Int rank , hypre_MPI_Aint *size , HYPRE_Int *disp_unit , void *baseptr );
+HYPRE_Int hypre_MPI_Win_free( hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_lock_all( HYPRE_Int assert , hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_unlock_all( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_sync( hypre_MPI_Win win );
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
-#endif
 
 #ifdef __cplusplus
 }
@@ -38,6 +38,12 @@ HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
+HYPRE_Int HYPRE_SetMatvecOverlap(HYPRE_Int overlap);
+HYPRE_Int HYPRE_SetPersistentComm(HYPRE_Int persistent);
+HYPRE_Int HYPRE_SetNeighborComm(HYPRE_Int neighbor);
+HYPRE_Int HYPRE_SetShmComm(HYPRE_Int shm);
+HYPRE_Int HYPRE_SetHostArena(HYPRE_Int arena);
+HYPRE_Int HYPRE_SetSpGemmHostAlgorithm(HYPRE_Int algorithm);
 
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );
@@ -81,6 +87,8 @@ HYPRE_Int hypre_DoubleQuickSplit ( HYPRE_Real *values , HYPRE_Int *indices , HYP
 /* HYPRE_CUDA_GLOBAL */ void hypre_SeedRand ( HYPRE_Int seed );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Int hypre_RandI ( void );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Real hypre_Rand ( void );
+HYPRE_Int hypre_RandIAt ( HYPRE_Int seed , HYPRE_BigInt k );
+HYPRE_Real hypre_RandAt ( HYPRE_Int seed , HYPRE_BigInt k );
 
 /* hypre_prefix_sum.c */
 /**
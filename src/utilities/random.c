@@ -109,3 +109,55 @@ HYPRE_Real hypre_Rand()
   return ((HYPRE_Real)(hypre_RandI()) / m);
 }
 
+
+/*--------------------------------------------------------------------------
+ * Computes the number that hypre_RandI returns k calls after
+ * hypre_SeedRand(seed), without using or changing the global variable Seed.
+ * The number after k calls is seed * a^k mod m, so any place in the sequence
+ * can be reached in O(log k) operations, and parts of one sequence can be
+ * generated independently (e.g., by different threads).
+ *
+ * @param seed an HYPRE_Int containing the seed for the RNG.
+ * @param k the number of calls, k >= 0 (k = 0 returns the seed).
+ * @return a HYPRE_Int between (0, 2147483647]
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_RandIAt( HYPRE_Int seed, HYPRE_BigInt k )
+{
+   unsigned long long  x, p;
+
+   if (seed < 1)
+   {
+      seed = 1;
+   }
+   else if (seed >= m)
+   {
+      seed = m - 1;
+   }
+
+   x = (unsigned long long) seed;
+   p = a;
+   while (k > 0)
+   {
+      if (k & 1)
+      {
+         x = (x * p) % m;
+      }
+      p = (p * p) % m;
+      k >>= 1;
+   }
+
+   return (HYPRE_Int) x;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes the number that hypre_Rand returns k calls after
+ * hypre_SeedRand(seed) (see hypre_RandIAt).
+ *
+ * @return a HYPRE_Real in (0, 1].
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real hypre_RandAt( HYPRE_Int seed, HYPRE_BigInt k )
+{
+   return ((HYPRE_Real)(hypre_RandIAt(seed, k)) / m);
+}
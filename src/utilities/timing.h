@@ -32,6 +32,10 @@ HYPRE_Real time_getCPUSeconds( void );
 HYPRE_Real time_get_wallclock_seconds_( void );
 HYPRE_Real time_get_cpu_seconds_( void );
 
+/* timing_regions.c */
+HYPRE_Int hypre_RegionBegin( const char *name );
+HYPRE_Int hypre_RegionEnd( const char *name );
+
 /*--------------------------------------------------------------------------
  * With timing off
  *--------------------------------------------------------------------------*/
@@ -0,0 +1,689 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Nested region timing.
+ *
+ * Regions are opened and closed by hypre_RegionBegin and hypre_RegionEnd
+ * (and by the HYPRE_ANNOTATION_BEGIN/END macros that mark the phases of the
+ * solvers).  Each thread keeps its own tree of regions: a region opened while
+ * another one is open becomes its child, and a region is identified by the
+ * names on its path from the root.  Every node counts its calls and its
+ * inclusive wall time; with trace events on, every call is also recorded with
+ * its start time.  HYPRE_PrintRegionTiming gathers the trees of all
+ * processes, reduces the time of each region to min/max/avg over the
+ * processes that entered it, and writes them as JSON, or writes the calls
+ * in the Chrome trace event format.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+typedef struct
+{
+   char       *name;
+   HYPRE_Int   parent;
+   HYPRE_Int   child;       /* first child */
+   HYPRE_Int   sibling;     /* next child of the parent */
+   HYPRE_Int   count;
+   HYPRE_Real  time;
+   HYPRE_Real  start;
+
+} hypre_Region;
+
+typedef struct
+{
+   HYPRE_Int   region;
+   HYPRE_Real  start;       /* seconds since the timing was turned on */
+   HYPRE_Real  duration;
+
+} hypre_RegionEvent;
+
+typedef struct
+{
+   hypre_Region       *regions; /* regions[0] is the root */
+   HYPRE_Int           num_regions;
+   HYPRE_Int           max_regions;
+   HYPRE_Int           current;
+
+   hypre_RegionEvent  *events;
+   HYPRE_Int           num_events;
+   HYPRE_Int           max_events;
+
+} hypre_RegionTree;
+
+typedef struct
+{
+   HYPRE_Int          trace;
+   HYPRE_Int          num_threads;
+   HYPRE_Real         t0;
+   hypre_RegionTree  *trees;
+
+} hypre_RegionTiming;
+
+static hypre_RegionTiming *hypre_region_timing = NULL;
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionTreeAdd
+ *
+ * Adds a child with the given name to region parent of tree.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RegionTreeAdd( hypre_RegionTree *tree,
+                     HYPRE_Int         parent,
+                     const char       *name )
+{
+   hypre_Region *region;
+   HYPRE_Int     r = tree -> num_regions;
+
+   if (r == tree -> max_regions)
+   {
+      tree -> max_regions = 2 * tree -> max_regions + 16;
+      tree -> regions = hypre_TReAlloc(tree -> regions, hypre_Region,
+                                       tree -> max_regions, HYPRE_MEMORY_HOST);
+   }
+   tree -> num_regions++;
+
+   region = &(tree -> regions[r]);
+   region -> name    = hypre_CTAlloc(char, strlen(name) + 1, HYPRE_MEMORY_HOST);
+   strcpy(region -> name, name);
+   region -> parent  = parent;
+   region -> child   = -1;
+   region -> sibling = -1;
+   region -> count   = 0;
+   region -> time    = 0.0;
+   region -> start   = 0.0;
+
+   if (parent >= 0)
+   {
+      region -> sibling = tree -> regions[parent].child;
+      tree -> regions[parent].child = r;
+   }
+
+   return r;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionTimingDestroy
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RegionTimingDestroy( void )
+{
+   hypre_RegionTree *tree;
+   HYPRE_Int         t, r;
+
+   if (!hypre_region_timing)
+   {
+      return;
+   }
+
+   for (t = 0; t < hypre_region_timing -> num_threads; t++)
+   {
+      tree = &(hypre_region_timing -> trees[t]);
+      for (r = 0; r < tree -> num_regions; r++)
+      {
+         hypre_TFree(tree -> regions[r].name, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(tree -> regions, HYPRE_MEMORY_HOST);
+      hypre_TFree(tree -> events, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(hypre_region_timing -> trees, HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_region_timing, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetRegionTiming
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetRegionTiming( HYPRE_Int region_timing )
+{
+   HYPRE_Int t;
+
+   hypre_RegionTimingDestroy();
+
+   if (region_timing)
+   {
+      hypre_region_timing = hypre_CTAlloc(hypre_RegionTiming, 1, HYPRE_MEMORY_HOST);
+      hypre_region_timing -> trace       = (region_timing > 1);
+      hypre_region_timing -> num_threads = hypre_NumThreads();
+      hypre_region_timing -> t0          = hypre_MPI_Wtime();
+      hypre_region_timing -> trees       =
+         hypre_CTAlloc(hypre_RegionTree, hypre_region_timing -> num_threads, HYPRE_MEMORY_HOST);
+
+      for (t = 0; t < hypre_region_timing -> num_threads; t++)
+      {
+         hypre_RegionTreeAdd(&(hypre_region_timing -> trees[t]), -1, "root");
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionBegin
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RegionBegin( const char *name )
+{
+   hypre_RegionTree *tree;
+   HYPRE_Int         t, r;
+
+   if (!hypre_region_timing)
+   {
+      return hypre_error_flag;
+   }
+
+   t = hypre_GetThreadNum();
+   if (t >= hypre_region_timing -> num_threads)
+   {
+      return hypre_error_flag;
+   }
+   tree = &(hypre_region_timing -> trees[t]);
+
+   for (r = tree -> regions[tree -> current].child; r >= 0; r = tree -> regions[r].sibling)
+   {
+      if (strcmp(tree -> regions[r].name, name) == 0)
+      {
+         break;
+      }
+   }
+   if (r < 0)
+   {
+      r = hypre_RegionTreeAdd(tree, tree -> current, name);
+   }
+
+   tree -> current = r;
+   tree -> regions[r].start = hypre_MPI_Wtime();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionEnd
+ *
+ * Closes the innermost open region with the given name, and the regions
+ * opened inside it that are still open.  Nothing is done if no open region
+ * has that name.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RegionEnd( const char *name )
+{
+   hypre_RegionTree  *tree;
+   hypre_Region      *region;
+   hypre_RegionEvent *event;
+   HYPRE_Real         now;
+   HYPRE_Int          t, r, last;
+
+   if (!hypre_region_timing)
+   {
+      return hypre_error_flag;
+   }
+
+   t = hypre_GetThreadNum();
+   if (t >= hypre_region_timing -> num_threads)
+   {
+      return hypre_error_flag;
+   }
+   tree = &(hypre_region_timing -> trees[t]);
+
+   for (last = tree -> current; last > 0; last = tree -> regions[last].parent)
+   {
+      if (strcmp(tree -> regions[last].name, name) == 0)
+      {
+         break;
+      }
+   }
+   if (last <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   now = hypre_MPI_Wtime();
+   do
+   {
+      r = tree -> current;
+      region = &(tree -> regions[r]);
+      region -> time += now - region -> start;
+      region -> count++;
+
+      if (hypre_region_timing -> trace)
+      {
+         if (tree -> num_events == tree -> max_events)
+         {
+            tree -> max_events = 2 * tree -> max_events + 64;
+            tree -> events = hypre_TReAlloc(tree -> events, hypre_RegionEvent,
+                                            tree -> max_events, HYPRE_MEMORY_HOST);
+         }
+         event = &(tree -> events[tree -> num_events++]);
+         event -> region   = r;
+         event -> start    = region -> start - hypre_region_timing -> t0;
+         event -> duration = now - region -> start;
+      }
+
+      tree -> current = region -> parent;
+   }
+   while (r != last);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_RegionBegin, HYPRE_RegionEnd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_RegionBegin( const char *name )
+{
+   return hypre_RegionBegin(name);
+}
+
+HYPRE_Int
+HYPRE_RegionEnd( const char *name )
+{
+   return hypre_RegionEnd(name);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionPath
+ *
+ * Writes the names from the root to region r, separated by '/', to path
+ * (at least max_len characters) and returns the length.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RegionPath( hypre_RegionTree *tree,
+                  HYPRE_Int         r,
+                  char             *path,
+                  HYPRE_Int         max_len )
+{
+   HYPRE_Int len = 0, n;
+
+   if (tree -> regions[r].parent > 0)
+   {
+      len = hypre_RegionPath(tree, tree -> regions[r].parent, path, max_len);
+      if (len < max_len - 1)
+      {
+         path[len++] = '/';
+      }
+   }
+   n = hypre_min((HYPRE_Int) strlen(tree -> regions[r].name), max_len - 1 - len);
+   memcpy(path + len, tree -> regions[r].name, n);
+   len += n;
+   path[len] = '\0';
+
+   return len;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionPrintName
+ *
+ * Prints a name as a JSON string.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RegionPrintName( FILE       *file,
+                       const char *name,
+                       HYPRE_Int   len )
+{
+   HYPRE_Int i;
+
+   fputc('"', file);
+   for (i = 0; i < len && name[i]; i++)
+   {
+      if (name[i] == '"' || name[i] == '\\')
+      {
+         fputc('\\', file);
+      }
+      fputc(name[i], file);
+   }
+   fputc('"', file);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RegionPrintChildren
+ *
+ * Prints the merged regions of thread whose parent path is parent (NULL for
+ * the top level regions) as a JSON array, recursively.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RegionPrintChildren( FILE        *file,
+                           HYPRE_Int    num_merged,
+                           char       **paths,
+                           HYPRE_Int   *threads,
+                           HYPRE_Real  *merged,
+                           HYPRE_Int    thread,
+                           const char  *parent,
+                           HYPRE_Int    indent )
+{
+   HYPRE_Int   i, first = 1;
+   HYPRE_Int   parent_len = parent ? strlen(parent) : 0;
+   const char *name;
+
+   fprintf(file, "[");
+   for (i = 0; i < num_merged; i++)
+   {
+      if (threads[i] != thread)
+      {
+         continue;
+      }
+      if (parent)
+      {
+         if (strncmp(paths[i], parent, parent_len) != 0 || paths[i][parent_len] != '/')
+         {
+            continue;
+         }
+         name = paths[i] + parent_len + 1;
+      }
+      else
+      {
+         name = paths[i];
+      }
+      if (strchr(name, '/'))
+      {
+         continue;
+      }
+
+      fprintf(file, "%s\n%*s{\"name\": ", first ? "" : ",", indent + 2, "");
+      hypre_RegionPrintName(file, name, strlen(name));
+      fprintf(file, ", \"calls\": %.0f, \"ranks\": %.0f, \"min\": %e, \"max\": %e, \"avg\": %e,"
+              " \"children\": ", merged[5*i+4], merged[5*i+3], merged[5*i], merged[5*i+1],
+              merged[5*i+2] / merged[5*i+3]);
+      hypre_RegionPrintChildren(file, num_merged, paths, threads, merged, thread,
+                                paths[i], indent + 2);
+      fprintf(file, "}");
+      first = 0;
+   }
+   if (first)
+   {
+      fprintf(file, "]");
+   }
+   else
+   {
+      fprintf(file, "\n%*s]", indent, "");
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PrintRegionTiming
+ *
+ * Collective on comm.  The entries of all processes are gathered on the
+ * first process: for every region, its path, thread, number of calls and
+ * time, and with format 1 the calls of the trace.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_REGION_PATH_LEN 512
+
+HYPRE_Int
+HYPRE_PrintRegionTiming( MPI_Comm    comm,
+                         const char *filename,
+                         HYPRE_Int   format )
+{
+   hypre_RegionTree *tree;
+   HYPRE_Int         my_id, num_procs;
+   HYPRE_Int         t, r, e, i, j, p, len;
+   char              path[HYPRE_REGION_PATH_LEN];
+
+   /* local entries */
+   HYPRE_Int         num_entries = 0, num_chars = 0, num_events = 0;
+   char             *chars;
+   HYPRE_Real       *values;     /* thread, calls, time per entry */
+   HYPRE_Real       *events;     /* entry, start, duration per event */
+   HYPRE_Int        *entry_of;   /* entry of each region of a thread */
+   HYPRE_Int         sizes[3];
+
+   /* gathered on the first process */
+   HYPRE_Int        *all_sizes = NULL, *counts = NULL, *displs = NULL;
+   char             *all_chars = NULL;
+   HYPRE_Real       *all_values = NULL, *all_events = NULL;
+   HYPRE_Int         total_entries = 0, total_chars = 0, total_events = 0;
+
+   /* merged regions */
+   HYPRE_Int         num_merged = 0;
+   char            **paths = NULL;
+   HYPRE_Int        *threads = NULL;
+   HYPRE_Real       *merged = NULL;   /* min, max, sum, ranks, calls */
+   HYPRE_Int        *merged_of = NULL;
+
+   FILE             *file;
+
+   if (format != 0 && format != 1)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Pack the regions of all threads in depth first order
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_region_timing)
+   {
+      for (t = 0; t < hypre_region_timing -> num_threads; t++)
+      {
+         tree = &(hypre_region_timing -> trees[t]);
+         for (r = 1; r < tree -> num_regions; r++)
+         {
+            num_chars += hypre_RegionPath(tree, r, path, HYPRE_REGION_PATH_LEN) + 1;
+         }
+         num_entries += tree -> num_regions - 1;
+         num_events  += tree -> num_events;
+      }
+   }
+
+   chars  = hypre_CTAlloc(char, num_chars + 1, HYPRE_MEMORY_HOST);
+   values = hypre_CTAlloc(HYPRE_Real, 3*num_entries + 1, HYPRE_MEMORY_HOST);
+   events = hypre_CTAlloc(HYPRE_Real, 3*num_events + 1, HYPRE_MEMORY_HOST);
+
+   if (hypre_region_timing)
+   {
+      i = e = len = 0;
+      for (t = 0; t < hypre_region_timing -> num_threads; t++)
+      {
+         tree = &(hypre_region_timing -> trees[t]);
+         entry_of = hypre_CTAlloc(HYPRE_Int, tree -> num_regions, HYPRE_MEMORY_HOST);
+         for (r = 1; r < tree -> num_regions; r++)
+         {
+            len += hypre_RegionPath(tree, r, chars + len, HYPRE_REGION_PATH_LEN) + 1;
+            values[3*i]   = (HYPRE_Real) t;
+            values[3*i+1] = (HYPRE_Real) tree -> regions[r].count;
+            values[3*i+2] = tree -> regions[r].time;
+            entry_of[r] = i++;
+         }
+         for (j = 0; j < tree -> num_events; j++)
+         {
+            events[3*e]   = (HYPRE_Real) entry_of[tree -> events[j].region];
+            events[3*e+1] = tree -> events[j].start;
+            events[3*e+2] = tree -> events[j].duration;
+            e++;
+         }
+         hypre_TFree(entry_of, HYPRE_MEMORY_HOST);
+      }
+   }
+   if (format == 0)
+   {
+      num_events = 0;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Gather on the first process
+    *-----------------------------------------------------------------------*/
+
+   sizes[0] = num_entries;
+   sizes[1] = num_chars;
+   sizes[2] = num_events;
+   if (my_id == 0)
+   {
+      all_sizes = hypre_CTAlloc(HYPRE_Int, 3*num_procs, HYPRE_MEMORY_HOST);
+      counts    = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      displs    = hypre_CTAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(sizes, 3, HYPRE_MPI_INT, all_sizes, 3, HYPRE_MPI_INT, 0, comm);
+
+   if (my_id == 0)
+   {
+      for (p = 0; p < num_procs; p++)
+      {
+         total_entries += all_sizes[3*p];
+         total_chars   += all_sizes[3*p+1];
+         total_events  += all_sizes[3*p+2];
+      }
+      all_chars  = hypre_CTAlloc(char, total_chars + 1, HYPRE_MEMORY_HOST);
+      all_values = hypre_CTAlloc(HYPRE_Real, 3*total_entries + 1, HYPRE_MEMORY_HOST);
+      all_events = hypre_CTAlloc(HYPRE_Real, 3*total_events + 1, HYPRE_MEMORY_HOST);
+   }
+
+   for (j = 0; j < 3; j++)
+   {
+      if (my_id == 0)
+      {
+         displs[0] = 0;
+         for (p = 0; p < num_procs; p++)
+         {
+            counts[p] = (j == 1) ? all_sizes[3*p+1] : 3*all_sizes[3*p+j];
+            displs[p+1] = displs[p] + counts[p];
+         }
+      }
+      if (j == 0)
+      {
+         hypre_MPI_Gatherv(values, 3*num_entries, HYPRE_MPI_REAL,
+                           all_values, counts, displs, HYPRE_MPI_REAL, 0, comm);
+      }
+      else if (j == 1)
+      {
+         hypre_MPI_Gatherv(chars, num_chars, hypre_MPI_CHAR,
+                           all_chars, counts, displs, hypre_MPI_CHAR, 0, comm);
+      }
+      else
+      {
+         hypre_MPI_Gatherv(events, 3*num_events, HYPRE_MPI_REAL,
+                           all_events, counts, displs, HYPRE_MPI_REAL, 0, comm);
+      }
+   }
+
+   hypre_TFree(chars, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(events, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Merge the regions of the same thread and path, and write the file
+    *-----------------------------------------------------------------------*/
+
+   if (my_id == 0)
+   {
+      paths     = hypre_CTAlloc(char *, total_entries + 1, HYPRE_MEMORY_HOST);
+      threads   = hypre_CTAlloc(HYPRE_Int, total_entries + 1, HYPRE_MEMORY_HOST);
+      merged    = hypre_CTAlloc(HYPRE_Real, 5*total_entries + 1, HYPRE_MEMORY_HOST);
+      merged_of = hypre_CTAlloc(HYPRE_Int, total_entries + 1, HYPRE_MEMORY_HOST);
+
+      len = 0;
+      for (i = 0; i < total_entries; i++)
+      {
+         char      *entry_path   = all_chars + len;
+         HYPRE_Int  entry_thread = (HYPRE_Int) all_values[3*i];
+         HYPRE_Real calls        = all_values[3*i+1];
+         HYPRE_Real time         = all_values[3*i+2];
+
+         len += strlen(entry_path) + 1;
+         for (j = 0; j < num_merged; j++)
+         {
+            if (threads[j] == entry_thread && strcmp(paths[j], entry_path) == 0)
+            {
+               break;
+            }
+         }
+         if (j == num_merged)
+         {
+            paths[j]        = entry_path;
+            threads[j]      = entry_thread;
+            merged[5*j]     = time;
+            merged[5*j+1]   = time;
+            merged[5*j+2]   = 0.0;
+            merged[5*j+3]   = 0.0;
+            merged[5*j+4]   = 0.0;
+            num_merged++;
+         }
+         merged[5*j]   = hypre_min(merged[5*j], time);
+         merged[5*j+1] = hypre_max(merged[5*j+1], time);
+         merged[5*j+2] += time;
+         merged[5*j+3] += 1.0;
+         merged[5*j+4] = hypre_max(merged[5*j+4], calls);
+         merged_of[i] = j;
+      }
+
+      file = filename ? fopen(filename, "w") : stdout;
+      if (!file)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Cannot open the region timing file\n");
+      }
+      else if (format == 0)
+      {
+         HYPRE_Int num_threads = 0;
+
+         for (j = 0; j < num_merged; j++)
+         {
+            num_threads = hypre_max(num_threads, threads[j] + 1);
+         }
+         fprintf(file, "{\n  \"num_ranks\": %d,\n  \"threads\": [", (int) num_procs);
+         for (t = 0; t < num_threads; t++)
+         {
+            fprintf(file, "%s\n    {\"thread\": %d, \"regions\": ", t ? "," : "", (int) t);
+            hypre_RegionPrintChildren(file, num_merged, paths, threads, merged, t, NULL, 4);
+            fprintf(file, "}");
+         }
+         fprintf(file, "\n  ]\n}\n");
+      }
+      else
+      {
+         const char *name;
+
+         fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+         e = 0;
+         for (p = 0, i = 0; p < num_procs; i += all_sizes[3*p], p++)
+         {
+            for (j = 0; j < all_sizes[3*p+2]; j++, e++)
+            {
+               r = i + (HYPRE_Int) all_events[3*e];
+               name = strrchr(paths[merged_of[r]], '/');
+               name = name ? name + 1 : paths[merged_of[r]];
+               fprintf(file, "%s\n{\"name\": ", e ? "," : "");
+               hypre_RegionPrintName(file, name, strlen(name));
+               fprintf(file, ", \"ph\": \"X\", \"pid\": %d, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                       (int) p, (int) threads[merged_of[r]],
+                       1.0e6 * all_events[3*e+1], 1.0e6 * all_events[3*e+2]);
+            }
+         }
+         fprintf(file, "\n]}\n");
+      }
+      if (file && filename)
+      {
+         fclose(file);
+      }
+
+      hypre_TFree(paths, HYPRE_MEMORY_HOST);
+      hypre_TFree(threads, HYPRE_MEMORY_HOST);
+      hypre_TFree(merged, HYPRE_MEMORY_HOST);
+      hypre_TFree(merged_of, HYPRE_MEMORY_HOST);
+      hypre_TFree(all_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(all_chars, HYPRE_MEMORY_HOST);
+      hypre_TFree(all_values, HYPRE_MEMORY_HOST);
+      hypre_TFree(all_events, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}